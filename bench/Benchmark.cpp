@@ -0,0 +1,557 @@
+#include "Game.hpp"
+#include "Player.hpp"
+#include "ObstacleManager.hpp"
+#include "CollisionManager.hpp"
+#include "TextureManager.hpp"
+#include "HudCounter.hpp"
+#include "BatchEnvironment.hpp"
+#include "AnimationPlayer.hpp"
+#include "AllocationTracker.hpp"
+#include "AssetBundle.hpp"
+#include "Replay.hpp"
+#include "SimulationSnapshot.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * DinoRun benchmark suite
+ *
+ * Micro-benchmarks time single hot functions in a tight loop; the macro
+ * benchmark runs a scripted 10-minute headless session with a fixed seed.
+ * Results are written as JSON so runs can be diffed across commits.
+ *
+ * Recorded replays (see --record in main.cpp) can be added as further macro
+ * workloads: each is played back headless at full speed.
+ *
+ * Built with -DDINO_TRACK_ALLOCATIONS, the suite also counts heap allocations
+ * during steady-state play in every session and fails (exit code 1) if there are any.
+ *
+ * Corrupt input files (bad offsets, lying counts) must be rejected by their loaders;
+ * the suite fails (exit code 1) if one is accepted.
+ *
+ * Usage: dinorun_bench [--out <file>] [--batches <n>] [--filter <substring>] [--replay <file>]...
+ */
+
+// ===== Benchmark Configuration =====
+static const unsigned int BENCH_SEED = 12345;             // Fixed seed for every benchmark
+static const double BENCH_TICK = 1.0 / 120.0;             // Same tick as the game default
+static const double MIN_BATCH_SECONDS = 0.01;             // Calibrate batches to at least 10 ms
+static const double MACRO_SESSION_SECONDS = 600.0;        // Scripted session length (simulated)
+static const int DEFAULT_BATCHES = 15;                    // Timed batches per micro-benchmark
+static const size_t BATCH_ENVIRONMENTS = 256;             // Environments stepped per batch environment step
+static const size_t FLOCK_SIZE = 256;                     // Animated birds per flock update
+
+// Results the compiler must assume are used, so timed work is not optimized away
+static volatile double benchmarkSink = 0.0;
+
+/**
+ * Result of one micro-benchmark
+ */
+struct BenchmarkResult {
+    std::string name;
+    long long iterationsPerBatch;
+    int batches;
+    double medianNs;    // Median time per operation over batches
+    double minNs;       // Fastest batch, per operation
+    double maxNs;       // Slowest batch, per operation
+};
+
+/**
+ * Time an operation: calibrate a batch size, then run several timed batches
+ *
+ * @param name Benchmark name (used in the JSON output)
+ * @param batches Number of timed batches
+ * @param operation Callable run once per iteration
+ * @return Per-operation timings
+ */
+template <typename Operation>
+static BenchmarkResult runBenchmark(const std::string& name, int batches, Operation operation) {
+    typedef std::chrono::steady_clock Clock;
+
+    // Calibrate: double the iteration count until one batch is long enough
+    long long iterations = 1;
+    while (true) {
+        Clock::time_point start = Clock::now();
+        for (long long i = 0; i < iterations; ++i) {
+            operation();
+        }
+        std::chrono::duration<double> elapsed = Clock::now() - start;
+        if (elapsed.count() >= MIN_BATCH_SECONDS || iterations >= (1LL << 30)) {
+            break;
+        }
+        iterations *= 2;
+    }
+
+    std::vector<double> samples;
+    for (int b = 0; b < batches; ++b) {
+        Clock::time_point start = Clock::now();
+        for (long long i = 0; i < iterations; ++i) {
+            operation();
+        }
+        std::chrono::duration<double> elapsed = Clock::now() - start;
+        samples.push_back(elapsed.count() * 1e9 / iterations);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    BenchmarkResult result;
+    result.name = name;
+    result.iterationsPerBatch = iterations;
+    result.batches = batches;
+    result.medianNs = samples[samples.size() / 2];
+    result.minNs = samples.front();
+    result.maxNs = samples.back();
+
+    std::cout << "  " << name << ": " << result.medianNs << " ns/op (min " << result.minNs << ")" << std::endl;
+    return result;
+}
+
+// ===== Micro-Benchmarks =====
+
+/**
+ * Triple collision query with a given number of live obstacles
+ * The player is held at the top of a jump so every query runs the full
+ * broad and narrow phase without an early exit on a hit
+ */
+static BenchmarkResult benchCollision(int obstacleCount, int batches) {
+    Player player(100, 400);
+    player.jump();
+    for (int i = 0; i < 68; ++i) {   // ~0.57 s: apex of the jump
+        player.update(BENCH_TICK);
+    }
+
+    // Spread obstacles evenly over the visible playfield
+    ObstacleManager obstacleManager;
+    obstacleManager.setSeed(BENCH_SEED);
+    const Obstacle::ObstacleType types[3] = {
+        Obstacle::ObstacleType::CACTUS_SMALL,
+        Obstacle::ObstacleType::CACTUS_MID,
+        Obstacle::ObstacleType::CACTUS_LARGE
+    };
+    for (int i = 0; i < obstacleCount; ++i) {
+        float x = -40.0f + 840.0f * static_cast<float>(i) / static_cast<float>(obstacleCount);
+        obstacleManager.spawnObstacleAt(types[i % 3], x);
+    }
+
+    return runBenchmark("collision_triple_" + std::to_string(obstacleCount), batches, [&]() {
+        benchmarkSink = CollisionManager::checkPlayerObstacleCollisionTriple(player, obstacleManager) ? 1.0 : 0.0;
+    });
+}
+
+/**
+ * One fixed tick of ObstacleManager::update (movement, spawning, culling)
+ */
+static BenchmarkResult benchObstacleUpdate(int batches) {
+    ObstacleManager obstacleManager;
+    obstacleManager.setSeed(BENCH_SEED);
+    double gameTime = 0.0;
+
+    return runBenchmark("obstacle_manager_update", batches, [&]() {
+        gameTime += BENCH_TICK;
+        obstacleManager.update(BENCH_TICK, gameTime);
+        benchmarkSink = static_cast<double>(obstacleManager.getObstacleCount());
+    });
+}
+
+/**
+ * Pattern selection with every pattern unlocked
+ * (weighted selection plus the cooldown / consecutive-hard checks around it)
+ */
+static BenchmarkResult benchPatternSelection(int batches) {
+    const double unlockedTime = 60.0;
+    ObstacleManager obstacleManager;
+    obstacleManager.setSeed(BENCH_SEED);
+    obstacleManager.update(BENCH_TICK, unlockedTime);
+
+    return runBenchmark("select_pattern", batches, [&]() {
+        benchmarkSink = static_cast<double>(obstacleManager.selectPattern(unlockedTime));
+    });
+}
+
+/**
+ * Capture and restore of the player and obstacle state (one rewind step)
+ */
+static BenchmarkResult benchSnapshotRoundTrip(int batches) {
+    Player player(100, 400);
+    ObstacleManager obstacleManager;
+    obstacleManager.setSeed(BENCH_SEED);
+    for (double gameTime = BENCH_TICK; gameTime < 30.0; gameTime += BENCH_TICK) {
+        obstacleManager.update(BENCH_TICK, gameTime);  // A populated, partly wrapped pool
+    }
+    SimulationSnapshot snapshot;
+
+    return runBenchmark("snapshot_round_trip", batches, [&]() {
+        player.saveSnapshot(snapshot.player);
+        obstacleManager.saveSnapshot(snapshot.obstacles);
+        player.restoreSnapshot(snapshot.player);
+        obstacleManager.restoreSnapshot(snapshot.obstacles, true);
+        benchmarkSink = static_cast<double>(obstacleManager.getObstacleCount());
+    });
+}
+
+/**
+ * Sprite creation through the TextureManager lookup path
+ */
+static BenchmarkResult benchCreateSprite(int batches) {
+    TextureManager& textureManager = TextureManager::getInstance();
+
+    return runBenchmark("texture_manager_create_sprite", batches, [&]() {
+        sf::Sprite sprite = textureManager.createSprite(TextureManager::SpriteType::CACTUS_MID);
+        benchmarkSink = sprite.getTextureRect().width;
+    });
+}
+
+/**
+ * One tick of a bird flock: every bird advances its clip, sprites change only on a frame flip
+ */
+static BenchmarkResult benchAnimationFlock(int batches) {
+    const AnimationClip& flap = AnimationClip::get(AnimationClip::Id::BIRD_FLY);
+    std::vector<AnimationPlayer> players(FLOCK_SIZE);
+    std::vector<sf::Sprite> sprites(FLOCK_SIZE);
+    for (size_t i = 0; i < FLOCK_SIZE; ++i) {
+        players[i].play(flap);
+        players[i].update(i * 0.001);  // Spread the flips over the cycle
+        players[i].applyTo(sprites[i]);
+    }
+
+    return runBenchmark("animation_flock_update_256", batches, [&]() {
+        int flips = 0;
+        for (size_t i = 0; i < FLOCK_SIZE; ++i) {
+            if (players[i].update(BENCH_TICK)) {
+                players[i].applyTo(sprites[i]);
+                ++flips;
+            }
+        }
+        benchmarkSink = flips;
+    });
+}
+
+/**
+ * HUD score formatting
+ */
+static BenchmarkResult benchFormatScore(int batches) {
+    int score = 0;
+
+    return runBenchmark("game_format_score", batches, [&]() {
+        std::string text = Game::formatScore(score++ % 1000000);
+        benchmarkSink = static_cast<double>(text.size());
+    });
+}
+
+/**
+ * HUD counter update: one value change per call, as while the score counts up
+ */
+static BenchmarkResult benchHudCounter(int batches) {
+    sf::Font font;  // No file needed: only the digit relayout is measured
+    HudCounter counter;
+    counter.setup(font, "Score: ", 24, sf::Vector2f(20, 20), sf::Color::Black);
+    int score = 0;
+
+    return runBenchmark("hud_counter_set_value", batches, [&]() {
+        benchmarkSink = counter.setValue(score++ % (HudCounter::MAX_VALUE + 1)) ? 1.0 : 0.0;
+    });
+}
+
+/**
+ * Batch environment step: one tick of BATCH_ENVIRONMENTS games under a lead-distance policy
+ * Finished environments are reset inside the timed operation, as a training loop would
+ */
+static BenchmarkResult benchBatchEnvironment(int batches) {
+    BatchEnvironment environment(BATCH_ENVIRONMENTS, 1.0 / BENCH_TICK);
+    std::vector<uint32_t> seeds(BATCH_ENVIRONMENTS);
+    for (size_t i = 0; i < seeds.size(); ++i) {
+        seeds[i] = BENCH_SEED + static_cast<uint32_t>(i);
+    }
+    environment.reset(seeds);
+    std::vector<BatchEnvironment::Action> actions(BATCH_ENVIRONMENTS, BatchEnvironment::Action::RUN);
+    uint32_t nextSeed = BENCH_SEED + static_cast<uint32_t>(BATCH_ENVIRONMENTS);
+
+    return runBenchmark("batch_environment_step_256", batches, [&]() {
+        const std::vector<float>& observations = environment.getObservations();
+        const std::vector<unsigned char>& dones = environment.getDones();
+        for (size_t i = 0; i < actions.size(); ++i) {
+            if (dones[i]) {
+                environment.resetEnvironment(i, nextSeed++);
+            }
+            const float* row = &observations[i * BatchEnvironment::OBSERVATION_SIZE];
+            float lead = row[BatchEnvironment::OBS_OBSTACLE_SPEED] * 0.25f + 20.0f;
+            actions[i] = row[BatchEnvironment::OBS_FIRST_OBSTACLE] < lead ? BatchEnvironment::Action::JUMP
+                                                                           : BatchEnvironment::Action::RUN;
+        }
+        environment.step(actions);
+        benchmarkSink = environment.getRewards()[0];
+    });
+}
+
+// ===== Macro-Benchmark =====
+
+/**
+ * Scripted 10-minute headless session: fixed seed, autopilot input
+ */
+static Game::HeadlessReport benchHeadlessSession() {
+    Game::Options options;
+    options.headless = true;
+    options.headlessDuration = MACRO_SESSION_SECONDS;
+    options.seed = BENCH_SEED;
+    options.autopilot = true;
+
+    Game game(options);
+    game.run();
+    return game.getHeadlessReport();
+}
+
+/**
+ * Recorded session played back headless at full speed
+ */
+static Game::HeadlessReport benchReplaySession(const std::string& replayPath) {
+    Game::Options options;
+    options.headless = true;
+    options.replayPath = replayPath;
+
+    Game game(options);
+    game.run();
+    return game.getHeadlessReport();
+}
+
+// ===== Corrupt Input Checks =====
+
+/**
+ * Bundle whose only entry points far past the end of the file
+ * (mappedSize - offset would wrap if the offset were not checked first)
+ *
+ * @param path Scratch file (removed afterwards)
+ * @return true if AssetBundle::open rejected it
+ */
+static bool checkCorruptBundle(const std::string& path) {
+    AssetBundle::Header header;
+    std::memcpy(header.magic, AssetBundle::MAGIC, sizeof(header.magic));
+    header.version = AssetBundle::FORMAT_VERSION;
+    header.entryCount = 1;
+
+    AssetBundle::Entry entry;
+    std::memset(&entry, 0, sizeof(entry));
+    std::strncpy(entry.name, "game_font", AssetBundle::NAME_CAPACITY - 1);
+    entry.kind = static_cast<uint32_t>(AssetBundle::AssetKind::FONT);
+    entry.offset = static_cast<uint64_t>(AssetBundle::DATA_ALIGNMENT) << 32;
+    entry.size = AssetBundle::DATA_ALIGNMENT;
+
+    {
+        std::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+        const char data[AssetBundle::DATA_ALIGNMENT] = {};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+        out.write(data, sizeof(data));
+    }
+
+    AssetBundle bundle;
+    bool rejected = !bundle.open(path);
+    std::remove(path.c_str());
+    if (!rejected) {
+        std::cerr << "FAIL: bundle with an entry offset past the end of the file was accepted" << std::endl;
+    }
+    return rejected;
+}
+
+/**
+ * Replay whose header claims about 4G events for a one-byte payload
+ *
+ * @param path Scratch file (removed afterwards)
+ * @return true if Replay::load rejected it
+ */
+static bool checkCorruptReplay(const std::string& path) {
+    Replay::Header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, Replay::MAGIC, sizeof(header.magic));
+    header.version = Replay::FORMAT_VERSION;
+    header.seed = BENCH_SEED;
+    header.eventCount = 0xFFFFFFFFu;
+    header.tickRate = 1.0 / BENCH_TICK;
+    header.tickCount = 1;
+
+    {
+        std::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+        const char event = 0;  // One JUMP at tick 0
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(&event, sizeof(event));
+    }
+
+    Replay replay;
+    bool rejected = !replay.load(path);
+    std::remove(path.c_str());
+    if (!rejected) {
+        std::cerr << "FAIL: replay with an event count larger than its payload was accepted" << std::endl;
+    }
+    return rejected;
+}
+
+// ===== Output =====
+
+static void writeSession(std::ostream& out, const std::string& name, const Game::HeadlessReport& report) {
+    double speedup = (report.wallSeconds > 0.0) ? report.simulatedSeconds / report.wallSeconds : 0.0;
+    out << "{\"name\": \"" << name << "\""
+        << ", \"simulated_s\": " << report.simulatedSeconds
+        << ", \"wall_s\": " << report.wallSeconds
+        << ", \"simulated_s_per_wall_s\": " << speedup
+        << ", \"ticks\": " << report.ticks
+        << ", \"ns_per_tick\": " << (report.ticks > 0 ? report.wallSeconds * 1e9 / report.ticks : 0.0)
+        << ", \"sessions\": " << report.sessions
+        << ", \"high_score\": " << report.highScore
+        << ", \"jumps\": " << report.jumps
+        << ", \"steady_ticks\": " << report.steadyTicks
+        << ", \"steady_allocations\": " << report.steadyAllocations << "}";
+}
+
+static void writeJson(std::ostream& out, const std::vector<BenchmarkResult>& results,
+                      const Game::HeadlessReport* macro,
+                      const std::vector<std::string>& replayPaths,
+                      const std::vector<Game::HeadlessReport>& replays) {
+    out << "{\n";
+    out << "  \"seed\": " << BENCH_SEED << ",\n";
+    out << "  \"micro\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchmarkResult& r = results[i];
+        out << "    {\"name\": \"" << r.name << "\""
+            << ", \"iterations_per_batch\": " << r.iterationsPerBatch
+            << ", \"batches\": " << r.batches
+            << ", \"median_ns\": " << r.medianNs
+            << ", \"min_ns\": " << r.minNs
+            << ", \"max_ns\": " << r.maxNs << "}"
+            << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]";
+
+    if (macro) {
+        out << ",\n  \"macro\": ";
+        writeSession(out, "headless_autopilot_session", *macro);
+    }
+    if (!replays.empty()) {
+        out << ",\n  \"replays\": [\n";
+        for (size_t i = 0; i < replays.size(); ++i) {
+            out << "    ";
+            writeSession(out, replayPaths[i], replays[i]);
+            out << (i + 1 < replays.size() ? "," : "") << "\n";
+        }
+        out << "  ]";
+    }
+    out << "\n}\n";
+}
+
+int main(int argc, char* argv[]) {
+    std::string outputPath = "benchmark_results.json";
+    std::string filter;
+    int batches = DEFAULT_BATCHES;
+    std::vector<std::string> replayPaths;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--out" && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else if (arg == "--batches" && i + 1 < argc) {
+            batches = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--filter" && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (arg == "--replay" && i + 1 < argc) {
+            replayPaths.push_back(argv[++i]);
+        } else {
+            std::cerr << "Ignoring unknown argument: " << arg << std::endl;
+        }
+    }
+
+    // Gameplay logs would only add noise to the timings
+    Logger::getInstance().setLevel(LogLevel::WARN);
+    TextureManager::getInstance().initialize();
+
+    std::vector<BenchmarkResult> results;
+    std::cout << "=== DinoRun micro-benchmarks ===" << std::endl;
+
+    const int collisionCounts[] = {1, 10, 100, 1000};
+    for (int count : collisionCounts) {
+        if (filter.empty() || std::string("collision").find(filter) != std::string::npos) {
+            results.push_back(benchCollision(count, batches));
+        }
+    }
+    if (filter.empty() || std::string("obstacle_manager_update").find(filter) != std::string::npos) {
+        results.push_back(benchObstacleUpdate(batches));
+    }
+    if (filter.empty() || std::string("select_pattern").find(filter) != std::string::npos) {
+        results.push_back(benchPatternSelection(batches));
+    }
+    if (filter.empty() || std::string("snapshot_round_trip").find(filter) != std::string::npos) {
+        results.push_back(benchSnapshotRoundTrip(batches));
+    }
+    if (filter.empty() || std::string("texture_manager_create_sprite").find(filter) != std::string::npos) {
+        results.push_back(benchCreateSprite(batches));
+    }
+    if (filter.empty() || std::string("animation_flock_update_256").find(filter) != std::string::npos) {
+        results.push_back(benchAnimationFlock(batches));
+    }
+    if (filter.empty() || std::string("game_format_score").find(filter) != std::string::npos) {
+        results.push_back(benchFormatScore(batches));
+    }
+    if (filter.empty() || std::string("hud_counter_set_value").find(filter) != std::string::npos) {
+        results.push_back(benchHudCounter(batches));
+    }
+    if (filter.empty() || std::string("batch_environment_step_256").find(filter) != std::string::npos) {
+        results.push_back(benchBatchEnvironment(batches));
+    }
+
+    Game::HeadlessReport macro;
+    bool runMacro = filter.empty() || std::string("headless_autopilot_session").find(filter) != std::string::npos;
+    if (runMacro) {
+        std::cout << "=== DinoRun macro-benchmark ===" << std::endl;
+        macro = benchHeadlessSession();
+    }
+
+    std::vector<Game::HeadlessReport> replays;
+    for (const std::string& replayPath : replayPaths) {
+        std::cout << "=== DinoRun replay: " << replayPath << " ===" << std::endl;
+        replays.push_back(benchReplaySession(replayPath));
+    }
+
+    std::ofstream file(outputPath.c_str());
+    if (!file) {
+        std::cerr << "Could not write benchmark results to " << outputPath << std::endl;
+        return 1;
+    }
+    writeJson(file, results, runMacro ? &macro : nullptr, replayPaths, replays);
+    std::cout << "Benchmark results written to " << outputPath << std::endl;
+
+    // Input gate: malformed files are rejected, never read out of bounds
+    bool bundleRejected = checkCorruptBundle(outputPath + ".corrupt.pak");
+    bool replayRejected = checkCorruptReplay(outputPath + ".corrupt.rep");
+    if (!bundleRejected || !replayRejected) {
+        return 1;
+    }
+    std::cout << "Corrupt input check passed: malformed files rejected" << std::endl;
+
+    // Allocation gate: steady-state play must not touch the heap
+    if (!AllocationTracker::ENABLED) {
+        std::cout << "Allocation check skipped (build with -DDINO_TRACK_ALLOCATIONS)" << std::endl;
+        return 0;
+    }
+    bool allocationFree = true;
+    if (runMacro && macro.steadyAllocations > 0) {
+        std::cerr << "FAIL: headless_autopilot_session made " << macro.steadyAllocations
+                  << " heap allocations over " << macro.steadyTicks << " steady-state ticks" << std::endl;
+        allocationFree = false;
+    }
+    for (size_t i = 0; i < replays.size(); ++i) {
+        if (replays[i].steadyAllocations > 0) {
+            std::cerr << "FAIL: replay " << replayPaths[i] << " made " << replays[i].steadyAllocations
+                      << " heap allocations over " << replays[i].steadyTicks << " steady-state ticks" << std::endl;
+            allocationFree = false;
+        }
+    }
+    if (!allocationFree) {
+        return 1;
+    }
+    std::cout << "Allocation check passed: no heap allocations in steady-state play" << std::endl;
+    return 0;
+}
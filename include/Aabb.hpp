@@ -0,0 +1,61 @@
+#ifndef AABB_HPP
+#define AABB_HPP
+
+#include <cstddef>
+
+/**
+ * Aabb struct: Plain axis-aligned bounding box used by the collision fast path
+ * 
+ * Design Philosophy:
+ * - POD with edges stored directly (no transform, no allocation)
+ * - Same strict-overlap rule as sf::FloatRect::intersects, so results match
+ *   the sf::RectangleShape based collision methods exactly
+ * - Cheap to pack into float lanes for batch (SIMD) tests
+ */
+struct Aabb {
+    float left;     // Smallest x
+    float top;      // Smallest y
+    float right;    // Largest x
+    float bottom;   // Largest y
+    
+    /**
+     * Build a box from position and size
+     * 
+     * @param x Left edge
+     * @param y Top edge
+     * @param width Box width
+     * @param height Box height
+     * @return Box covering [x, x + width] x [y, y + height]
+     */
+    static Aabb fromRect(float x, float y, float width, float height) {
+        Aabb box = {x, y, x + width, y + height};
+        return box;
+    }
+    
+    /**
+     * Check overlap with another box (touching edges do not count)
+     * 
+     * @param other Box to test against
+     * @return true if the boxes overlap
+     */
+    bool intersects(const Aabb& other) const {
+        return left < other.right && other.left < right &&
+               top < other.bottom && other.top < bottom;
+    }
+};
+
+/**
+ * AabbSpan struct: Non-owning view of consecutive boxes (no allocation, no copy)
+ * Valid until the owner updates its boxes
+ */
+struct AabbSpan {
+    const Aabb* data;   // First box
+    size_t count;       // Number of boxes
+    
+    const Aabb* begin() const { return data; }
+    const Aabb* end() const { return data + count; }
+    size_t size() const { return count; }
+    const Aabb& operator[](size_t index) const { return data[index]; }
+};
+
+#endif // AABB_HPP
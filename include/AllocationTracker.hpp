@@ -0,0 +1,69 @@
+#ifndef ALLOCATION_TRACKER_HPP
+#define ALLOCATION_TRACKER_HPP
+
+#include <cstdint>
+
+/**
+ * AllocationTracker class: Counts global operator new calls (debug builds with -DDINO_TRACK_ALLOCATIONS)
+ *
+ * Design Philosophy:
+ * - With DINO_TRACK_ALLOCATIONS defined, AllocationTracker.cpp replaces the global
+ *   operator new/delete with malloc/free plus a per-thread and a process-wide counter
+ * - Without it nothing is replaced and every count reads 0 (ENABLED is false),
+ *   so release builds pay nothing
+ * - Counters are per thread: the game thread's frame count is not disturbed by the
+ *   logger, resource loader or journal threads
+ *
+ * Steady-state play is expected not to allocate at all; dinorun_bench fails when it does.
+ */
+class AllocationTracker {
+public:
+#ifdef DINO_TRACK_ALLOCATIONS
+    static const bool ENABLED = true;
+#else
+    static const bool ENABLED = false;
+#endif
+
+    /**
+     * Get operator new calls made by the calling thread
+     *
+     * @return Allocations since thread start (0 if tracking is disabled)
+     */
+    static uint64_t getThreadAllocations();
+
+    /**
+     * Get operator new calls made by all threads
+     *
+     * @return Allocations since program start (0 if tracking is disabled)
+     */
+    static uint64_t getTotalAllocations();
+
+    /**
+     * Counts the calling thread's allocations from construction on
+     */
+    class Scope {
+    private:
+        uint64_t start;
+
+    public:
+        Scope() : start(getThreadAllocations()) {}
+
+        /**
+         * Get allocations since construction (or the last restart)
+         *
+         * @return Allocation count
+         */
+        uint64_t count() const {
+            return getThreadAllocations() - start;
+        }
+
+        /**
+         * Start counting from zero again
+         */
+        void restart() {
+            start = getThreadAllocations();
+        }
+    };
+};
+
+#endif // ALLOCATION_TRACKER_HPP
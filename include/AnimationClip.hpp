@@ -0,0 +1,99 @@
+#ifndef ANIMATION_CLIP_HPP
+#define ANIMATION_CLIP_HPP
+
+#include "TextureManager.hpp"
+
+/**
+ * AnimationClip class: A fixed sequence of sprite frames with per-frame durations, shared by every entity
+ *
+ * Design Philosophy:
+ * - Every clip is defined once in a compile-time table (sprite type + duration per frame)
+ * - Frames are stored contiguously with their resolved texture and rectangle, so
+ *   showing a frame is a pointer and a rectangle copy, never a string lookup
+ * - Handles are refreshed from TextureManager whenever it re-resolves its sprites
+ * - Entities never own clips; an AnimationPlayer only points at one
+ *
+ * Dino clips all use the two-frame gait timing, so switching between running,
+ * ducking and the air poses keeps the stride phase (Player's hitbox table is indexed by it).
+ */
+class AnimationClip {
+public:
+    /**
+     * Every clip in the game
+     */
+    enum class Id {
+        DINO_RUN,           // Running stride
+        DINO_DUCK,          // Ducking stride
+        DINO_JUMP,          // Jump pose (both frames the same sprite)
+        DINO_FAST_FALL,     // Air duck pose (both frames the same sprite)
+        BIRD_FLY,           // Wing flap
+        COUNT               // Number of clips (not a real clip)
+    };
+
+    static const int CLIP_COUNT = static_cast<int>(Id::COUNT);
+    static const int MAX_FRAMES = 4;    // Frames a clip can hold
+
+    /**
+     * One frame as drawn
+     */
+    struct Frame {
+        TextureManager::SpriteType spriteType;  // Sprite shown (collision masks, snapshots)
+        float duration;                         // Seconds before the next frame
+        TextureManager::SpriteHandle handle;    // Resolved texture and rectangle
+    };
+
+private:
+    Frame frames[MAX_FRAMES];
+    int frameCount;
+
+public:
+    /**
+     * Constructor: Create an empty clip (filled from the clip table)
+     */
+    AnimationClip();
+
+    /**
+     * Get the number of frames
+     *
+     * @return Frame count (at least 1 for every clip in the table)
+     */
+    int getFrameCount() const {
+        return frameCount;
+    }
+
+    /**
+     * Get one frame
+     *
+     * @param index Frame index (0 to getFrameCount() - 1)
+     * @return Frame data
+     */
+    const Frame& getFrame(int index) const {
+        return frames[index];
+    }
+
+    /**
+     * Get a clip from the shared table
+     *
+     * @param id Clip to get
+     * @return Clip (handles empty until TextureManager exists)
+     */
+    static const AnimationClip& get(Id id);
+
+    /**
+     * Refresh every frame's texture and rectangle from TextureManager's sprite handles
+     * Called by TextureManager after it re-resolves them (also from its constructor)
+     *
+     * @param textureManager Source of the sprite handles
+     */
+    static void resolveAll(const TextureManager& textureManager);
+
+private:
+    /**
+     * Get the clip table (built from the definitions on first use)
+     *
+     * @return First of CLIP_COUNT clips
+     */
+    static AnimationClip* library();
+};
+
+#endif // ANIMATION_CLIP_HPP
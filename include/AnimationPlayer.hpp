@@ -0,0 +1,123 @@
+#ifndef ANIMATION_PLAYER_HPP
+#define ANIMATION_PLAYER_HPP
+
+#include <SFML/Graphics.hpp>
+#include "AnimationClip.hpp"
+
+/**
+ * AnimationPlayer class: Per-entity playback position in a shared AnimationClip
+ *
+ * Design Philosophy:
+ * - Only a clip pointer, a frame index and a timer: cheap enough for a flock of birds
+ * - update() and the clip switches report whether the shown frame changed, so callers
+ *   touch their sprite (setTextureRect) only on an actual change
+ * - A frame flip restarts the frame timer (leftover time is dropped), matching the
+ *   original running cycle that the hitbox table and recorded replays depend on
+ */
+class AnimationPlayer {
+public:
+    /**
+     * Playback position (trivially copyable, for simulation snapshots)
+     */
+    struct State {
+        const AnimationClip* clip;
+        int frameIndex;
+        double frameTimer;
+    };
+
+private:
+    const AnimationClip* clip;      // Clip being played (nullptr = nothing)
+    int frameIndex;                 // Frame shown
+    double frameTimer;              // Time spent on the current frame
+
+public:
+    /**
+     * Constructor: Create a player without a clip
+     */
+    AnimationPlayer();
+
+    /**
+     * Start a clip from its first frame
+     *
+     * @param newClip Clip to play
+     * @return true if the shown frame changed
+     */
+    bool play(const AnimationClip& newClip);
+
+    /**
+     * Switch to another clip at the same frame index and timer (keeps the phase)
+     *
+     * @param newClip Clip to continue in
+     * @return true if the shown frame changed
+     */
+    bool switchClip(const AnimationClip& newClip);
+
+    /**
+     * Advance playback (loops at the end of the clip)
+     *
+     * @param deltaTime Time elapsed since last update
+     * @return true if the frame changed
+     */
+    bool update(double deltaTime);
+
+    /**
+     * Set a sprite's texture and rectangle to the shown frame
+     *
+     * @param sprite Sprite to update (scale and position untouched)
+     */
+    void applyTo(sf::Sprite& sprite) const;
+
+    /**
+     * Get the shown frame
+     *
+     * @return Frame data (clip must be set)
+     */
+    const AnimationClip::Frame& getFrame() const {
+        return clip->getFrame(frameIndex);
+    }
+
+    /**
+     * Get the shown frame index
+     *
+     * @return Index within the clip
+     */
+    int getFrameIndex() const {
+        return frameIndex;
+    }
+
+    /**
+     * Get the playback position
+     *
+     * @return Clip, frame index and timer
+     */
+    State getState() const {
+        State state;
+        state.clip = clip;
+        state.frameIndex = frameIndex;
+        state.frameTimer = frameTimer;
+        return state;
+    }
+
+    /**
+     * Continue from a saved playback position
+     *
+     * @param state Position from getState()
+     */
+    void setState(const State& state) {
+        clip = state.clip;
+        frameIndex = state.frameIndex;
+        frameTimer = state.frameTimer;
+    }
+
+    /**
+     * Check whether a clip is playing
+     *
+     * @param other Clip to compare with
+     * @return true if this player plays that clip
+     */
+    bool isPlaying(const AnimationClip& other) const {
+        return clip == &other;
+    }
+};
+
+#endif // ANIMATION_PLAYER_HPP
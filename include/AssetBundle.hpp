@@ -0,0 +1,175 @@
+#ifndef ASSET_BUNDLE_HPP
+#define ASSET_BUNDLE_HPP
+
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * AssetBundle class: Read-only view of a packed asset file
+ *
+ * Design Philosophy:
+ * - One file in one well-defined location instead of probing many paths per asset
+ * - Assets are stored pre-decoded (RGBA8 pixels, 16-bit PCM samples, raw font blob),
+ *   so startup does no PNG / WAV decoding
+ * - The file is memory-mapped once; loaders hand pointers into the mapping
+ *   straight to SFML without intermediate copies
+ *
+ * The bundle is written by tools/AssetPacker.cpp. Layout (little-endian):
+ *   Header | Entry[entryCount] | data blobs (each 16-byte aligned)
+ */
+class AssetBundle {
+public:
+    /**
+     * Kind of data stored in an entry
+     */
+    enum class AssetKind : uint32_t {
+        IMAGE_RGBA8 = 1,    // param0 = width, param1 = height, width * height * 4 bytes
+        SOUND_PCM16 = 2,    // param0 = channel count, param1 = sample rate, interleaved Int16 samples
+        FONT = 3            // Raw font file (TTF), handed to sf::Font::loadFromMemory
+    };
+
+    static const size_t NAME_CAPACITY = 32;     // Bytes reserved for an entry name (NUL-terminated)
+    static const uint32_t FORMAT_VERSION = 1;   // Bumped whenever the layout changes
+    static const size_t DATA_ALIGNMENT = 16;    // Alignment of every data blob in the file
+
+    /**
+     * File header (16 bytes)
+     */
+    struct Header {
+        char magic[8];              // "DINOPAK\0"
+        uint32_t version;           // FORMAT_VERSION
+        uint32_t entryCount;        // Entries following the header
+    };
+
+    /**
+     * Entry table record (64 bytes)
+     */
+    struct Entry {
+        char name[NAME_CAPACITY];   // Asset name, e.g. "dino_sheet"
+        uint32_t kind;              // AssetKind
+        uint32_t param0;            // Meaning depends on kind (see AssetKind)
+        uint32_t param1;
+        uint32_t reserved;          // Always 0
+        uint64_t offset;            // Data position from start of file
+        uint64_t size;              // Data size in bytes
+    };
+
+    static const char MAGIC[8];                 // Expected Header::magic
+    static const std::string DEFAULT_PATH;      // Bundle location used by the game
+
+private:
+    // ===== Mapping State =====
+    const unsigned char* mappedData;    // Start of the mapped file (nullptr if closed)
+    size_t mappedSize;                  // Mapped bytes
+    const Entry* entries;               // Entry table inside the mapping
+    uint32_t entryCount;
+#ifdef _WIN32
+    void* fileHandle;                   // HANDLE of the open file
+    void* mappingHandle;                // HANDLE of the file mapping
+#endif
+
+public:
+    AssetBundle();
+    ~AssetBundle();
+    AssetBundle(const AssetBundle&) = delete;
+    AssetBundle& operator=(const AssetBundle&) = delete;
+
+    // ===== Lifetime =====
+
+    /**
+     * Map a bundle file and validate its header and entry table
+     *
+     * @param path Bundle file path
+     * @return true if the bundle is mapped and well-formed
+     */
+    bool open(const std::string& path);
+
+    /**
+     * Unmap the bundle (fonts loaded from it must not be used afterwards)
+     */
+    void close();
+
+    /**
+     * Check whether a bundle is mapped
+     *
+     * @return true if open() succeeded
+     */
+    bool isOpen() const;
+
+    // ===== Entry Access =====
+
+    /**
+     * Find an entry by name
+     *
+     * @param name Asset name
+     * @return Entry, or nullptr if the bundle has no such asset
+     */
+    const Entry* find(const std::string& name) const;
+
+    /**
+     * Get a pointer to an entry's data inside the mapping
+     *
+     * @param entry Entry returned by find()
+     * @return Start of the data (valid until close())
+     */
+    const void* getData(const Entry& entry) const;
+
+    /**
+     * Get number of entries
+     *
+     * @return Entry count (0 if closed)
+     */
+    size_t getEntryCount() const;
+
+    // ===== SFML Loaders =====
+
+    /**
+     * Upload a pre-decoded RGBA8 image into a texture
+     *
+     * @param name Asset name
+     * @param texture Texture to create
+     * @return true if the asset exists and was uploaded
+     */
+    bool loadTexture(const std::string& name, sf::Texture& texture) const;
+
+    /**
+     * Fill a sound buffer from 16-bit PCM samples
+     *
+     * @param name Asset name
+     * @param buffer Sound buffer to fill
+     * @return true if the asset exists and was loaded
+     */
+    bool loadSoundBuffer(const std::string& name, sf::SoundBuffer& buffer) const;
+
+    /**
+     * Open a font directly from the mapped blob
+     * SFML reads the font data lazily, so the bundle must stay open while the font is in use
+     *
+     * @param name Asset name
+     * @param font Font to load
+     * @return true if the asset exists and was loaded
+     */
+    bool loadFont(const std::string& name, sf::Font& font) const;
+
+private:
+    /**
+     * Check header, entry table and every entry's bounds against the mapping
+     *
+     * @return true if the bundle can be used safely
+     */
+    bool validate();
+
+    /**
+     * Find an entry of a given kind
+     *
+     * @param name Asset name
+     * @param kind Required kind
+     * @return Entry, or nullptr if missing or of another kind
+     */
+    const Entry* findOfKind(const std::string& name, AssetKind kind) const;
+};
+
+#endif // ASSET_BUNDLE_HPP
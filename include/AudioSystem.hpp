@@ -0,0 +1,124 @@
+#ifndef AUDIO_SYSTEM_HPP
+#define AUDIO_SYSTEM_HPP
+
+#include <SFML/Audio.hpp>
+#include <cstddef>
+
+/**
+ * AudioSystem class: Sound effects played from pools of preconfigured voices
+ *
+ * Design Philosophy:
+ * - Every effect owns its buffer and a small fixed pool of sf::Sound voices;
+ *   buffer, volume and pitch are set once when the buffer arrives, never on trigger
+ * - Gameplay only calls enqueue() with an effect id: no SFML calls, no logging
+ * - processQueue() runs once per frame, plays each queued effect at most once
+ *   (duplicates within a frame are dropped), and steals the voice that has
+ *   played longest when all voices of an effect are busy
+ * - Effects whose buffer is missing are ignored, so headless runs and missing
+ *   sound files cost nothing
+ */
+class AudioSystem {
+public:
+    /**
+     * Sound effects the game can trigger
+     */
+    enum class SoundEffect : unsigned char {
+        JUMP,               // Player leaves the ground
+        GAME_OVER,          // Collision ended the run
+        SCORE_MILESTONE,    // Score crossed a milestone
+        COUNT               // Number of effects (not a real effect)
+    };
+
+    static const int EFFECT_COUNT = static_cast<int>(SoundEffect::COUNT);
+    static const int MAX_VOICES_PER_EFFECT = 4;
+
+    /**
+     * Playback counters since construction
+     */
+    struct AudioStats {
+        size_t enqueued;        // enqueue() calls accepted
+        size_t deduplicated;    // Dropped because the effect was already queued this frame
+        size_t played;          // Voices started
+        size_t stolen;          // Voices restarted while still playing
+    };
+
+private:
+    /**
+     * Voices and buffer of one effect
+     */
+    struct EffectChannel {
+        sf::SoundBuffer buffer;
+        sf::Sound voices[MAX_VOICES_PER_EFFECT];
+        int voiceCount;         // Voices in use for this effect (from its config)
+        bool loaded;            // Buffer assigned and voices configured
+    };
+
+    EffectChannel channels[EFFECT_COUNT];
+    SoundEffect queue[EFFECT_COUNT];        // Effects queued this frame, in trigger order
+    bool queued[EFFECT_COUNT];              // De-duplication flags for queue
+    int queueLength;
+    AudioStats stats;
+
+public:
+    /**
+     * Constructor: Create all voices without buffers (every effect silent)
+     */
+    AudioSystem();
+
+    AudioSystem(const AudioSystem&) = delete;
+    AudioSystem& operator=(const AudioSystem&) = delete;
+
+    /**
+     * Assign an effect's buffer and configure its voices (volume, pitch)
+     * Stops voices still playing the previous buffer
+     *
+     * @param effect Effect to configure
+     * @param buffer Sound data (copied)
+     * @param pitch Playback pitch (1.0 = original)
+     */
+    void setBuffer(SoundEffect effect, const sf::SoundBuffer& buffer, float pitch = 1.0f);
+
+    /**
+     * Check whether an effect has a buffer
+     *
+     * @param effect Effect to check
+     * @return true if the effect can be played
+     */
+    bool hasBuffer(SoundEffect effect) const;
+
+    /**
+     * Queue an effect for this frame (hot path: no SFML calls)
+     *
+     * @param effect Effect to play
+     */
+    void enqueue(SoundEffect effect);
+
+    /**
+     * Start a voice for every queued effect and clear the queue
+     * Call once per frame
+     */
+    void processQueue();
+
+    /**
+     * Stop every voice and drop queued effects
+     */
+    void stopAll();
+
+    /**
+     * Get playback counters
+     *
+     * @return Counters since construction
+     */
+    const AudioStats& getStats() const;
+
+private:
+    /**
+     * Pick the voice to start: an idle one, or else the one furthest into playback
+     *
+     * @param channel Effect channel
+     * @return Voice index
+     */
+    int selectVoice(const EffectChannel& channel) const;
+};
+
+#endif // AUDIO_SYSTEM_HPP
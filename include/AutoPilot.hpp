@@ -0,0 +1,64 @@
+#ifndef AUTO_PILOT_HPP
+#define AUTO_PILOT_HPP
+
+class Player;
+class ObstacleManager;
+
+/**
+ * AutoPilot class: Scripted player for headless sessions and benchmarks
+ * 
+ * Design Philosophy:
+ * - Reads only what a human player could see (obstacle positions and speed)
+ * - Deterministic: same seed and tick rate always produce the same session
+ * - Drives the Player through its public actions, like keyboard input does
+ * 
+ * The bot jumps when the nearest obstacle ahead comes within a lead distance
+ * that grows with the current obstacle speed, and fast falls as soon as
+ * nothing is left below it so it is back on the ground for the next one.
+ */
+class AutoPilot {
+private:
+    // ===== Tuning Constants =====
+    static const double JUMP_LEAD_TIME;     // Seconds of obstacle travel before jumping
+    static const double JUMP_LEAD_MARGIN;   // Extra pixels added to the lead distance
+
+    int jumpCount;                          // Jumps issued since construction
+
+public:
+    /**
+     * Constructor: Create an idle autopilot
+     */
+    AutoPilot();
+
+    /**
+     * Decide on this tick's input and apply it to the player
+     * Call once per simulation tick, before the tick is simulated
+     * 
+     * @param player Player to control
+     * @param obstacleManager Obstacles the player has to clear
+     * @return true if a jump was issued this tick
+     */
+    bool update(Player& player, const ObstacleManager& obstacleManager);
+
+    /**
+     * Get number of jumps issued so far
+     * 
+     * @return Jump count
+     */
+    int getJumpCount() const;
+
+private:
+    /**
+     * Check for an obstacle overlapping the player or within the lead distance ahead
+     * 
+     * @param obstacleManager Obstacles to search
+     * @param playerLeft Left edge of the player's collision boxes
+     * @param playerRight Right edge of the player's collision boxes
+     * @param leadDistance How far ahead of the player to look
+     * @return true if such an obstacle exists
+     */
+    static bool hasObstacleAhead(const ObstacleManager& obstacleManager, float playerLeft, float playerRight,
+                                 float leadDistance);
+};
+
+#endif // AUTO_PILOT_HPP
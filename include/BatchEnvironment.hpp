@@ -0,0 +1,156 @@
+#ifndef BATCH_ENVIRONMENT_HPP
+#define BATCH_ENVIRONMENT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Player.hpp"
+#include "ObstacleManager.hpp"
+
+/**
+ * BatchEnvironment class: N independent headless games stepped in lockstep (agent training)
+ *
+ * Design Philosophy:
+ * - Simulation is the game's own: every environment owns a Player and an ObstacleManager
+ *   and ticks them in Game::updatePlayingState order, so trained agents see the real physics
+ * - No window, no Game object, no per-step allocation: players and obstacle managers sit in
+ *   two contiguous vectors, per-environment episode state and all step outputs in flat arrays
+ * - Deterministic: the same seeds and actions always produce the same observations
+ * - One batch is single-threaded; run one batch per core to use a whole node
+ *   (collision counters are thread_local, so batches on different threads never share state)
+ *
+ * Observations are unnormalized floats, OBSERVATION_SIZE per environment, row-major:
+ *   player y, player vertical velocity, ducking, fast falling, obstacle speed,
+ *   then OBSTACLE_SLOTS x (distance ahead, type) for the nearest obstacles not yet passed
+ */
+class BatchEnvironment {
+public:
+    /**
+     * Per-step agent action (the duck key stays held while DUCK is repeated)
+     */
+    enum class Action : unsigned char {
+        RUN,        // No key: releases duck if it was held
+        JUMP,       // Jump (releases duck first)
+        DUCK,       // Hold duck: crouch on the ground, fast fall in the air
+        COUNT       // Number of actions (not a real action)
+    };
+
+    // ===== Observation Layout =====
+    static const int OBS_PLAYER_Y = 0;              // Sprite top edge (px)
+    static const int OBS_PLAYER_VELOCITY_Y = 1;     // px/s, negative while rising
+    static const int OBS_DUCKING = 2;               // 1 while ground ducking
+    static const int OBS_FAST_FALLING = 3;          // 1 while air ducking
+    static const int OBS_OBSTACLE_SPEED = 4;        // Shared speed of all obstacles (px/s)
+    static const int OBS_FIRST_OBSTACLE = 5;        // Start of the obstacle slots
+    static const int OBSTACLE_SLOTS = 3;            // Nearest obstacles reported
+    static const int OBSTACLE_FEATURES = 2;         // Distance from player's front edge to box, type id (-1 = empty)
+    static const int OBSERVATION_SIZE = OBS_FIRST_OBSTACLE + OBSTACLE_SLOTS * OBSTACLE_FEATURES;
+
+    static const float EMPTY_SLOT_DISTANCE;         // Distance reported for an empty obstacle slot
+    static const float DEATH_REWARD;                // Reward of the colliding step (other steps earn their duration)
+
+private:
+    double tickDuration;                        // Simulated seconds per step
+
+    // ===== Simulation State (index = environment) =====
+    std::vector<Player> players;
+    std::vector<ObstacleManager> obstacleManagers;
+    std::vector<double> gameTimes;              // Seconds into the current episode
+    std::vector<unsigned char> duckHeld;        // Duck key held after the previous step
+
+    // ===== Step Outputs =====
+    std::vector<float> observations;            // size() * OBSERVATION_SIZE
+    std::vector<float> rewards;                 // Reward of the last step
+    std::vector<unsigned char> dones;           // 1 once the episode ended (until reset)
+
+    uint64_t stepCount;                         // Environment steps simulated since construction
+
+public:
+    /**
+     * Constructor: Create environments (call reset() before the first step)
+     *
+     * @param size Number of environments
+     * @param tickRate Simulation steps per second (the game default is 120)
+     */
+    explicit BatchEnvironment(size_t size, double tickRate = 120.0);
+
+    /**
+     * Start a new episode in every environment
+     *
+     * @param seeds One obstacle seed per environment
+     * @return false if seeds.size() != size() (nothing is reset)
+     */
+    bool reset(const std::vector<uint32_t>& seeds);
+
+    /**
+     * Start a new episode in one environment (typically after it reported done)
+     *
+     * @param index Environment index
+     * @param seed Obstacle seed
+     */
+    void resetEnvironment(size_t index, uint32_t seed);
+
+    /**
+     * Apply one action per environment and simulate one tick
+     * Finished environments are skipped: they keep their last observation, reward 0 and done 1
+     *
+     * @param actions One action per environment
+     * @return false if actions.size() != size() (nothing is simulated)
+     */
+    bool step(const std::vector<Action>& actions);
+
+    // ===== Step Output Access =====
+
+    /**
+     * Get observations after the last reset or step
+     *
+     * @return size() * OBSERVATION_SIZE floats, one row per environment
+     */
+    const std::vector<float>& getObservations() const;
+
+    /**
+     * Get rewards of the last step
+     *
+     * @return One reward per environment
+     */
+    const std::vector<float>& getRewards() const;
+
+    /**
+     * Get episode end flags
+     *
+     * @return One flag per environment (1 = collided)
+     */
+    const std::vector<unsigned char>& getDones() const;
+
+    /**
+     * Get number of environments
+     *
+     * @return Batch size
+     */
+    size_t size() const;
+
+    /**
+     * Get number of environment steps simulated (finished environments not counted)
+     *
+     * @return Steps since construction
+     */
+    uint64_t getStepCount() const;
+
+private:
+    /**
+     * Turn an action into the key presses keyboard input would produce
+     *
+     * @param index Environment index
+     * @param action Action of this step
+     */
+    void applyAction(size_t index, Action action);
+
+    /**
+     * Write the observation row of one environment
+     *
+     * @param index Environment index
+     */
+    void writeObservation(size_t index);
+};
+
+#endif // BATCH_ENVIRONMENT_HPP
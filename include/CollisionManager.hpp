@@ -3,6 +3,7 @@
 
 #include <SFML/Graphics.hpp>
 #include <vector>
+#include "Aabb.hpp"
 
 // Forward declarations for our game classes
 class Player;
@@ -13,7 +14,7 @@ class ObstacleManager;
  * CollisionManager class: Static utility class for all collision detection in the game
  * 
  * Design Philosophy:
- * - Pure utility class with no state (all static methods)
+ * - Pure utility class with no game state (all static methods, only debug counters)
  * - Centralized collision logic for consistency and maintainability
  * - Extensible design to support various collision types in the future
  * - Performance-optimized algorithms for real-time game requirements
@@ -37,7 +38,8 @@ public:
         BODY_COLLISION,     // Only body collision box hit  
         TAIL_COLLISION,     // Only tail collision box hit
         MULTIPLE_COLLISION, // Multiple collision boxes hit
-        LEGACY_COLLISION    // Legacy single-box collision (for compatibility)
+        LEGACY_COLLISION,   // Legacy single-box collision (for compatibility)
+        PIXEL_COLLISION     // Opaque sprite pixels overlap (pixel narrow phase)
     };
     
     /**
@@ -50,6 +52,7 @@ public:
         sf::Vector2f collisionPoint;    // Point where collision happened
         sf::Vector2f normal;            // Normal vector at collision point
         double penetrationDepth;        // How deep objects are overlapping
+        size_t obstacleIndex;           // Index of the obstacle hit (ObstacleManager queries only)
         
         // Triple collision box specific information
         bool headHit;                   // Whether head box was hit
@@ -57,9 +60,23 @@ public:
         bool tailHit;                   // Whether tail box was hit
         
         CollisionInfo() : hasCollision(false), collisionType(CollisionType::NO_COLLISION),
-                         collisionPoint(0, 0), normal(0, 0), penetrationDepth(0),
+                         collisionPoint(0, 0), normal(0, 0), penetrationDepth(0), obstacleIndex(0),
                          headHit(false), bodyHit(false), tailHit(false) {}
     };
+    
+    /**
+     * Counters for the player/obstacle broad phase
+     * Lets stress runs confirm that narrow-phase work stays constant per query
+     * no matter how many obstacles are alive
+     */
+    struct BroadPhaseStats {
+        size_t queries;                 // Player/obstacle collision queries
+        size_t candidates;              // Obstacles that survived the broad phase
+        size_t narrowPhaseTests;        // Player box vs obstacle box tests performed
+        size_t maxCandidatesPerQuery;   // Largest candidate set seen in one query
+        
+        BroadPhaseStats() : queries(0), candidates(0), narrowPhaseTests(0), maxCandidatesPerQuery(0) {}
+    };
 
     // ===== Basic Collision Detection Methods =====
     
@@ -96,6 +113,49 @@ public:
      */
     static bool checkPlayerObstacleCollisionTriple(const Player& player, const ObstacleManager& obstacleManager);
     
+    /**
+     * Same check, optionally reporting details of the first obstacle hit
+     * Boxes are tested in batches on the Aabb fast path; CollisionInfo (normal,
+     * penetration, hit boxes) is only computed when info is not null
+     * 
+     * @param player The player object to check
+     * @param obstacleManager The obstacle manager containing all obstacles
+     * @param info Receives collision details on hit (may be nullptr)
+     * @return true if player collides with any obstacle, false otherwise
+     */
+    static bool checkPlayerObstacleCollisionTriple(const Player& player, const ObstacleManager& obstacleManager,
+                                                   CollisionInfo* info);
+    
+    /**
+     * Pixel-accurate check: sprite bounds as the broad phase, then one AND of
+     * the packed alpha masks per candidate (TextureManager collision masks)
+     * Obstacles without a mask are tested with their boxes; without a player
+     * mask (headless, fallback textures) this is checkPlayerObstacleCollisionTriple
+     * 
+     * @param player The player object to check
+     * @param obstacleManager The obstacle manager containing all obstacles
+     * @param info Receives collision details on hit (may be nullptr)
+     * @return true if player collides with any obstacle, false otherwise
+     */
+    static bool checkPlayerObstacleCollisionPixel(const Player& player, const ObstacleManager& obstacleManager,
+                                                  CollisionInfo* info = nullptr);
+    
+    /**
+     * Batch kernel: test the three player boxes against N obstacle boxes
+     * Obstacle edges are passed as separate float lanes so they can be compared
+     * four at a time (SSE2 / NEON), with a scalar loop for the remainder
+     * 
+     * @param playerBoxes Head, body and tail boxes
+     * @param left Obstacle left edges
+     * @param top Obstacle top edges
+     * @param right Obstacle right edges
+     * @param bottom Obstacle bottom edges
+     * @param count Number of obstacle boxes
+     * @return Index of the first obstacle overlapping any player box, or -1
+     */
+    static int findFirstHit(const Aabb playerBoxes[3], const float* left, const float* top,
+                            const float* right, const float* bottom, size_t count);
+    
     /**
      * Check collision between player and a single obstacle using triple collision system
      * Provides detailed collision information about which boxes were hit
@@ -149,6 +209,16 @@ public:
      */
     static CollisionInfo getDetailedCollision(const sf::RectangleShape& rect1, const sf::RectangleShape& rect2);
     
+    /**
+     * Get detailed collision information between two bounding rectangles
+     * Same as above for callers that already have world-space bounds
+     * 
+     * @param bounds1 First rectangle bounds
+     * @param bounds2 Second rectangle bounds
+     * @return CollisionInfo structure with detailed collision data
+     */
+    static CollisionInfo getDetailedCollision(const sf::FloatRect& bounds1, const sf::FloatRect& bounds2);
+    
     // ===== Utility Methods for Triple Collision System =====
     
     /**
@@ -198,7 +268,43 @@ public:
     static bool checkCircleCircleCollision(const sf::Vector2f& center1, double radius1,
                                          const sf::Vector2f& center2, double radius2);
     
+    // ===== Broad Phase Instrumentation =====
+    
+    /**
+     * Get broad phase counters accumulated since the last reset
+     * Counters are per thread (tools run many simulations in parallel)
+     * 
+     * @return Reference to the current counters
+     */
+    static const BroadPhaseStats& getBroadPhaseStats();
+    
+    /**
+     * Reset broad phase counters to zero
+     */
+    static void resetBroadPhaseStats();
+    
 private:
+    static thread_local BroadPhaseStats broadPhaseStats;   // Debug counters (the only static data, one set per thread)
+    
+    /**
+     * Get the x range covered by all three player collision boxes
+     * 
+     * @param player The player object
+     * @param minX Receives left-most edge
+     * @param maxX Receives right-most edge
+     */
+    static void getPlayerExtentX(const Aabb playerBoxes[3], float& minX, float& maxX);
+    
+    /**
+     * Scalar overlap test of the three player boxes against one obstacle box
+     * Used for the lanes left over after the SIMD batches
+     * 
+     * @param playerBoxes Head, body and tail boxes
+     * @param obstacleBox Obstacle collision box
+     * @return true if any player box overlaps the obstacle
+     */
+    static bool anyBoxHit(const Aabb playerBoxes[3], const Aabb& obstacleBox);
+
     // ===== Private Helper Methods =====
     
     /**
@@ -220,6 +326,26 @@ private:
      * @return true if point is inside rectangle
      */
     static bool isPointInsideRectangle(const sf::Vector2f& point, const sf::RectangleShape& rectangle);
+    
+    /**
+     * Triple collision test between player and one obstacle collision box
+     * Shared by the Obstacle-based API and the ObstacleManager array path
+     * 
+     * @param player The player object
+     * @param obstacleBounds World-space collision box of the obstacle
+     * @return CollisionInfo with detailed collision data
+     */
+    static CollisionInfo checkPlayerBoundsTriple(const Player& player, const sf::FloatRect& obstacleBounds);
+    
+    /**
+     * Full triple collision details for boxes already in Aabb form
+     * Only run once a hit is known (or for callers that need every field)
+     * 
+     * @param playerBoxes Head, body and tail boxes
+     * @param obstacleBox Obstacle collision box
+     * @return CollisionInfo with detailed collision data
+     */
+    static CollisionInfo buildTripleCollisionInfo(const Aabb playerBoxes[3], const Aabb& obstacleBox);
 
     /**
      * Helper method to determine collision type from individual box hits
@@ -0,0 +1,121 @@
+#ifndef COLLISION_MASK_HPP
+#define COLLISION_MASK_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+/**
+ * CollisionMask class: 1-bit opacity mask of a sprite, packed 64 columns per word
+ *
+ * Design Philosophy:
+ * - Built once at load time from decoded pixels, never from sf::Texture at runtime
+ * - Rows are stored as consecutive 64-bit words (bit 0 = leftmost column), wide
+ *   sprites simply use more than one word per row
+ * - Overlap tests AND whole words of the intersecting rows, so the exact test
+ *   costs a handful of instructions per row instead of one lookup per pixel
+ */
+class CollisionMask {
+public:
+    static const int WORD_BITS = 64;                    // Columns per packed word
+    static const sf::Uint8 DEFAULT_ALPHA_THRESHOLD = 128;  // Pixels at or above this alpha are solid
+
+private:
+    int width;                      // Columns
+    int height;                     // Rows
+    int wordsPerRow;                // ceil(width / WORD_BITS)
+    std::vector<uint64_t> words;    // height * wordsPerRow, row-major (bits past width are 0)
+
+public:
+    /**
+     * Constructor: Create an empty mask (no pixels, overlaps nothing)
+     */
+    CollisionMask();
+
+    /**
+     * Constructor: Create a fully transparent mask
+     *
+     * @param width Columns
+     * @param height Rows
+     */
+    CollisionMask(int width, int height);
+
+    /**
+     * Build a mask from RGBA8 pixels (sf::Image layout)
+     *
+     * @param pixels width * height * 4 bytes
+     * @param width Image width
+     * @param height Image height
+     * @param alphaThreshold Smallest alpha counted as solid
+     * @return Mask of the whole image
+     */
+    static CollisionMask fromPixels(const sf::Uint8* pixels, unsigned int width, unsigned int height,
+                                    sf::Uint8 alphaThreshold = DEFAULT_ALPHA_THRESHOLD);
+
+    /**
+     * Cut an area out of this mask and scale it (nearest neighbour)
+     * Used to match a sprite rectangle to the size the sprite is drawn at;
+     * parts of the area outside this mask are transparent
+     *
+     * @param area Source area in this mask
+     * @param newWidth Columns of the result
+     * @param newHeight Rows of the result
+     * @return Resampled mask
+     */
+    CollisionMask resampled(const sf::IntRect& area, int newWidth, int newHeight) const;
+
+    /**
+     * Check whether solid pixels of two masks overlap
+     *
+     * @param a First mask
+     * @param ax Left edge of a (integer pixels)
+     * @param ay Top edge of a
+     * @param b Second mask
+     * @param bx Left edge of b
+     * @param by Top edge of b
+     * @return true if any solid pixel is set in both masks at the same position
+     */
+    static bool overlaps(const CollisionMask& a, int ax, int ay, const CollisionMask& b, int bx, int by);
+
+    // ===== Pixel Access =====
+
+    /**
+     * Check a single pixel (out of range counts as transparent)
+     *
+     * @param x Column
+     * @param y Row
+     * @return true if the pixel is solid
+     */
+    bool isSolid(int x, int y) const;
+
+    /**
+     * Mark a single pixel solid (out of range is ignored)
+     *
+     * @param x Column
+     * @param y Row
+     */
+    void setSolid(int x, int y);
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+
+    /**
+     * Check if the mask has no pixels at all
+     *
+     * @return true for a default constructed or zero sized mask
+     */
+    bool isEmpty() const { return width <= 0 || height <= 0; }
+
+private:
+    /**
+     * Read WORD_BITS columns of one row starting at any column
+     * Columns past the right edge read as 0
+     *
+     * @param row Row index (must be in range)
+     * @param column First column (must not be negative)
+     * @return Bits of columns [column, column + WORD_BITS), bit 0 = column
+     */
+    uint64_t extractBits(int row, int column) const;
+};
+
+#endif // COLLISION_MASK_HPP
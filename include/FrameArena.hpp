@@ -0,0 +1,138 @@
+#ifndef FRAME_ARENA_HPP
+#define FRAME_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * FrameArena class: Bump allocator for scratch memory that lives for one frame
+ *
+ * Design Philosophy:
+ * - One block is allocated up front; allocate() only advances an offset and
+ *   reset() rewinds it, so temporary containers cost no heap calls in steady state
+ * - Nothing is freed individually: memory handed out is valid until the next reset()
+ * - A frame that outgrows the block still works (extra blocks come from the heap);
+ *   the next reset() grows the main block so the following frames fit again
+ * - Single-threaded: the game thread owns its arena
+ *
+ * Used through ArenaAllocator / ArenaVector for locals that die within the frame.
+ */
+class FrameArena {
+public:
+    static const size_t DEFAULT_CAPACITY = 64 * 1024;   // Bytes in the main block
+
+private:
+    std::unique_ptr<unsigned char[]> block;
+    size_t capacity;                // Size of the main block
+    size_t used;                    // Bytes handed out from the main block this frame
+    size_t overflowBytes;           // Bytes handed out from overflow blocks this frame
+    size_t highWater;               // Most bytes used in one frame since construction
+    uint64_t overflowCount;         // Frames that needed overflow blocks
+    std::vector<std::unique_ptr<unsigned char[]>> overflowBlocks;
+
+public:
+    /**
+     * Constructor: Allocate the main block
+     *
+     * @param initialCapacity Bytes in the main block
+     */
+    explicit FrameArena(size_t initialCapacity = DEFAULT_CAPACITY);
+
+    /**
+     * Hand out memory valid until the next reset()
+     *
+     * @param size Bytes needed
+     * @param alignment Required alignment (power of 2)
+     * @return Pointer to uninitialized memory
+     */
+    void* allocate(size_t size, size_t alignment);
+
+    /**
+     * Start a new frame: every earlier allocation becomes invalid
+     * Grows the main block first if the frame just ended overflowed it
+     */
+    void reset();
+
+    // ===== Statistics =====
+
+    /**
+     * Get bytes handed out since the last reset
+     *
+     * @return Bytes (main block plus overflow)
+     */
+    size_t getUsed() const;
+
+    /**
+     * Get size of the main block
+     *
+     * @return Bytes
+     */
+    size_t getCapacity() const;
+
+    /**
+     * Get most bytes used by one frame
+     *
+     * @return Bytes
+     */
+    size_t getHighWater() const;
+
+    /**
+     * Get number of frames that did not fit the main block
+     *
+     * @return Overflowed frames (stays 0 once the block has grown to fit)
+     */
+    uint64_t getOverflowCount() const;
+};
+
+/**
+ * ArenaAllocator class: Standard allocator that takes memory from a FrameArena
+ *
+ * Without an arena (nullptr) it falls back to the heap, so code shared with the
+ * tools and benchmarks works whether or not a frame arena was attached.
+ * deallocate() is a no-op for arena memory: the arena reclaims it at reset().
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    typedef T value_type;
+
+    FrameArena* arena;      // Source of the memory (nullptr = heap)
+
+    ArenaAllocator(FrameArena* sourceArena = nullptr) noexcept : arena(sourceArena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+    T* allocate(size_t count) {
+        if (!arena) {
+            return static_cast<T*>(::operator new(count * sizeof(T)));
+        }
+        return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* pointer, size_t) noexcept {
+        if (!arena) {
+            ::operator delete(pointer);
+        }
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return arena == other.arena;
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept {
+        return arena != other.arena;
+    }
+};
+
+/**
+ * Vector whose storage comes from a FrameArena (must not outlive the frame)
+ */
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+#endif // FRAME_ARENA_HPP
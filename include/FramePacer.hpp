@@ -0,0 +1,177 @@
+#ifndef FRAME_PACER_HPP
+#define FRAME_PACER_HPP
+
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <string>
+
+/**
+ * FramePacer class: Decides how a frame waits for the next one and records how long frames took
+ *
+ * Design Philosophy:
+ * - Exactly one pacing source per mode: vsync and SFML's frame limit are never
+ *   combined (SFML warns against it, and together they jitter on high refresh monitors)
+ * - The sleep + spin limiter sleeps until shortly before the deadline and spins
+ *   the rest, since OS sleeps overshoot by a millisecond or more
+ * - Deadlines advance by whole periods, so one late frame does not shift every later one
+ * - Frame intervals go into a fixed-bucket histogram (no allocation per frame);
+ *   percentiles are read from the buckets only when someone asks
+ *
+ * endFrame() must be called from the thread that owns the window's GL context.
+ */
+class FramePacer {
+public:
+    /**
+     * Pacing policies
+     */
+    enum class Mode {
+        VSYNC,              // Driver vsync only (default)
+        SLEEP_SPIN,         // Own limiter at the target rate, vsync off
+        UNCAPPED,           // No waiting at all (latency / throughput measurements)
+        LOW_POWER,          // Vsync while playing, LOW_POWER_FPS while idle (game over)
+        COUNT               // Number of modes (not a real mode)
+    };
+
+    /**
+     * Frame interval statistics since the last resetStats() (milliseconds)
+     * Idle frames (low power) are counted but kept out of the histogram,
+     * so the percentiles describe gameplay pacing only
+     */
+    struct Stats {
+        unsigned long long frames;              // Frames in the histogram
+        unsigned long long idleFrames;          // Low power frames (not in the histogram)
+        unsigned long long missedDeadlines;     // Frames longer than MISS_TOLERANCE target periods
+        double avgMs;
+        double p50Ms;
+        double p95Ms;
+        double p99Ms;
+        double maxMs;
+
+        Stats() : frames(0), idleFrames(0), missedDeadlines(0),
+                  avgMs(0.0), p50Ms(0.0), p95Ms(0.0), p99Ms(0.0), maxMs(0.0) {}
+    };
+
+    static const int LOW_POWER_FPS = 20;     // Idle frame rate (stays within Game's catch-up cap)
+    static const int BUCKET_COUNT = 400;     // Histogram buckets below the overflow bucket
+    static const double BUCKET_MS;           // Width of one bucket
+    static const double SPIN_MARGIN;         // Seconds before the deadline the limiter stops sleeping
+    static const double MISS_TOLERANCE;      // Interval / target period above which a frame missed
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    // ===== Configuration =====
+    Mode mode;
+    int targetFps;                      // Rate the limiter paces to and deadlines are checked against
+    double targetPeriod;                // 1 / targetFps
+    bool lowPowerActive;                // Low power mode currently idling (vsync switched off)
+
+    // ===== Timing =====
+    Clock::time_point nextDeadline;     // When the limiter lets the next frame start
+    Clock::time_point lastFrameEnd;     // End of the previous endFrame()
+
+    // ===== Histogram =====
+    unsigned long long buckets[BUCKET_COUNT + 1];   // Last bucket collects everything above the range
+    unsigned long long idleFrames;
+    unsigned long long missedDeadlines;
+    double totalSeconds;                // Sum of recorded intervals (average)
+    double maxSeconds;                  // Longest recorded interval (overflow bucket has no upper edge)
+
+public:
+    /**
+     * Constructor: Vsync mode at 60 fps, empty histogram
+     */
+    FramePacer();
+
+    /**
+     * Apply a pacing mode to a window (sets vsync and disables SFML's frame limit)
+     *
+     * @param window Window to pace
+     * @param pacingMode Policy to use
+     * @param framesPerSecond Target rate for the limiter and for missed-deadline checks
+     */
+    void configure(sf::RenderWindow& window, Mode pacingMode, int framesPerSecond);
+
+    /**
+     * Finish a frame right after window.display(): wait as the mode requires, then record the interval
+     *
+     * @param window Paced window (low power mode toggles its vsync)
+     * @param idle true while nothing moves on screen (GAME_OVER); only low power mode uses it
+     */
+    void endFrame(sf::RenderWindow& window, bool idle);
+
+    // ===== Statistics =====
+
+    /**
+     * Clear the histogram and counters (e.g. after the loading screen)
+     */
+    void resetStats();
+
+    /**
+     * Compute statistics from the histogram
+     *
+     * @return Statistics (all zero before the first frame)
+     */
+    Stats getStats() const;
+
+    /**
+     * Build a one-line summary for the overlay and the exit log
+     *
+     * @return Formatted summary
+     */
+    std::string formatSummary() const;
+
+    /**
+     * Get the active mode
+     *
+     * @return Current pacing mode
+     */
+    Mode getMode() const {
+        return mode;
+    }
+
+    // ===== Mode Names =====
+
+    /**
+     * Get the command line name of a mode
+     *
+     * @param pacingMode Mode to name
+     * @return Name ("vsync", "sleep-spin", "uncapped", "low-power")
+     */
+    static const char* getModeName(Mode pacingMode);
+
+    /**
+     * Look up a mode by its command line name
+     *
+     * @param name Name as returned by getModeName()
+     * @param pacingMode Receives the mode if the name is known
+     * @return true if the name was recognized
+     */
+    static bool parseMode(const std::string& name, Mode& pacingMode);
+
+private:
+    /**
+     * Sleep, then spin, until a point in time
+     *
+     * @param deadline Time to return at
+     */
+    static void waitUntil(Clock::time_point deadline);
+
+    /**
+     * Add one frame interval to the histogram
+     *
+     * @param seconds Interval since the previous frame
+     */
+    void recordFrame(double seconds);
+
+    /**
+     * Read a percentile from the histogram
+     *
+     * @param fraction Percentile as a fraction (0.99 = p99)
+     * @param frames Frames in the histogram
+     * @return Upper edge of the bucket holding the percentile (ms)
+     */
+    double percentileMs(double fraction, unsigned long long frames) const;
+};
+
+#endif // FRAME_PACER_HPP
@@ -0,0 +1,214 @@
+#ifndef FRAME_PROFILER_HPP
+#define FRAME_PROFILER_HPP
+
+#include <chrono>
+#include <fstream>
+#include <string>
+
+/**
+ * FrameProfiler class: Per-phase frame timing with rolling statistics
+ *
+ * Design Philosophy:
+ * - Scoped timers around each hot phase, accumulated per frame
+ *   (fixed-step ticks can run Player::update several times in one frame)
+ * - Fixed-size history of the last HISTORY_SIZE frames, no allocation per frame
+ * - Rolling min/avg/p99 computed only when someone asks (overlay refresh)
+ * - Optional per-frame CSV dump for offline analysis of spikes
+ */
+class FrameProfiler {
+public:
+    /**
+     * Frame phases that are timed
+     */
+    enum class Phase : unsigned char {
+        HANDLE_EVENTS,      // Game::handleEvents
+        PLAYER_UPDATE,      // Player::update
+        OBSTACLE_UPDATE,    // ObstacleManager::update
+        CHECK_COLLISIONS,   // Game::checkCollisions
+        RENDER_GAME_WORLD,  // Game::renderGameWorld
+        RENDER_UI,          // Game::renderUI
+        DISPLAY,            // window.display (includes vsync / frame limit wait)
+        COUNT               // Number of phases (not a real phase)
+    };
+
+    static const int PHASE_COUNT = static_cast<int>(Phase::COUNT);
+    static const int HISTORY_SIZE = 240;   // Frames kept for rolling statistics
+
+    /**
+     * Rolling statistics of one phase over the history window (milliseconds)
+     */
+    struct PhaseStats {
+        double minMs;
+        double avgMs;
+        double p99Ms;
+        double lastMs;      // Most recent complete frame
+
+        PhaseStats() : minMs(0.0), avgMs(0.0), p99Ms(0.0), lastMs(0.0) {}
+    };
+
+    /**
+     * RAII timer: adds the time between construction and destruction to a phase
+     * Does not read the clock at all while the profiler is disabled
+     */
+    class ScopedTimer {
+    private:
+        FrameProfiler& profiler;
+        Phase phase;
+        bool active;
+        std::chrono::steady_clock::time_point start;
+
+    public:
+        ScopedTimer(FrameProfiler& profiler, Phase phase)
+            : profiler(profiler), phase(phase), active(profiler.isEnabled()) {
+            if (active) {
+                start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~ScopedTimer() {
+            if (active) {
+                std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+                profiler.addSample(phase, elapsed.count());
+            }
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+    };
+
+private:
+    // ===== Timing Data =====
+    double currentFrame[PHASE_COUNT];                   // Seconds accumulated this frame
+    double history[HISTORY_SIZE][PHASE_COUNT];          // Completed frames (ring)
+    double frameHistory[HISTORY_SIZE];                  // Total frame time per completed frame
+    int historyHead;                                    // Next slot to write
+    int historyCount;                                   // Valid frames in history
+    unsigned long long frameIndex;                      // Frames completed since start
+    std::chrono::steady_clock::time_point frameStart;   // beginFrame() time
+    bool enabled;                                       // Collect samples at all
+
+    // ===== CSV Export =====
+    std::ofstream csvFile;
+
+public:
+    /**
+     * Constructor: Empty history, collection enabled
+     */
+    FrameProfiler();
+
+    // ===== Frame Boundaries =====
+
+    /**
+     * Mark the start of a frame and clear the per-frame accumulators
+     */
+    void beginFrame();
+
+    /**
+     * Mark the end of a frame: push it into the history and the CSV file
+     */
+    void endFrame();
+
+    /**
+     * Add elapsed time to a phase of the current frame
+     *
+     * @param phase Phase the time belongs to
+     * @param seconds Elapsed time in seconds
+     */
+    void addSample(Phase phase, double seconds) {
+        if (enabled) {
+            currentFrame[static_cast<int>(phase)] += seconds;
+        }
+    }
+
+    // ===== Statistics =====
+
+    /**
+     * Compute rolling statistics of one phase over the history window
+     *
+     * @param phase Phase to summarize
+     * @return Statistics in milliseconds (all zero before the first frame)
+     */
+    PhaseStats getPhaseStats(Phase phase) const;
+
+    /**
+     * Compute rolling statistics of the whole frame time
+     *
+     * @return Statistics in milliseconds
+     */
+    PhaseStats getFrameStats() const;
+
+    /**
+     * Build a multi-line text summary (one line per phase) for the overlay
+     *
+     * @return Formatted summary
+     */
+    std::string formatSummary() const;
+
+    /**
+     * Get display name of a phase
+     *
+     * @param phase Phase to name
+     * @return Short name used in overlay and CSV header
+     */
+    static const char* getPhaseName(Phase phase);
+
+    // ===== Configuration =====
+
+    /**
+     * Enable or disable sample collection
+     *
+     * @param isEnabled true to collect samples
+     */
+    void setEnabled(bool isEnabled);
+
+    /**
+     * Check whether samples are collected
+     *
+     * @return true if enabled
+     */
+    bool isEnabled() const {
+        return enabled;
+    }
+
+    // ===== CSV Export =====
+
+    /**
+     * Start writing one CSV row per frame (milliseconds per phase)
+     *
+     * @param path Output file path (overwritten)
+     * @return true if the file was opened
+     */
+    bool startCsvDump(const std::string& path);
+
+    /**
+     * Stop the CSV dump and close the file
+     */
+    void stopCsvDump();
+
+    /**
+     * Check whether a CSV dump is in progress
+     *
+     * @return true if frames are being written to disk
+     */
+    bool isCsvDumpActive() const;
+
+private:
+    /**
+     * Summarize a set of samples (seconds) into millisecond statistics
+     *
+     * @param samples Sample values, ordered oldest to newest
+     * @param count Number of samples
+     * @return Min/avg/p99/last in milliseconds
+     */
+    static PhaseStats computeStats(const double* samples, int count);
+
+    /**
+     * Copy one history column into chronological order
+     *
+     * @param phaseIndex Phase column, or -1 for total frame time
+     * @param out Receives historyCount values
+     */
+    void collectSamples(int phaseIndex, double* out) const;
+};
+
+#endif // FRAME_PROFILER_HPP
@@ -3,15 +3,37 @@
 
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 #include <sstream>
 #include <iomanip>
+#include "FrameArena.hpp"
+#include "FrameProfiler.hpp"
+#include "FramePacer.hpp"
+#include "HudCounter.hpp"
+#include "ParallaxBackground.hpp"
+#include "AudioSystem.hpp"
+#include "Replay.hpp"
+#include "SpriteBatch.hpp"
+#include "TripleBuffer.hpp"
+#include "RenderSnapshot.hpp"
+#include "StateStream.hpp"
+#include "GhostRenderer.hpp"
+#include "SnapshotRing.hpp"
 
 // Forward declarations for our game systems
 class Player;
 class ObstacleManager;
 class CollisionManager;
 class TextureManager;
+class AutoPilot;
+class AssetBundle;
+class ResourceLoader;
+class ScoreJournal;
 
 /**
  * Game class: The ultimate orchestrator of the entire game system
@@ -46,15 +68,109 @@ public:
         SETTINGS     // Configuration screen (future expansion)
     };
 
+    /**
+     * Startup options for a Game instance
+     * Headless mode skips window, audio and texture setup and drives the
+     * simulation as fast as the CPU allows (automated sessions, build boxes)
+     */
+    struct Options {
+        bool headless;               // Run without window, audio and textures
+        double headlessDuration;     // Simulated seconds to run in headless mode
+        double tickRate;             // Fixed simulation steps per second
+        int maxCatchUpSteps;         // Maximum simulation steps run in a single frame
+        unsigned int seed;           // Obstacle random seed (0 = random each run)
+        bool autopilot;              // Let AutoPilot play instead of keyboard input
+        bool pixelCollision;         // Confirm hits on the sprite masks (needs textures, ignored headless)
+        bool threadedRender;         // Draw on a separate thread from published snapshots (ignored headless)
+        FramePacer::Mode pacing;     // How frames wait for the next one
+        int targetFps;               // Pacing target (limiter rate, missed-deadline threshold)
+        std::string assetBundlePath; // Packed asset file (empty = AssetBundle::DEFAULT_PATH)
+        bool journal;                // Append finished runs to the score journal (never headless or during replays)
+        std::string journalPath;     // Score journal file (empty = ScoreJournal::DEFAULT_PATH)
+        std::string recordPath;      // Write a replay of this run here (empty = no recording)
+        std::string stateStreamPath; // Write the state stream of this run here (empty = no stream)
+        std::vector<std::string> ghostPaths; // State streams replayed as ghosts (windowed only)
+        std::string replayPath;      // Play this replay instead of taking input (overrides seed, tick rate, autopilot)
+        long long seekTick;          // With replayPath: fast-forward to this tick (headless: stop there), -1 = off
+
+        Options() : headless(false), headlessDuration(DEFAULT_HEADLESS_DURATION),
+                    tickRate(DEFAULT_TICK_RATE), maxCatchUpSteps(DEFAULT_MAX_CATCH_UP_STEPS),
+                    seed(0), autopilot(false), pixelCollision(false), threadedRender(false),
+                    pacing(FramePacer::Mode::VSYNC), targetFps(TARGET_FPS), journal(true), seekTick(-1) {}
+    };
+
+    /**
+     * Results of the last headless run (for benchmarks and automated sessions)
+     */
+    struct HeadlessReport {
+        double simulatedSeconds;     // Simulated time covered
+        double wallSeconds;          // Real time spent
+        long long ticks;             // Simulation steps run
+        int sessions;                // Sessions played (restarts after game over + 1)
+        int highScore;               // Best score over all sessions
+        int jumps;                   // Jumps issued by the autopilot
+        long long steadyTicks;       // Ticks counted as steady-state play (see STEADY_STATE_WARMUP)
+        unsigned long long steadyAllocations; // Heap allocations during those ticks (0 unless built with DINO_TRACK_ALLOCATIONS)
+
+        HeadlessReport() : simulatedSeconds(0.0), wallSeconds(0.0), ticks(0),
+                           sessions(0), highScore(0), jumps(0), steadyTicks(0), steadyAllocations(0) {}
+    };
+
 private:
+    // ===== Configuration Constants =====
+    static const int WINDOW_WIDTH;    // Game window dimensions
+    static const int WINDOW_HEIGHT;
+    static const int TARGET_FPS;      // Target frame rate for consistent gameplay
+    static const std::string WINDOW_TITLE;  // Game window title
+    static const double DEFAULT_HEADLESS_DURATION;  // Default simulated seconds for headless runs
+    static const double DEFAULT_TICK_RATE;          // Default fixed simulation rate (ticks per second)
+    static const int DEFAULT_MAX_CATCH_UP_STEPS;    // Default cap on catch-up steps per frame
+    static const double PROFILER_OVERLAY_REFRESH;   // Seconds between profiler overlay text updates
+    static const std::string PROFILER_CSV_PATH;     // File written by the per-frame CSV dump
+    static const int SCORE_MILESTONE_INTERVAL;      // Score points between milestone sounds
+    static const double STEADY_STATE_WARMUP;        // Game time into a run before its ticks count as steady state
+    static const int SNAPSHOT_CAPACITY;             // Newest ticks kept in the snapshot ring
+    static const int CHECKPOINT_CAPACITY;           // Replay checkpoints kept for seeking
+    static const double REWIND_SECONDS;             // Game time a practice rewind goes back
+    static const double CHECKPOINT_INTERVAL;        // Simulated seconds between replay checkpoints
+    static const double SEEK_STEP_SECONDS;          // Replay time skipped by one Left/Right press
+
+    // ===== Startup Configuration =====
+    Options options;                  // Options this game was created with
+
     // ===== Core Engine Layer =====
     sf::RenderWindow window;           // The main game window
     sf::Clock frameClock;             // For consistent frame timing
     sf::Event currentEvent;           // Current SFML event being processed
     
+    // ===== Fixed Timestep Layer =====
+    double tickDuration;              // Length of one simulation step (1 / tickRate)
+    double tickAccumulator;           // Real time not yet consumed by simulation steps
+    double interpolationAlpha;        // Render blend factor between last two simulation states
+    long long simulationTick;         // Ticks simulated since start (replay time base)
+    long long runTick;                // Ticks since this run started (ghost time base, goes back with rewinds)
+    
     // ===== Game Systems Layer =====
     std::unique_ptr<Player> player;              // Smart pointer for automatic memory management
     std::unique_ptr<ObstacleManager> obstacleManager;  // Managed obstacle system
+    std::unique_ptr<AutoPilot> autoPilot;        // Scripted input (only with Options::autopilot)
+    HeadlessReport headlessReport;               // Filled by runHeadless()
+    std::unique_ptr<Replay> recording;           // Inputs of this run (only with Options::recordPath)
+    std::unique_ptr<Replay> playback;            // Replay being played (released once it finished)
+    std::unique_ptr<StateStream> stateStream;    // Per-tick state of this run (only with Options::stateStreamPath)
+    GhostRenderer ghosts;                        // Ghost runs drawn behind the player (only with Options::ghostPaths)
+    std::unique_ptr<ScoreJournal> scoreJournal;  // Persistent run history (only with Options::journal, windowed)
+    ParallaxBackground background;               // Scenery layers (draws nothing until initialized, never in headless mode)
+    FrameArena frameArena;                       // Scratch memory of one frame (reset at the top of every loop iteration)
+    uint64_t lastFrameAllocations;               // Game thread heap allocations in the last frame (DINO_TRACK_ALLOCATIONS)
+    
+    // ===== Simulation Snapshots =====
+    SnapshotRing snapshotRing;                   // State after each of the newest ticks of play (rewind, seeking)
+    std::unique_ptr<SnapshotRing> replayCheckpoints;  // State every CHECKPOINT_INTERVAL (only with a replay, for seeking)
+    SimulationSnapshot sessionStart;             // State right after startup (restart, seeking to tick 0)
+    long long rewindTicks;                       // Ticks a rewind goes back (REWIND_SECONDS, within the ring)
+    long long checkpointTicks;                   // Ticks between replay checkpoints
+    bool runRewound;                             // This run was rewound (practice: no high score, not journaled)
     
     // ===== State Management Layer =====
     GameState currentState;           // Current game state
@@ -64,41 +180,54 @@ private:
     double gameTime;                  // Total elapsed game time
     int currentScore;                 // Player's current score
     int highScore;                    // Session's highest score
+    int sessionCount;                 // Sessions started (restarts + 1)
+    double runPeakSpeed;              // Fastest obstacle speed this run (journaled at game over)
     bool isRunning;                   // Master control flag for game loop
     
     // ===== Resource Management Layer =====
+    std::unique_ptr<AssetBundle> assetBundle;   // Mapped asset file (declared before gameFont: the font reads from it)
     sf::Font gameFont;                // Main font for all text rendering
     bool fontLoaded;                  // Font loading status flag
 
     // ===== Sound System =====
-    sf::SoundBuffer jumpSoundBuffer;       // jump sound buffer
-    sf::SoundBuffer gameOverSoundBuffer;   // Game over sound buffer
-    sf::SoundBuffer scoreSoundBuffer;      // scoresound buffer
+    AudioSystem audioSystem;               // Effect voices; gameplay only enqueues effect ids
+    int lastScoreMilestone;                // Milestones already reached this run (score / SCORE_MILESTONE_INTERVAL)
     
-    sf::Sound jumpSound;                   // jump sound object
-    sf::Sound gameOverSound;               // Game over sound object
-    sf::Sound scoreSound;                  // Score sound object
+    // ===== Asynchronous Loading =====
+    std::unique_ptr<ResourceLoader> resourceLoader;        // Startup tasks (released once everything finished)
+    std::chrono::steady_clock::time_point loadingStart;    // When resource loading began
     
     // ===== UI Text Elements =====
     sf::Text gameOverText;            // Game over message
-    sf::Text scoreText;               // Current score display
-    sf::Text highScoreText;           // High score display
+    HudCounter scoreCounter;          // Current score display
+    HudCounter highScoreCounter;      // High score display
     sf::Text instructionText;         // Control instructions
     
-    // ===== Configuration Constants =====
-    static const int WINDOW_WIDTH;    // Game window dimensions
-    static const int WINDOW_HEIGHT;
-    static const int TARGET_FPS;      // Target frame rate for consistent gameplay
-    static const std::string WINDOW_TITLE;  // Game window title
+    // ===== Profiling =====
+    FrameProfiler frameProfiler;      // Per-phase frame timings
+    bool showProfilerOverlay;         // Profiler overlay visible (P key)
+    double profilerOverlayTimer;      // Time since the overlay text was rebuilt
+    sf::Text profilerText;            // Profiler overlay text
+    FramePacer framePacer;            // Frame waiting policy and frame-time histogram
+    
+    // ===== Threaded Rendering (Options::threadedRender) =====
+    TripleBuffer<RenderSnapshot> renderSnapshots;  // Newest simulation state, main thread -> render thread
+    std::thread renderThread;                      // Owns the window's GL context while running
+    std::atomic<bool> renderThreadActive;          // Cleared by the main thread to stop the render thread
+    SpriteBatch snapshotPlayerBatch;               // Render thread's batches (Player/ObstacleManager
+    SpriteBatch snapshotObstacleBatch;             // keep their own for the single-threaded loop)
 
 public:
     // ===== Core Lifecycle Methods =====
     
     /**
-     * Constructor: Initialize the Game with default settings
+     * Constructor: Initialize the Game with the given options
      * Sets up the window, initializes all systems, loads resources
+     * In headless mode only the simulation systems are created
+     * 
+     * @param options Startup options (defaults to a normal windowed game)
      */
-    Game();
+    explicit Game(const Options& options = Options());
     
     /**
      * Destructor: Clean up all resources and systems
@@ -116,8 +245,64 @@ public:
      * @return int Exit code (0 for normal termination)
      */
     int run();
+    
+    /**
+     * Get results of the last headless run
+     * 
+     * @return Report (all zero if no headless run has finished)
+     */
+    const HeadlessReport& getHeadlessReport() const;
+    
+    /**
+     * Get formatted string representation of a score
+     * Provides consistent score formatting across the game
+     * Scores above HudCounter::MAX_VALUE are clamped, as on the HUD
+     * 
+     * @param score The score value to format
+     * @return Formatted score string (e.g., "000123")
+     */
+    static std::string formatScore(int score);
 
 private:
+    /**
+     * Headless game loop: steps the simulation with a fixed time step and
+     * no rendering until the configured simulated duration has elapsed
+     * Restarts automatically after each game over and reports throughput at exit
+     * With a replay: runs it to its end (or Options::seekTick) without auto restarts
+     * 
+     * @return int Exit code (0 for normal termination)
+     */
+    int runHeadless();
+    
+    /**
+     * Threaded game loop: events and fixed simulation ticks on the calling thread,
+     * drawing on a render thread that owns the window context
+     * A slow or vsync-blocked frame no longer delays input handling or ticks
+     * 
+     * @return int Exit code (0 for normal termination)
+     */
+    int runThreaded();
+    
+    /**
+     * Copy the drawable state into the snapshot buffer and publish it
+     * Main thread only, after the ticks of a frame ran
+     */
+    void publishSnapshot();
+    
+    /**
+     * Render thread body: draw the newest snapshot until renderThreadActive is cleared
+     */
+    void renderThreadLoop();
+    
+    /**
+     * Draw one snapshot (render thread only)
+     * Debug boxes and the profiler overlay are not drawn in threaded mode
+     * 
+     * @param snapshot State to draw
+     * @param alpha Interpolation factor between the snapshot's previous and current tick
+     */
+    void renderSnapshot(const RenderSnapshot& snapshot, double alpha);
+
     // ===== Initialization Methods =====
     
     /**
@@ -144,6 +329,40 @@ private:
      */
     void loadResources();
 
+    /**
+     * Map the packed asset bundle (see tools/AssetPacker.cpp)
+     * When the bundle is missing, loaders fall back to the individual asset files
+     * 
+     * @return true if the bundle was mapped
+     */
+    bool openAssetBundle();
+
+    /**
+     * Queue all startup resources on worker threads
+     * Textures and font are REQUIRED, sounds are OPTIONAL
+     */
+    void startResourceLoading();
+    
+    /**
+     * Show the loading screen until every REQUIRED resource is ready
+     * Runs finish steps (GPU uploads) on this thread as loads complete
+     * 
+     * @return false if the window was closed while loading
+     */
+    bool runLoadingScreen();
+    
+    /**
+     * Draw a progress bar (no font or textures needed)
+     * 
+     * @param progress Fraction of required resources loaded (0.0 - 1.0)
+     */
+    void renderLoadingScreen(float progress);
+    
+    /**
+     * Set up sprite rects, game systems and UI once required resources are in
+     */
+    void finishResourceLoading();
+
     /**
      *  Initialize the sound system
      *  Loads sound buffers and sets up sound objects
@@ -176,6 +395,7 @@ private:
     /**
      * Render all game elements to the screen
      * Manages the complete rendering pipeline in correct order
+     * Positions are interpolated between the last two simulation steps
      */
     void render();
     
@@ -189,6 +409,60 @@ private:
      */
     void changeState(GameState newState);
     
+    /**
+     * Apply one gameplay input to the simulation and record it if recording
+     * Single entry point for keyboard, headless restarts and replay playback
+     * 
+     * @param input Input to apply before the next tick
+     */
+    void applyInput(Replay::Input input);
+    
+    /**
+     * Apply a keyboard input unless a replay is driving the game
+     * 
+     * @param input Input from the keyboard
+     */
+    void submitKeyboardInput(Replay::Input input);
+    
+    /**
+     * Apply replayed inputs scheduled before the current tick
+     */
+    void applyReplayInputs();
+    
+    /**
+     * Load Options::replayPath and take seed, tick rate and autopilot from it
+     * 
+     * @return true if the replay will drive the game
+     */
+    bool loadReplay();
+    
+    /**
+     * Simulate as fast as possible up to a tick (replay seeking)
+     * 
+     * @param targetTick Tick to stop at
+     */
+    void fastForward(long long targetTick);
+    
+    /**
+     * Jump replay playback to a tick (Left/Right keys)
+     * Backwards restores the newest snapshot far enough before the target and
+     * simulates the rest; forwards simulates from the current tick
+     * Ignored while a recording or state stream is written (they cannot go back)
+     * 
+     * @param targetTick Tick to continue from (clamped to the replay)
+     */
+    void seekReplay(long long targetTick);
+    
+    /**
+     * Write the recording to Options::recordPath if one was made
+     */
+    void saveRecording();
+    
+    /**
+     * Write the state stream to Options::stateStreamPath if one was encoded
+     */
+    void saveStateStream();
+    
     /**
      * Handle input events specific to the PLAYING state
      * Processes jump commands and game-specific controls
@@ -233,6 +507,12 @@ private:
      */
     void updateHighScore();
     
+    /**
+     * Queue the finished run for the score journal (returns immediately)
+     * Replayed runs are not journaled
+     */
+    void journalRun();
+    
     /**
      * Check for collisions between all relevant game objects
      * Coordinates collision detection through CollisionManager
@@ -243,32 +523,43 @@ private:
     
     /**
      * Reset all game systems to initial state for new game
-     * Coordinates the reset process across all systems
+     * Restores the snapshot taken at startup instead of rebuilding the systems
      */
     void resetGame();
-
-    // ===== Sound Methods =====
+    
+    // ===== Snapshot Methods =====
+    
     /**
-     *  Play sound effects based on game events
-     *  These methods handle sound playback for various game actions
+     * Copy the whole simulation state into a snapshot (no allocation)
+     * 
+     * @param snapshot Snapshot to fill, usually a SnapshotRing slot
      */
+    void captureSnapshot(SimulationSnapshot& snapshot) const;
+    
     /**
-     *  Play sound effect for player jump action
-     *  Uses preloaded sound buffer for efficiency
+     * Put the run state of a snapshot back (player, obstacles, time, score) and
+     * move the ghosts to its run tick
+     * Simulation tick, session and game state are left to the caller
+     * 
+     * @param snapshot Snapshot to restore
+     * @param restoreHistory Going back in time: also restore the obstacle generator and
+     *                       spawn counts (false: a new run from this state, both carry on)
      */
-    void playJumpSound();
+    void restoreSnapshot(const SimulationSnapshot& snapshot, bool restoreHistory);
     
     /**
-     *  Play sound effect for game over event
-     *   Uses preloaded sound buffer for efficiency
+     * Practice rewind after a game over: continue the run from REWIND_SECONDS
+     * before the collision, with the same obstacles ahead
+     * Does nothing outside GAME_OVER or when the run has no snapshots to go back to
      */
-    void playGameOverSound();            
+    void rewindRun();
 
+    // ===== Sound Methods =====
     /**
-     *  Play sound effect for scoring events
-     *  Uses preloaded sound buffer for efficiency
+     * Queue the milestone sound when the score crosses into a new milestone
+     * Fires once per crossing, not on every tick the score sits on a multiple
      */
-    void playScoreSound();               
+    void checkScoreMilestone();
 
     /**
      * Load a sound file into a SoundBuffer
@@ -280,11 +571,22 @@ private:
      */
     bool loadSoundFile(sf::SoundBuffer& buffer, const std::string& filename); 
     
+    /**
+     * Load a sound from the asset bundle, or from the first fallback file that exists
+     * 
+     * @param buffer Reference to SoundBuffer to load into
+     * @param bundleName Asset name inside the bundle
+     * @param fallbackPaths Individual files tried when the bundle lacks the sound
+     * @return true if the sound was loaded
+     */
+    bool loadSoundAsset(sf::SoundBuffer& buffer, const std::string& bundleName,
+                        const std::vector<std::string>& fallbackPaths);
+    
     // ===== UI Management Methods =====
     
     /**
-     * Update all score display texts with current values
-     * Handles text formatting and positioning
+     * Update all score displays with current values
+     * Cheap when nothing changed: the counters only re-lay out digits that differ
      */
     void updateScoreDisplays();
     
@@ -300,22 +602,34 @@ private:
      */
     void renderGameWorld();
     
-    // ===== Performance and Utility Methods =====
+    /**
+     * Rebuild the profiler overlay text at a fixed refresh rate
+     * Rebuilding every frame would itself show up in the renderUI timings
+     * 
+     * @param frameTime Real time elapsed since last frame
+     */
+    void updateProfilerOverlay(double frameTime);
     
     /**
-     * Maintain consistent frame rate through proper timing
-     * Implements frame rate limiting and VSync coordination
+     * Draw the profiler overlay if it is enabled
      */
-    void maintainFrameRate();
+    void renderProfilerOverlay();
     
     /**
-     * Get formatted string representation of a score
-     * Provides consistent score formatting across the game
+     * Start or stop writing per-frame profiler timings to PROFILER_CSV_PATH
+     */
+    void toggleProfilerCsvDump();
+    
+    // ===== Performance and Utility Methods =====
+    
+    /**
+     * Maintain consistent simulation rate through a fixed-step accumulator
+     * Consumes the real frame time in fixed ticks, caps catch-up steps after
+     * a hitch, and computes the interpolation factor used by render()
      * 
-     * @param score The score value to format
-     * @return Formatted score string (e.g., "000123")
+     * @param frameTime Real time elapsed since last frame
      */
-    std::string formatScore(int score) const;
+    void maintainFrameRate(double frameTime);
     
     /**
      * Log debug information about current game state
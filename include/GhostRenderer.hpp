@@ -0,0 +1,77 @@
+#ifndef GHOST_RENDERER_HPP
+#define GHOST_RENDERER_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "SpriteBatch.hpp"
+#include "StateStream.hpp"
+
+/**
+ * GhostRenderer class: Translucent dinos replaying recorded state streams next to the player
+ *
+ * Design Philosophy:
+ * - Every ghost is a StateStream decoder kept at the local run's tick, so a ghost runs
+ *   exactly as fast as the run it was recorded from and follows rewinds and seeks
+ * - Only the dino is drawn: ghosts share the view with the local obstacles, which are
+ *   what the player plays against
+ * - All ghosts go into one SpriteBatch (the dino frames share a sheet), so dozens of
+ *   ghosts cost a single draw call
+ * - A ghost is hidden while its run is on the game over screen and after its stream ends
+ */
+class GhostRenderer {
+public:
+    static const uint8_t GHOST_ALPHA;   // Opacity of every ghost (0-255)
+
+private:
+    /**
+     * One replayed run
+     */
+    struct Ghost {
+        std::unique_ptr<StateStream> stream;
+        bool finished;                  // Stream ran out of ticks
+
+        Ghost() : finished(false) {}
+    };
+
+    std::vector<Ghost> ghosts;
+    SpriteBatch batch;
+
+public:
+    /**
+     * Load a stream file as a new ghost
+     *
+     * @param path State stream written with --stream
+     * @param tickRate Local simulation rate (a different rate only logs a warning)
+     * @return true if the ghost was added
+     */
+    bool addGhost(const std::string& path, double tickRate);
+
+    /**
+     * Show every ghost at a tick of its run: one decode step when the local run moved
+     * on by a tick, a keyframe seek otherwise (restart, practice rewind, replay seeking)
+     *
+     * @param tick Ticks since the local run started
+     */
+    void setTick(uint64_t tick);
+
+    /**
+     * Draw every visible ghost with one draw call
+     *
+     * @param target Render target (usually the game window)
+     * @param alpha Interpolation factor between the previous and the current tick (0-1)
+     */
+    void render(sf::RenderTarget& target, float alpha);
+
+    /**
+     * Get number of loaded ghosts
+     *
+     * @return Ghost count
+     */
+    size_t getGhostCount() const;
+};
+
+#endif // GHOST_RENDERER_HPP
@@ -0,0 +1,110 @@
+#ifndef HUD_COUNTER_HPP
+#define HUD_COUNTER_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <string>
+
+/**
+ * HudCounter class: Fixed-width numeric label drawn from cached digit glyphs
+ *
+ * Design Philosophy:
+ * - The label ("Score: ") is an sf::Text laid out once in setup()
+ * - The number is a strip of DIGIT_COUNT quads sampling the font's glyph page directly;
+ *   glyph rects and advances for '0'-'9' are looked up once, not per update
+ * - Every digit has a fixed slot, so a new value only rewrites the quads of digits that changed
+ * - setValue() is a no-op while the displayed value is unchanged
+ *
+ * sf::Text::setString re-lays out the whole string on every call, which is what made
+ * per-frame score updates the largest CPU cost on the HUD.
+ */
+class HudCounter {
+public:
+    static const size_t DIGIT_COUNT = 6;          // Zero-padded width ("000123")
+    static const int MAX_VALUE = 999999;          // Largest value that fits DIGIT_COUNT digits
+
+private:
+    static const size_t VERTICES_PER_DIGIT = 6;   // Two triangles per quad, as in SpriteBatch
+
+    /**
+     * Cached layout of one digit glyph
+     */
+    struct DigitGlyph {
+        sf::FloatRect bounds;       // Quad relative to the pen position on the baseline
+        sf::FloatRect textureRect;  // Area of the font page
+    };
+
+    const sf::Font* font;                       // Font owning the glyph page (nullptr until setup)
+    unsigned int characterSize;
+    sf::Text label;                             // Static prefix
+    DigitGlyph digitGlyphs[10];                 // Glyphs for '0' - '9'
+    float slotAdvance;                          // Horizontal distance between digit slots
+    sf::Vector2f digitOrigin;                   // Pen position of the first slot (on the baseline)
+    sf::Color color;
+    sf::Vertex vertices[DIGIT_COUNT * VERTICES_PER_DIGIT];
+    char shownDigits[DIGIT_COUNT];              // Digits currently in the vertex strip
+    int shownValue;                             // Value currently displayed (-1 = none yet)
+    size_t relayoutCount;                       // Digit quads rewritten since setup
+
+public:
+    /**
+     * Constructor: Create an empty counter (draws nothing until setup)
+     */
+    HudCounter();
+
+    /**
+     * Lay out the label and cache digit glyphs
+     * The font must outlive the counter
+     *
+     * @param font Font for label and digits
+     * @param labelText Static prefix drawn before the digits
+     * @param size Character size in pixels
+     * @param position Top-left corner, as for sf::Text
+     * @param fillColor Text color
+     */
+    void setup(const sf::Font& font, const std::string& labelText, unsigned int size,
+               const sf::Vector2f& position, const sf::Color& fillColor);
+
+    /**
+     * Show a value, touching only the digits that differ from the displayed ones
+     * Values outside 0 - MAX_VALUE are clamped
+     *
+     * @param value Value to display
+     * @return true if anything was re-laid out
+     */
+    bool setValue(int value);
+
+    /**
+     * Draw label and digits (two draw calls)
+     *
+     * @param target Render target (usually the game window)
+     */
+    void draw(sf::RenderTarget& target) const;
+
+    /**
+     * Get number of digit quads rewritten since setup (for profiling)
+     *
+     * @return Rewritten digit count
+     */
+    size_t getRelayoutCount() const;
+
+    /**
+     * Write a value as exactly DIGIT_COUNT zero-padded digits, without allocating
+     * Values outside 0 - MAX_VALUE are clamped
+     *
+     * @param value Value to format
+     * @param digits Receives DIGIT_COUNT characters (not NUL-terminated)
+     */
+    static void formatDigits(int value, char digits[DIGIT_COUNT]);
+
+private:
+    /**
+     * Rewrite the quad of one digit slot
+     *
+     * @param slot Slot index (0 = leftmost)
+     * @param digit Character '0' - '9'
+     */
+    void writeDigitQuad(size_t slot, char digit);
+};
+
+#endif // HUD_COUNTER_HPP
@@ -0,0 +1,330 @@
+#ifndef LOGGER_HPP
+#define LOGGER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+// ===== Compile-Time Level Filtering =====
+// Calls below DINO_LOG_MIN_LEVEL expand to nothing (arguments are not evaluated)
+
+#define DINO_LOG_LEVEL_TRACE 0
+#define DINO_LOG_LEVEL_DEBUG 1
+#define DINO_LOG_LEVEL_INFO  2
+#define DINO_LOG_LEVEL_WARN  3
+#define DINO_LOG_LEVEL_ERROR 4
+#define DINO_LOG_LEVEL_OFF   5
+
+#ifndef DINO_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define DINO_LOG_MIN_LEVEL DINO_LOG_LEVEL_WARN     // Release: warnings and errors only
+#else
+#define DINO_LOG_MIN_LEVEL DINO_LOG_LEVEL_TRACE    // Development: everything
+#endif
+#endif
+
+/**
+ * Severity of a log message
+ * Values match the DINO_LOG_LEVEL_* macros above
+ */
+enum class LogLevel : unsigned char {
+    TRACE = DINO_LOG_LEVEL_TRACE,   // Per-frame detail
+    DEBUG = DINO_LOG_LEVEL_DEBUG,   // Gameplay events (jumps, spawns, collisions)
+    INFO  = DINO_LOG_LEVEL_INFO,    // State changes, one-off notices
+    WARN  = DINO_LOG_LEVEL_WARN,    // Recoverable problems
+    ERROR = DINO_LOG_LEVEL_ERROR    // Failures
+};
+
+/**
+ * Subsystem a log message belongs to
+ * Each category has its own runtime level
+ */
+enum class LogCategory : unsigned char {
+    GAME,
+    PLAYER,
+    OBSTACLE,
+    COLLISION,
+    TEXTURE,
+    AUDIO,
+    COUNT       // Number of categories (not a real category)
+};
+
+/**
+ * Logger class: Asynchronous leveled logging for hot paths
+ *
+ * Design Philosophy:
+ * - Singleton pattern, same as TextureManager
+ * - A log call only copies the format pointer and up to four arguments into a
+ *   lock-free ring buffer slot; no formatting, allocation or I/O on the caller
+ * - A background thread drains the ring, formats and writes in batches
+ *   (one flush per batch instead of std::endl per line)
+ * - Compile-time stripping through the DINO_LOG_* macros, runtime filtering per category
+ *
+ * Format strings use "{}" as the argument placeholder and must be string
+ * literals (only the pointer is stored). String arguments are copied inline
+ * and truncated to fit the record.
+ * When the ring is full new messages are dropped and counted.
+ */
+class Logger {
+public:
+    static const size_t MAX_ARGS = 4;           // Arguments stored per record
+    static const size_t TEXT_CAPACITY = 48;     // Inline bytes for string arguments
+    static const size_t RING_CAPACITY = 1024;   // Slots in the ring (power of 2)
+
+private:
+    // ===== Record Storage =====
+
+    enum class ArgType : unsigned char {
+        INT,        // Signed integer
+        UINT,       // Unsigned integer
+        DOUBLE,     // Floating point
+        BOOL,       // true / false
+        TEXT        // Offset into the record's text buffer
+    };
+
+    struct Arg {
+        ArgType type;
+        union {
+            long long intValue;
+            unsigned long long uintValue;
+            double doubleValue;
+            bool boolValue;
+            unsigned int textOffset;
+        };
+    };
+
+    struct Record {
+        LogLevel level;
+        LogCategory category;
+        unsigned char argCount;
+        unsigned char textUsed;
+        const char* format;
+        Arg args[MAX_ARGS];
+        char text[TEXT_CAPACITY];
+    };
+
+    /**
+     * Ring slot with a sequence number (bounded MPMC queue, used single-consumer)
+     * The sequence tells producers and the consumer whose turn the slot is
+     */
+    struct Slot {
+        std::atomic<size_t> sequence;
+        Record record;
+    };
+
+    std::unique_ptr<Slot[]> ring;
+    std::atomic<size_t> enqueuePosition;    // Claimed by producers
+    size_t dequeuePosition;                 // Owned by the drain thread
+
+    // ===== Filtering and Statistics =====
+    std::atomic<unsigned char> categoryLevels[static_cast<size_t>(LogCategory::COUNT)];
+    std::atomic<size_t> droppedCount;       // Messages lost to a full ring
+
+    // ===== Background Thread =====
+    std::thread drainThread;
+    std::atomic<bool> running;
+
+    // ===== Singleton Implementation =====
+    Logger();  // Private constructor
+
+public:
+    ~Logger();
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    // ===== Singleton Access =====
+
+    /**
+     * Get the global Logger instance
+     * Creates the instance and starts the drain thread on first call
+     * (function-local static, so first use from any thread is safe)
+     *
+     * @return Reference to the singleton Logger
+     */
+    static Logger& getInstance();
+
+    /**
+     * Stop the drain thread after writing every queued message
+     * Called automatically from the destructor; later log calls are dropped
+     */
+    void shutdown();
+
+    // ===== Logging =====
+
+    /**
+     * Queue a message (prefer the DINO_LOG_* macros, which strip at compile time)
+     *
+     * @param level Message severity
+     * @param category Subsystem the message comes from
+     * @param format String literal with "{}" placeholders
+     * @param args Up to MAX_ARGS numbers, bools or strings
+     */
+    template <typename... Args>
+    void log(LogLevel level, LogCategory category, const char* format, const Args&... args) {
+        static_assert(sizeof...(Args) <= MAX_ARGS, "Logger records hold at most MAX_ARGS arguments");
+        if (!isEnabled(level, category)) {
+            return;
+        }
+
+        Slot* slot = claimSlot();
+        if (!slot) {
+            return;  // Ring full (counted in droppedCount)
+        }
+
+        Record& record = slot->record;
+        record.level = level;
+        record.category = category;
+        record.format = format;
+        record.argCount = 0;
+        record.textUsed = 0;
+
+        // C++14 compatible pack expansion
+        int expand[] = {0, (storeArg(record, args), 0)...};
+        (void)expand;
+
+        publishSlot(slot);
+    }
+
+    // ===== Runtime Filtering =====
+
+    /**
+     * Check whether a message would be recorded
+     *
+     * @param level Message severity
+     * @param category Subsystem
+     * @return true if level is at or above the category's runtime level
+     */
+    bool isEnabled(LogLevel level, LogCategory category) const {
+        return static_cast<unsigned char>(level) >=
+               categoryLevels[static_cast<size_t>(category)].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Set the minimum level recorded for one category
+     *
+     * @param category Subsystem
+     * @param level Lowest severity to keep
+     */
+    void setCategoryLevel(LogCategory category, LogLevel level);
+
+    /**
+     * Set the minimum level recorded for every category
+     *
+     * @param level Lowest severity to keep
+     */
+    void setLevel(LogLevel level);
+
+    /**
+     * Get number of messages dropped because the ring was full
+     *
+     * @return Dropped message count
+     */
+    size_t getDroppedCount() const;
+
+private:
+    // ===== Ring Buffer =====
+
+    /**
+     * Reserve the next free slot for writing
+     *
+     * @return Slot to fill, or nullptr if the ring is full
+     */
+    Slot* claimSlot();
+
+    /**
+     * Hand a filled slot over to the drain thread
+     *
+     * @param slot Slot returned by claimSlot()
+     */
+    void publishSlot(Slot* slot);
+
+    /**
+     * Write out every published record
+     *
+     * @return Number of records written
+     */
+    size_t drain();
+
+    /**
+     * Drain thread body: drain, then sleep briefly when idle
+     */
+    void drainLoop();
+
+    /**
+     * Expand a record's format string with its arguments
+     *
+     * @param record Record to format
+     * @return Finished message line (without newline)
+     */
+    static std::string formatRecord(const Record& record);
+
+    // ===== Argument Capture =====
+
+    static void storeArg(Record& record, bool value);
+    static void storeArg(Record& record, char value);
+    static void storeArg(Record& record, int value);
+    static void storeArg(Record& record, long value);
+    static void storeArg(Record& record, long long value);
+    static void storeArg(Record& record, unsigned int value);
+    static void storeArg(Record& record, unsigned long value);
+    static void storeArg(Record& record, unsigned long long value);
+    static void storeArg(Record& record, float value);
+    static void storeArg(Record& record, double value);
+    static void storeArg(Record& record, const char* value);
+    static void storeArg(Record& record, const std::string& value);
+
+    /**
+     * Enum arguments are logged by their underlying value
+     */
+    template <typename T>
+    static typename std::enable_if<std::is_enum<T>::value>::type storeArg(Record& record, T value) {
+        storeArg(record, static_cast<long long>(value));
+    }
+
+    /**
+     * Copy a string argument into the record's text buffer (truncated if full)
+     *
+     * @param record Record being filled
+     * @param text String to copy
+     * @param length Number of bytes in text
+     */
+    static void storeText(Record& record, const char* text, size_t length);
+};
+
+// ===== Logging Macros =====
+// Usage: DINO_LOG_DEBUG(PLAYER, "Player jumped at y = {}", posY);
+
+#if DINO_LOG_MIN_LEVEL <= DINO_LOG_LEVEL_TRACE
+#define DINO_LOG_TRACE(category, ...) Logger::getInstance().log(LogLevel::TRACE, LogCategory::category, __VA_ARGS__)
+#else
+#define DINO_LOG_TRACE(category, ...) ((void)0)
+#endif
+
+#if DINO_LOG_MIN_LEVEL <= DINO_LOG_LEVEL_DEBUG
+#define DINO_LOG_DEBUG(category, ...) Logger::getInstance().log(LogLevel::DEBUG, LogCategory::category, __VA_ARGS__)
+#else
+#define DINO_LOG_DEBUG(category, ...) ((void)0)
+#endif
+
+#if DINO_LOG_MIN_LEVEL <= DINO_LOG_LEVEL_INFO
+#define DINO_LOG_INFO(category, ...) Logger::getInstance().log(LogLevel::INFO, LogCategory::category, __VA_ARGS__)
+#else
+#define DINO_LOG_INFO(category, ...) ((void)0)
+#endif
+
+#if DINO_LOG_MIN_LEVEL <= DINO_LOG_LEVEL_WARN
+#define DINO_LOG_WARN(category, ...) Logger::getInstance().log(LogLevel::WARN, LogCategory::category, __VA_ARGS__)
+#else
+#define DINO_LOG_WARN(category, ...) ((void)0)
+#endif
+
+#if DINO_LOG_MIN_LEVEL <= DINO_LOG_LEVEL_ERROR
+#define DINO_LOG_ERROR(category, ...) Logger::getInstance().log(LogLevel::ERROR, LogCategory::category, __VA_ARGS__)
+#else
+#define DINO_LOG_ERROR(category, ...) ((void)0)
+#endif
+
+#endif // LOGGER_HPP
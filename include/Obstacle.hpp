@@ -3,6 +3,7 @@
 
 #include <SFML/Graphics.hpp>
 #include "TextureManager.hpp"
+#include "SpriteBatch.hpp"
 
 /**
  * Obstacle class: Enhanced with sprite-based rendering and variety
@@ -20,12 +21,29 @@ public:
      * Enum for different types of obstacles
      * Determines which sprite to use and obstacle properties
      */
-    enum class ObstacleType {
+    enum class ObstacleType : unsigned char {
         CACTUS_SMALL,      // Small cactus (easier to jump over)
         CACTUS_MID,      // MID cactus (easier to jump over)
         CACTUS_LARGE,      // Large cactus (requires precise timing)
         CACTUS_CLUSTER     // Future: cluster of small cacti
     };
+    
+    static const int TYPE_COUNT = 4;   // Number of ObstacleType values
+    static constexpr float COLLISION_OUTLINE_THICKNESS = 2.0f;  // Debug outline that getGlobalBounds() includes
+    
+    /**
+     * Properties shared by every obstacle of one type
+     * Lets ObstacleManager store only position and type id per obstacle
+     * 
+     * The collision extents are the effective hit box: the collision size grown by
+     * the debug outline, exactly what boundingBox.getGlobalBounds() reports
+     */
+    struct TypeInfo {
+        sf::Vector2f spriteSize;                // Rendered sprite size
+        sf::Vector2f collisionSize;             // Effective hit box size (outline included)
+        sf::Vector2f collisionOffset;           // Hit box offset from sprite top-left
+        TextureManager::SpriteType spriteType;  // Sprite used for rendering
+    };
 
 private:
     // ===== Sprite System =====
@@ -36,6 +54,7 @@ private:
     // ===== Position and Movement =====
     double posX;
     double posY;
+    double previousPosX;     // Position at the previous simulation step (for render interpolation)
     double velocityX;
     
     // ===== Size Management =====
@@ -45,6 +64,16 @@ private:
     // ===== Type-Specific Constants =====
     static const double GROUND_Y;
     
+    // Widths as literals (sf::Vector2f is not one), usable in constant expressions
+    static constexpr float SMALL_CACTUS_WIDTH = 15.0f;            // SMALL_CACTUS_SIZE.x
+    static constexpr float MID_CACTUS_WIDTH = 25.0f;              // MID_CACTUS_SIZE.x
+    static constexpr float LARGE_CACTUS_WIDTH = 32.0f;            // LARGE_CACTUS_SIZE.x
+    static constexpr float CLUSTER_CACTUS_WIDTH = 40.0f;          // CLUSTER_CACTUS_SIZE.x
+    static constexpr float SMALL_CACTUS_COLLISION_WIDTH = 1.0f;   // SMALL_CACTUS_COLLISION_SIZE.x
+    static constexpr float MID_CACTUS_COLLISION_WIDTH = 1.5f;     // MID_CACTUS_COLLISION_SIZE.x
+    static constexpr float LARGE_CACTUS_COLLISION_WIDTH = 2.5f;   // LARGE_CACTUS_COLLISION_SIZE.x
+    static constexpr float CLUSTER_CACTUS_COLLISION_WIDTH = 32.0f; // CLUSTER_CACTUS_COLLISION_SIZE.x
+    
     // Size definitions for different obstacle types
     static const sf::Vector2f SMALL_CACTUS_SIZE;
     static const sf::Vector2f MID_CACTUS_SIZE;
@@ -56,6 +85,23 @@ private:
     static const sf::Vector2f MID_CACTUS_COLLISION_SIZE;
     static const sf::Vector2f LARGE_CACTUS_COLLISION_SIZE;  
     static const sf::Vector2f CLUSTER_CACTUS_COLLISION_SIZE;
+    
+    // Per-type lookup table, indexed by ObstacleType
+    static const TypeInfo TYPE_INFO_TABLE[TYPE_COUNT];
+    
+    static constexpr float getSpriteWidth(ObstacleType type) {
+        return type == ObstacleType::CACTUS_MID ? MID_CACTUS_WIDTH
+             : type == ObstacleType::CACTUS_LARGE ? LARGE_CACTUS_WIDTH
+             : type == ObstacleType::CACTUS_CLUSTER ? CLUSTER_CACTUS_WIDTH
+             : SMALL_CACTUS_WIDTH;
+    }
+    
+    static constexpr float getCollisionWidth(ObstacleType type) {
+        return type == ObstacleType::CACTUS_MID ? MID_CACTUS_COLLISION_WIDTH
+             : type == ObstacleType::CACTUS_LARGE ? LARGE_CACTUS_COLLISION_WIDTH
+             : type == ObstacleType::CACTUS_CLUSTER ? CLUSTER_CACTUS_COLLISION_WIDTH
+             : SMALL_CACTUS_COLLISION_WIDTH;
+    }
 
 public:
     /**
@@ -93,10 +139,21 @@ public:
     
     /**
      * Render the obstacle sprite to the window
+     * The sprite is drawn between the previous and current simulation positions
      * 
      * @param window SFML render window
+     * @param alpha Interpolation factor (0 = previous step, 1 = current step)
+     */
+    void render(sf::RenderWindow& window, double alpha = 1.0);
+    
+    /**
+     * Queue the obstacle sprite into a shared sprite batch instead of drawing it
+     * Used by ObstacleManager to draw every obstacle with one draw call
+     * 
+     * @param batch Batch for the obstacles sprite sheet
+     * @param alpha Interpolation factor (0 = previous step, 1 = current step)
      */
-    void render(sf::RenderWindow& window);
+    void appendToBatch(SpriteBatch& batch, double alpha = 1.0);
     
     // ===== Information Methods (const) =====
     
@@ -168,6 +225,44 @@ public:
      * @param newType New obstacle type
      */
     void changeType(ObstacleType newType);
+    
+    // ===== Type Table Access =====
+    
+    /**
+     * Get shared properties for an obstacle type
+     * Single indexed load, no per-instance data needed
+     * 
+     * @param type Obstacle type
+     * @return Reference to the type's sizes, collision offset and sprite
+     */
+    static const TypeInfo& getTypeInfo(ObstacleType type);
+    
+    /**
+     * Get the left edge of a type's effective hit box (TypeInfo::collisionOffset.x)
+     * constexpr so obstacle patterns can be checked against the hit boxes at compile time
+     * 
+     * @param type Obstacle type
+     * @return Offset from the sprite left edge in px
+     */
+    static constexpr float getHitboxOffsetX(ObstacleType type) {
+        return (getSpriteWidth(type) - getCollisionWidth(type)) / 2.0f - COLLISION_OUTLINE_THICKNESS;
+    }
+    
+    /**
+     * Get the width of a type's effective hit box (TypeInfo::collisionSize.x)
+     * 
+     * @param type Obstacle type
+     * @return Width in px, outline included
+     */
+    static constexpr float getHitboxWidth(ObstacleType type) {
+        return getCollisionWidth(type) + 2.0f * COLLISION_OUTLINE_THICKNESS;
+    }
+    
+    /**
+     * Prepare TextureManager collision masks for every type at its drawn size
+     * Needed once at startup before pixel collision is used
+     */
+    static void prepareCollisionMasks();
 
 private:
     // ===== Private Helper Methods =====
@@ -4,8 +4,11 @@
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <random>
-#include <unordered_map>
 #include "Obstacle.hpp"
+#include "SpriteBatch.hpp"
+#include "Aabb.hpp"
+#include "FrameArena.hpp"
+#include "Pcg32.hpp"
 
 /**
  * ObstacleManager class: for managing obstacles lifetime in the game.
@@ -31,36 +34,132 @@ public:
         TIGHT_SEQUENCE      // Rapid sequence of obstacles (expert level)
     };
     
+    static const int PATTERN_COUNT = 8;     // Number of ObstaclePattern values
+    
+    static const int MAX_PATTERN_OBSTACLES = 3; // Obstacles one pattern can spawn
+    
     /**
      * Structure defining a specific obstacle spawn pattern
-     * Contains all necessary information for spawning coordinated obstacle groups
+     * Fixed-capacity literal type: the built-in patterns are a constexpr table
+     * (checked at compile time, no startup cost) and lookups are array indexing
      */
     struct PatternDefinition {
-        std::vector<Obstacle::ObstacleType> obstacleTypes;  // Types of obstacles to spawn
-        std::vector<double> relativePositions;             // X offsets from base spawn position
-        double patternDifficulty;                           // Difficulty rating (0.0 - 1.0)
-        double minGameTime;                                 // Minimum game time to unlock this pattern
-        std::string patternName;                            // Human-readable name for debugging
+        int obstacleCount;                                              // Used entries of the arrays below
+        Obstacle::ObstacleType obstacleTypes[MAX_PATTERN_OBSTACLES];    // Types of obstacles to spawn
+        double relativePositions[MAX_PATTERN_OBSTACLES];                // X offsets from base spawn position (non-decreasing)
+        double patternDifficulty;                                       // Difficulty rating (0.0 - 1.0)
+        double minGameTime;                                             // Minimum game time to unlock this pattern
+        const char* patternName;                                        // Human-readable name for debugging
+    };
+    
+    /**
+     * Difficulty curve rates (defaults are the tuned constants below)
+     * Exposed so tools can sweep them without recompiling
+     */
+    struct DifficultyParams {
+        double speedIncreaseRate;       // Obstacle speed gained per second of game time (px/s)
+        double intervalDecreaseRate;    // Spawn interval lost per second of game time (s)
+        double difficultyIncreaseRate;  // Pattern difficulty gained per second of game time
+    };
+    
+    /**
+     * Structure-of-arrays obstacle pool (fixed-capacity ring buffer)
+     * Every obstacle moves at the shared obstacleSpeed and sizes come from
+     * Obstacle::getTypeInfo(), so only position and type id are stored per obstacle.
+     * Slots are preallocated; obstacles enter at the tail and retire from the head
+     * (they leave in FIFO order), so spawning and culling never allocate.
+     * Logical index i (0 = left-most) lives in physical slot slot(i). Live obstacles are kept sorted by x.
+     */
+    struct ObstacleArrays {
+        std::vector<float> posX;                    // Sprite left edge
+        std::vector<float> previousPosX;            // Left edge at previous simulation step (render interpolation)
+        std::vector<float> posY;                    // Sprite top edge
+        std::vector<Obstacle::ObstacleType> type;   // Type id, indexes Obstacle::getTypeInfo()
+        std::vector<ObstaclePattern> pattern;       // Pattern that spawned the obstacle (death attribution)
+        size_t head;                                // Physical slot of logical index 0
+        size_t count;                               // Live obstacles
+        size_t mask;                                // capacity() - 1 (capacity is a power of 2)
+        
+        ObstacleArrays() : head(0), count(0), mask(0) {}
         
-        PatternDefinition() : patternDifficulty(0.0), minGameTime(0.0), patternName("Unknown") {}
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+        size_t capacity() const { return posX.size(); }
+        size_t slot(size_t index) const { return (head + index) & mask; }
+    };
+    
+    /**
+     * Pool counters (debug): reallocations stays at 1 during normal play
+     */
+    struct PoolStats {
+        size_t capacity;        // Slots currently allocated
+        size_t peakCount;       // Most obstacles alive at once
+        size_t spawned;         // Slots filled since construction
+        size_t retired;         // Slots recycled by advancing the head
+        size_t reallocations;   // Storage allocations (1 at construction, +1 per overflow)
+        
+        PoolStats() : capacity(0), peakCount(0), spawned(0), retired(0), reallocations(0) {}
+    };
+    
+    /**
+     * Simulation state of the manager (trivially copyable, for SimulationSnapshot)
+     * Obstacles are stored in logical order (index 0 = left-most); the selection
+     * table is not stored, it is rebuilt from these values on the next spawn
+     */
+    struct Snapshot {
+        static const size_t CAPACITY = 64;          // Obstacles a snapshot holds (the preallocated pool size)
+        
+        uint32_t count;                             // Live obstacles
+        uint32_t unlockedCount;                     // Length of the unlocked pattern prefix
+        float posX[CAPACITY];
+        float previousPosX[CAPACITY];
+        float posY[CAPACITY];
+        Obstacle::ObstacleType type[CAPACITY];
+        ObstaclePattern pattern[CAPACITY];
+        double spawnTimer;
+        double obstacleInterval;
+        double obstacleSpeed;
+        double currentDifficulty;
+        double patternCooldownTimer;
+        ObstaclePattern lastPattern;
+        int consecutiveHardPatterns;
+        Pcg32::State random;                        // Generator position
+        size_t patternSpawnCounts[PATTERN_COUNT];   // Spawns per pattern so far
     };
 private:
     // core member attributes - for obstacles whole management
-    std::vector<Obstacle> obstacles; // Vector to hold all obstacles
+    ObstacleArrays obstacles;           // Packed per-obstacle ring pool, sorted by x
+    PoolStats poolStats;                // Allocation / recycling counters
+    SpriteBatch obstacleBatch;          // All obstacle quads from obstacles_sheet, drawn in one call
+    bool debugMode;                     // Draw collision boxes for debugging
     double spawnTimer;                  // Timer to control obstacle spawning
     double obstacleInterval;            // Time interval between obstacle spawns
     double obstacleSpeed;               // Speed of the obstacles
+    DifficultyParams difficultyParams;  // Active difficulty curve rates
+    size_t patternSpawnCounts[PATTERN_COUNT];  // Times each pattern was spawned since construction
 
     // ===== Pattern System =====
-    std::unordered_map<ObstaclePattern, PatternDefinition> patternDefinitions;
-    std::vector<ObstaclePattern> availablePatterns;
+    PatternDefinition patternDefinitions[PATTERN_COUNT]; // Indexed by ObstaclePattern, copied from the built-in table
+    std::vector<ObstaclePattern> unlockOrder;        // Every pattern, sorted by minGameTime
+    std::vector<ObstaclePattern> availablePatterns;  // Unlocked prefix of unlockOrder
     ObstaclePattern lastPattern;
     int consecutiveHardPatterns;
     
     // ===== Random Generation =====
-    mutable std::mt19937 randomGenerator;
+    mutable Pcg32 randomGenerator;                       // 16 bytes of state, copied into snapshots
     mutable std::uniform_real_distribution<double> uniformDist;
     
+    // ===== Cached Selection Table =====
+    // Weights only change with the difficulty bucket, the cooldown state and
+    // the unlocked set, so the alias table is rebuilt only when one of those changes
+    std::vector<double> aliasProbability;  // Chance to keep column i (Vose alias method)
+    std::vector<size_t> aliasIndex;        // Column's alternative pattern index
+    bool selectionTableDirty;              // Unlocked set changed since last build
+    int tableDifficultyBucket;             // Difficulty bucket the table was built for
+    bool tableHardLimited;                 // consecutiveHardPatterns limit reached at build time
+    bool tableCoolingDown;                 // Complex pattern cooldown active at build time
+    FrameArena* frameArena;                // Scratch memory for table rebuilds (nullptr = heap)
+    
     // ===== Difficulty Scaling =====
     double currentDifficulty;              // Current difficulty level (0.0 - 1.0)
     double patternCooldownTimer;           // Time since last complex pattern
@@ -68,12 +167,13 @@ private:
     // game balance and difficulty settings
     static const double INITIAL_SPAWN_INTERVAL; // Initial time interval for spawning obstacles (EASIEST)
     static const double MIN_SPAWN_INTERVAL;     // Minimum time interval for spawning obstacles (HARDEST)
-    static const double INITIAL_OBSTACLE_SPEED; // Initial speed of the obstacles (EASIEST)
-    static const double MAX_OBSTACLE_SPEED;     // Maximum speed of the obstacles (HARDEST)
+    static constexpr double INITIAL_OBSTACLE_SPEED = 200.0; // Initial speed of the obstacles (EASIEST, pattern unlock speeds derive from it)
+    static constexpr double MAX_OBSTACLE_SPEED = 400.0; // Maximum speed of the obstacles (HARDEST)
     static const double SPAWN_POSITION_X;      // X position where obstacles spawn (right side of the screen)
     static const double SPAWN_POSITION_Y;      // Y position where obstacles spawn (ground level)
+    static const size_t POOL_CAPACITY;         // Preallocated obstacle slots (power of 2, far above the on-screen peak)
 
-    static const double SPEED_INCREASE_RATE; // Rate at which obstacle speed increases over time
+    static constexpr double SPEED_INCREASE_RATE = 5.0; // Rate at which obstacle speed increases over time
     static const double INTERVAL_DECREASE_RATE; // Rate at which spawn interval decreases over time
 
 
@@ -81,25 +181,48 @@ private:
     static const double PATTERN_COOLDOWN_TIME;     // Minimum time between complex patterns
     static const double DIFFICULTY_INCREASE_RATE;  // Rate of difficulty progression
     static const int MAX_CONSECUTIVE_HARD;         // Maximum consecutive hard patterns
+    static const int DIFFICULTY_BUCKETS;           // Weight table resolution over difficulty 0.0 - 1.0
+    static constexpr double PATTERN_POSITION_JITTER = 15.0; // Random x offset range (+-) of every pattern obstacle
 
     // ===== Pattern System Implementation =====
     /**
-     * Initialize all obstacle patterns with their definitions
-     * Sets up timing, positioning, and difficulty for each pattern type
+     * Initialize all obstacle patterns from the built-in constexpr table
+     * The table is validated by static_asserts; at runtime this is a plain copy
      */
     void initializePatterns();
     
     /**
      * Update list of available patterns based on current game time
      * Progressively unlocks more challenging patterns as game progresses
+     * Only patterns whose threshold was passed since the last call are appended
      * 
      * @param gameTime Current game time
      */
     void updateAvailablePatterns(double gameTime);
     
+    /**
+     * Sort every pattern by minGameTime into unlockOrder and restart unlocking
+     * Ties are broken by enum order
+     */
+    void rebuildUnlockOrder();
+    
+    /**
+     * Rebuild the cached alias table if difficulty bucket, cooldown state
+     * or the unlocked pattern set changed since it was built
+     */
+    void refreshSelectionTable();
+    
+    /**
+     * Build the alias table for the available patterns (Vose's method)
+     * 
+     * @param weights One non-negative weight per available pattern
+     */
+    void buildAliasTable(const ArenaVector<double>& weights);
+    
     /**
      * Calculate weighted random selection for patterns
      * Biases selection toward patterns appropriate for current difficulty
+     * Samples the cached alias table in O(1) with a single random draw
      * 
      * @param gameTime Current game time
      * @return Selected pattern based on weighted probability
@@ -126,13 +249,18 @@ private:
     double getPatternWeight(ObstaclePattern pattern, double currentDifficulty) const;
 
     // ===== Obstacle Spawning Helpers =====
-    void spawnSingleObstacle(Obstacle::ObstacleType type, double xOffset = 0.0);
+    void spawnSingleObstacle(Obstacle::ObstacleType type, double xOffset, ObstaclePattern pattern);
+    void insertObstacle(Obstacle::ObstacleType type, float x, float y, ObstaclePattern pattern); // sorted insert into the ring pool
+    void reservePool(size_t capacity);                                  // (re)allocate pool storage, keeps live obstacles
+    static float getGroundOffsetY(Obstacle::ObstacleType type);         // y offset that puts a type on the ground
 
     // private helper methods
-    void spawnObstacle();                               // make a new obstacle and add it to the vector
-    void removeOffScreenObstacles();                    // delete obstacles that are off the screen from the vector
+    void spawnObstacle();                               // make a new obstacle and add it to the arrays
+    void removeOffScreenObstacles();                    // delete obstacles that are off the screen from the arrays
     void updateExistingObstacles(double deltaTime);      // update positions of existing obstacles based on their speed and time
-    void applySpeedToAllObstacles();                    // whole obstacles speed update based on game time
+    void renderDebugBoxes(sf::RenderWindow& window) const; // draw collision boxes (debug mode only)
+    void findInRange(float minX, float maxX, float minOffset, float maxRight,
+                     size_t& first, size_t& last) const;  // x-sorted search, extents relative to posX
 
     // ===== Utility Methods =====
     double generateRandomOffset(double min, double max) const;
@@ -144,22 +272,141 @@ public:
 
     // action methods
     void update(double deltaTime, double gameTime); // Update obstacles based on time
-    void render(sf::RenderWindow& window); // Render all obstacles on the window
+    void render(sf::RenderWindow& window, double alpha = 1.0); // Render all obstacles, interpolated between simulation steps
     void clear(); // Clear all obstacles
+    
+    /**
+     * Reseed the random generator used for patterns and spawn jitter
+     * The same seed always produces the same obstacle sequence
+     * 
+     * @param seed Random seed
+     */
+    void setSeed(unsigned int seed);
+    
+    /**
+     * Take scratch memory (alias table rebuilds) from a per-frame arena instead of the heap
+     * 
+     * @param arena Arena reset once per frame by the owner (nullptr = heap)
+     */
+    void setFrameArena(FrameArena* arena);
+    
+    /**
+     * Copy the simulation state into a snapshot (live obstacles only)
+     * 
+     * @param snapshot Destination
+     */
+    void saveSnapshot(Snapshot& snapshot) const;
+    
+    /**
+     * Continue from a snapshot without allocating
+     * Pool counters stay balanced: obstacles the restore drops count as retired,
+     * obstacles it brings back as spawned
+     * 
+     * @param snapshot State from saveSnapshot()
+     * @param restoreHistory Going back in time: the generator and per-pattern spawn counts
+     *                       come back too (false: both carry on, e.g. for a restart)
+     */
+    void restoreSnapshot(const Snapshot& snapshot, bool restoreHistory);
+    
+    /**
+     * Get the built-in difficulty curve rates
+     * 
+     * @return SPEED_INCREASE_RATE, INTERVAL_DECREASE_RATE and DIFFICULTY_INCREASE_RATE
+     */
+    static DifficultyParams getDefaultDifficultyParams();
+    
+    /**
+     * Replace the difficulty curve rates (takes effect on the next update)
+     * 
+     * @param params New rates
+     */
+    void setDifficultyParams(const DifficultyParams& params);
+    
+    /**
+     * Get the active difficulty curve rates
+     * 
+     * @return Rates used by updateDifficulty()
+     */
+    const DifficultyParams& getDifficultyParams() const;
+    
+    /**
+     * Get a pattern's definition
+     * 
+     * @param pattern Pattern to look up
+     * @return Definition (every pattern is defined)
+     */
+    const PatternDefinition& getPatternDefinition(ObstaclePattern pattern) const;
+    
+    /**
+     * Replace a pattern's definition (difficulty, unlock time, spacing, ...)
+     * Unlocking restarts from the beginning, so call it between sessions
+     * 
+     * @param pattern Pattern to replace
+     * @param definition New definition
+     */
+    void setPatternDefinition(ObstaclePattern pattern, const PatternDefinition& definition);
+    
+    /**
+     * Get number of times a pattern was spawned since construction
+     * 
+     * @param pattern Pattern to count
+     * @return Spawn count (not reset by clear())
+     */
+    size_t getPatternSpawnCount(ObstaclePattern pattern) const;
+    
+    /**
+     * Place one obstacle at an exact x position on the ground
+     * Bypasses the pattern system (benchmarks, tests, scripted scenarios)
+     * 
+     * @param type Obstacle type
+     * @param x Sprite left edge
+     */
+    void spawnObstacleAt(Obstacle::ObstacleType type, float x);
 
     // difficulty management methods
     void updateDifficulty(double gameTime); // Update difficulty based on game time
     double getCurrentDifficulty() const;    // Get current difficulty level (0.0 - 1.0)
     
     // information getter method (const: for not changing inner data)
-    const std::vector<Obstacle>& getObstacles() const;   // getting all obstacles in the vector for check collision or rendering
+    const ObstacleArrays& getObstacleData() const;       // packed obstacle ring pool (index through slot())
+    const PoolStats& getPoolStats() const;               // pool allocation counters (debugging)
+    sf::FloatRect getCollisionBounds(size_t index) const; // collision box of obstacle at index
+    ObstaclePattern getObstaclePattern(size_t index) const; // pattern that spawned obstacle at index
+    Aabb getCollisionAabb(size_t index) const;            // same box as POD edges (collision fast path)
+    Aabb getSpriteAabb(size_t index) const;               // drawn sprite area of obstacle at index (pixel collision)
+    
+    /**
+     * Broad phase query: find obstacles whose collision box may overlap an x range
+     * Uses binary search over the x-sorted arrays, so cost does not grow with
+     * the number of obstacles outside the range
+     * 
+     * @param minX Left edge of the query range
+     * @param maxX Right edge of the query range
+     * @param first Receives index of first candidate
+     * @param last Receives one past the index of the last candidate
+     */
+    void findObstaclesInRange(float minX, float maxX, size_t& first, size_t& last) const;
+    
+    /**
+     * Same query for the drawn sprite areas instead of the collision boxes
+     * 
+     * @param minX Left edge of the query range
+     * @param maxX Right edge of the query range
+     * @param first Receives index of first candidate
+     * @param last Receives one past the index of the last candidate
+     */
+    void findObstacleSpritesInRange(float minX, float maxX, size_t& first, size_t& last) const;
     size_t getObstacleCount() const;                     // obstacle on screen count (for debugging or UI display)
     double getCurrentSpeed() const;                      // get current speed (for calculating score)
     double getCurrentSpawnInterval() const;              // 현재 생성 간격 (for debugging or UI display)
 
-    bool hasObstacles() const; // Check if there are any obstacles in the vector
+    bool hasObstacles() const; // Check if there are any obstacles in the arrays
     void getAverageObstacleDistance() const; // get average distance between obstacles (for checking difficulty)
 
+    // debugging methods
+    void setDebugMode(bool enabled);  // Show or hide obstacle collision boxes
+    void toggleDebugMode();           // Toggle collision box drawing
+
     // ===== Pattern System Methods =====
     
     /**
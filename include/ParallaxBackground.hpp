@@ -0,0 +1,151 @@
+#ifndef PARALLAX_BACKGROUND_HPP
+#define PARALLAX_BACKGROUND_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <string>
+
+/**
+ * ParallaxBackground class: Scenery strips behind the player and obstacles
+ *
+ * Design Philosophy:
+ * - Every layer is one quad over the whole view, textured with a repeated strip
+ *   (far hills, clouds, ground); the quad never moves
+ * - Scrolling only shifts the quad's texture coordinates, so a layer costs six
+ *   vertex writes and one draw call per frame however much scenery the strip holds
+ * - Layers scroll at a fraction of the obstacle speed (ground at exactly the
+ *   obstacle speed), stepped with the fixed simulation tick and interpolated when drawn
+ * - Strips are built once at load time and owned by TextureManager
+ *
+ * Draws nothing until initialize() succeeded (headless mode never calls it).
+ */
+class ParallaxBackground {
+public:
+    /**
+     * Layers in drawing order (farthest first)
+     */
+    enum class Layer {
+        FAR_HILLS,          // Dune silhouette near the horizon
+        CLOUDS,             // Clouds from the obstacles sheet
+        GROUND,             // Ground line with pebbles
+        COUNT               // Number of layers (not a real layer)
+    };
+
+    static const int LAYER_COUNT = static_cast<int>(Layer::COUNT);
+
+private:
+    static const size_t VERTICES_PER_LAYER = 6;  // Two triangles per quad, as in SpriteBatch
+
+    /**
+     * One scrolling strip
+     */
+    struct LayerState {
+        const sf::Texture* texture;                 // Repeated strip (nullptr = layer not drawn)
+        sf::Vertex vertices[VERTICES_PER_LAYER];    // Fixed positions, only texture x changes
+        float stripWidth;                           // Texture width: offsets wrap at this value
+        float speedFactor;                          // Fraction of the obstacle speed
+        double offset;                              // Texels scrolled at the current step
+        double previousOffset;                      // Texels scrolled at the previous step
+
+        LayerState() : texture(nullptr), stripWidth(0.0f), speedFactor(0.0f),
+                       offset(0.0), previousOffset(0.0) {}
+    };
+
+    LayerState layers[LAYER_COUNT];
+
+    // ===== Layer Configuration =====
+    static const float SPEED_FACTORS[LAYER_COUNT];  // Scroll speed relative to the obstacles
+    static const float LAYER_TOPS[LAYER_COUNT];     // Screen y of each strip's top edge
+    static const float GROUND_LINE_Y;               // Screen y the sprites stand on
+
+public:
+    /**
+     * Constructor: Create the layers without textures (draws nothing)
+     */
+    ParallaxBackground();
+
+    /**
+     * Build the strip textures and lay out one quad per layer
+     * Needs the sprite sheets for the clouds; the other strips are generated
+     *
+     * @param viewWidth Width the quads cover
+     * @return true if every layer is ready (missing layers are skipped when drawn)
+     */
+    bool initialize(float viewWidth);
+
+    /**
+     * Scroll all layers by one simulation step
+     *
+     * @param deltaTime Step length
+     * @param obstacleSpeed Current obstacle speed (px/s)
+     */
+    void update(double deltaTime, double obstacleSpeed);
+
+    /**
+     * Draw every ready layer, farthest first
+     *
+     * @param target Render target
+     * @param alpha Interpolation factor (0 = previous step, 1 = current step)
+     */
+    void render(sf::RenderTarget& target, double alpha);
+    
+    /**
+     * Draw every ready layer at given offsets (threaded rendering draws from snapshots)
+     *
+     * @param target Render target
+     * @param offsets Texture x offset of each layer, as filled by getOffsets()
+     */
+    void render(sf::RenderTarget& target, const float offsets[LAYER_COUNT]);
+    
+    /**
+     * Get the interpolated offset of every layer
+     *
+     * @param alpha Interpolation factor (0 = previous step, 1 = current step)
+     * @param offsets Receives one offset per layer
+     */
+    void getOffsets(double alpha, float offsets[LAYER_COUNT]) const;
+
+    /**
+     * Get how far a layer has scrolled (wrapped to its strip width)
+     *
+     * @param layer Layer to query
+     * @return Offset in texels at the current step
+     */
+    double getOffset(Layer layer) const;
+
+private:
+    /**
+     * Register a strip with TextureManager and lay out its quad
+     *
+     * @param layer Layer the strip belongs to
+     * @param name Texture name
+     * @param strip Strip pixels (repeated horizontally)
+     * @param viewWidth Width the quad covers
+     * @return true if the texture was created
+     */
+    bool setupLayer(Layer layer, const std::string& name, const sf::Image& strip, float viewWidth);
+
+    /**
+     * Generate the dune silhouette (seamless: every wave divides the strip width)
+     *
+     * @return Strip image
+     */
+    static sf::Image buildHillsStrip();
+
+    /**
+     * Scatter copies of the cloud sprite over a transparent strip
+     *
+     * @param cloud Cloud sprite pixels
+     * @return Strip image
+     */
+    static sf::Image buildCloudStrip(const sf::Image& cloud);
+
+    /**
+     * Generate the ground line with pebbles below it
+     *
+     * @return Strip image
+     */
+    static sf::Image buildGroundStrip();
+};
+
+#endif // PARALLAX_BACKGROUND_HPP
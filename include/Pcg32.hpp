@@ -0,0 +1,84 @@
+#ifndef PCG32_HPP
+#define PCG32_HPP
+
+#include <cstdint>
+
+/**
+ * Pcg32 class: PCG XSH-RR random generator (64-bit state, 32-bit output)
+ *
+ * Design Philosophy:
+ * - 16 bytes of plain state instead of std::mt19937's 5 KB, so the generator
+ *   can be copied into every simulation snapshot
+ * - Satisfies the standard UniformRandomBitGenerator requirements, so the
+ *   <random> distributions work with it unchanged
+ * - Same seed, same sequence on every platform (no implementation-defined parts)
+ */
+class Pcg32 {
+public:
+    typedef uint32_t result_type;
+
+    /**
+     * Raw generator state (trivially copyable, for snapshots)
+     */
+    struct State {
+        uint64_t state;         // LCG state
+        uint64_t increment;     // LCG increment (odd, selects the stream)
+    };
+
+private:
+    static const uint64_t MULTIPLIER = 6364136223846793005ULL;
+    static const uint64_t DEFAULT_STREAM = 1442695040888963407ULL;
+
+    State current;
+
+public:
+    /**
+     * Constructor: Seed the generator
+     *
+     * @param seedValue Initial seed
+     */
+    explicit Pcg32(uint64_t seedValue = 0) {
+        seed(seedValue);
+    }
+
+    /**
+     * Restart the sequence from a seed (PCG reference seeding)
+     *
+     * @param seedValue Seed
+     */
+    void seed(uint64_t seedValue) {
+        current.state = 0;
+        current.increment = DEFAULT_STREAM | 1u;
+        (*this)();
+        current.state += seedValue;
+        (*this)();
+    }
+
+    /**
+     * Generate the next value
+     *
+     * @return Uniform 32-bit value
+     */
+    result_type operator()() {
+        uint64_t previous = current.state;
+        current.state = previous * MULTIPLIER + current.increment;
+        uint32_t xorShifted = static_cast<uint32_t>(((previous >> 18u) ^ previous) >> 27u);
+        uint32_t rotation = static_cast<uint32_t>(previous >> 59u);
+        return (xorShifted >> rotation) | (xorShifted << ((32u - rotation) & 31u));
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT32_MAX; }
+
+    // ===== Snapshot Access =====
+
+    const State& getState() const {
+        return current;
+    }
+
+    void setState(const State& state) {
+        current = state;
+    }
+};
+
+#endif // PCG32_HPP
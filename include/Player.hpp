@@ -5,6 +5,9 @@
 
 #include <SFML/Graphics.hpp>
 #include "TextureManager.hpp"
+#include "SpriteBatch.hpp"
+#include "AnimationPlayer.hpp"
+#include "Aabb.hpp"
 
 /**
  * Player class: Enhanced with sprite-based rendering, animation, and advanced ducking system
@@ -26,6 +29,7 @@ private:
     sf::RectangleShape shape; // Player shape
     double posX;
     double posY;             // Player position
+    double previousPosY;     // Position at the previous simulation step (for render interpolation)
     double velocityY;         // Vertical velocity for jumping
     bool isJumping;           // Jumping status
     bool isDucking;            // Ducking status
@@ -34,18 +38,53 @@ private:
 
     // ===== Sprite System =====
     sf::Sprite currentSprite;
-    TextureManager::SpriteType currentSpriteType;
+    SpriteBatch spriteBatch;        // Batched draw path for dino_sheet sprites
 
     // ===== Animation System =====
-    double animationTimer;
-    bool isRunningAnimationFrame1;  // Toggle between running frames
+    AnimationPlayer animation;      // Current dino clip; its frame index is the stride phase
     
     // ===== Size Management =====
     sf::Vector2f targetSize;        // Size to scale sprites to
-    sf::RectangleShape headCollisionBox; // For head collision detection (invisible)
-    sf::RectangleShape bodyCollisionBox; // For bottom collision detection (invisible)
-    sf::RectangleShape tailCollisionBox; // For ducking collision detection (invisible)
-    sf::RectangleShape boundingBox; // Invisible rectangle for collision detection
+
+    // ===== Hitbox Table =====
+    static const int COLLISION_BOX_COUNT = 3;  // Head, body, tail
+    static const int HITBOX_STATE_COUNT = 4;   // Running, jumping, ducking, fast falling
+    static const int ANIMATION_FRAME_COUNT = 2;  // Frames of every dino clip
+
+    /**
+     * One collision box relative to the player position (outline not included)
+     */
+    struct HitboxOffset {
+        double offsetX;     // From posX
+        double offsetY;     // From posY
+        float width;
+        float height;
+    };
+
+    /**
+     * Head, body and tail boxes of one (state, animation frame) pair
+     */
+    struct HitboxSet {
+        HitboxOffset boxes[COLLISION_BOX_COUNT];
+    };
+
+    /**
+     * Every hitbox set, indexed by [state][animation frame]
+     * State order: running, jumping, ducking, fast falling
+     */
+    struct HitboxTable {
+        HitboxSet entries[HITBOX_STATE_COUNT][ANIMATION_FRAME_COUNT];
+    };
+
+    static const HitboxTable HITBOX_TABLE;      // Built once at startup from the *_RATIO constants
+    const HitboxSet* currentHitboxes;           // Table entry of the current state and frame
+    Aabb collisionBoxes[COLLISION_BOX_COUNT];   // Current head, body, tail boxes (outline included)
+
+    // ===== Debug Shapes (synced from the boxes only when they are drawn or requested) =====
+    sf::RectangleShape headCollisionBox;        // Blue outline
+    sf::RectangleShape bodyCollisionBox;        // Red outline
+    sf::RectangleShape tailCollisionBox;        // Green outline
+    mutable sf::RectangleShape boundingBox;     // Legacy single box (follows the body box)
 
     // ===== Triple Collision Box Constants =====
     static const double HEAD_WIDTH_RATIO;     // Head box width ratio (0.5)
@@ -54,23 +93,42 @@ private:
     static const double BODY_HEIGHT_RATIO;    // Body box height ratio (0.5)
     static const double TAIL_WIDTH_RATIO;     // Tail box width ratio (0.4)
     static const double TAIL_HEIGHT_RATIO;    // Tail box height ratio (0.3)
+    static const float COLLISION_OUTLINE_THICKNESS; // Collision box outline (part of the hit box)
 
     // ===== Physics Constants =====
     static const double GROUND_Y;
-    static const double JUMP_STRENGTH;
-    static const double GRAVITY;
+    static constexpr double JUMP_STRENGTH = -400.0; // Initial jump velocity
+    static constexpr double GRAVITY = 700.0;        // Gravity acceleration
     static const double FAST_FALL_MULTIPLIER;        // Enhanced gravity multiplier for fast falling
     static const double FAST_FALL_TERMINAL_VELOCITY; // Maximum fall speed when fast falling
 
-    // ===== Animation Constants =====
-    static const double RUNNING_ANIMATION_SPEED;  // Frames per second for running
+    // ===== Size Constants =====
     static const sf::Vector2f DEFAULT_SIZE;      // Default player size (matches original rectangle)
+    static const sf::Vector2f DUCKING_SIZE;      // Size while ducking or fast falling (duck sprite at 3/4 scale)
+    static constexpr double DEFAULT_WIDTH = 60.0; // DEFAULT_SIZE.x, usable in constant expressions
 
     // ===== runtime debugging =====
     bool debugMode;
 
 
 public:
+    /**
+     * Simulation state of the player (trivially copyable, for SimulationSnapshot)
+     * Sprite, collision boxes and debug shapes are derived from it on restore
+     */
+    struct Snapshot {
+        double posX;
+        double posY;
+        double previousPosY;
+        double velocityY;
+        AnimationPlayer::State animation;
+        sf::Vector2f targetSize;
+        bool isJumping;
+        bool isDucking;
+        bool isFastFalling;
+        bool duckPressed;
+    };
+
     /**
      * Constructor: Initialize player with sprite support
      * 
@@ -113,10 +171,12 @@ public:
 
     /**
      * Render the player sprite to the window
+     * The sprite is drawn between the previous and current simulation positions
      * 
      * @param window SFML render window
+     * @param alpha Interpolation factor (0 = previous step, 1 = current step)
      */
-    void render(sf::RenderWindow& window); 
+    void render(sf::RenderWindow& window, double alpha = 1.0); 
 
     /**
      * Reset player to initial state
@@ -124,43 +184,40 @@ public:
      */
     void reset();                   
 
-    // ===== Information Methods (const: guaranteed not to modify data) =====
-
     /**
-     * Get the head collision box (upper small area)
-     * Used for precise head collision detection
+     * Copy the simulation state into a snapshot
      * 
-     * @return Reference to head collision rectangle
+     * @param snapshot Destination
      */
-    const sf::RectangleShape& getHeadCollisionBox() const;
-    
+    void saveSnapshot(Snapshot& snapshot) const;
+
     /**
-     * Get the body collision box (main torso area)
-     * Used for primary body collision detection
+     * Continue from a snapshot (sprite and collision boxes are resynced)
      * 
-     * @return Reference to body collision rectangle
+     * @param snapshot State from saveSnapshot()
      */
-    const sf::RectangleShape& getBodyCollisionBox() const;
-    
+    void restoreSnapshot(const Snapshot& snapshot);
+
+    // ===== Information Methods (const: guaranteed not to modify data) =====
+
     /**
-     * Get the tail collision box (lower back area)
-     * Used for ducking collision detection
+     * Get head, body and tail collision boxes as POD edges
+     * Same extents as the debug outlines drawn for each box
      * 
-     * @return Reference to tail collision rectangle
+     * @param boxes Receives head, body and tail boxes in that order
      */
-    const sf::RectangleShape& getTailCollisionBox() const;
+    void getCollisionAabbs(Aabb boxes[3]) const;
     
     /**
-     * Get all collision boxes as a vector
-     * Useful for collision managers that check multiple areas
+     * Get head, body and tail collision boxes without copying
      * 
-     * @return Vector containing all three collision boxes
+     * @return View of the three boxes (valid until the player next changes state or moves)
      */
-    std::vector<sf::RectangleShape> getAllCollisionBoxes() const;
+    AabbSpan getCollisionBoxes() const;
     
     /**
-     * Get the collision bounding box (for collision detection)
-     * Returns invisible rectangle that matches sprite bounds
+     * Get the legacy single collision box (for the legacy collision methods)
+     * Built on request from the body box
      * 
      * @return Reference to bounding box rectangle
      */
@@ -172,7 +229,26 @@ public:
      * @return Reference to current sprite
      */
     const sf::Sprite& getSprite() const;
-
+    
+    /**
+     * Get the sprite type currently shown
+     * 
+     * @return Current sprite type
+     */
+    TextureManager::SpriteType getSpriteType() const;
+    
+    /**
+     * Get the size the current sprite is drawn at (texture rectangle times scale)
+     * 
+     * @return Drawn size, (0, 0) if no texture serves the sprite
+     */
+    sf::Vector2f getSpriteSize() const;
+    
+    /**
+     * Prepare TextureManager collision masks for every player sprite at every player size
+     * Needed once at startup before pixel collision is used
+     */
+    static void prepareCollisionMasks();
     
     /**
      * Check if player is currently jumping
@@ -208,6 +284,42 @@ public:
      * @return Y coordinate
      */
     double getPosY() const;
+    
+    /**
+     * Get Y position at the previous simulation step
+     * 
+     * @return Y coordinate one tick ago (render interpolation)
+     */
+    double getPreviousPosY() const;
+
+    /**
+     * Get current vertical velocity
+     * 
+     * @return Velocity in px/s (negative while rising)
+     */
+    double getVelocityY() const;
+
+    /**
+     * Get the longest obstacle run a full jump (no fast fall) clears at an obstacle speed
+     * Distance the obstacles travel during the air time, less the player's width
+     * constexpr so obstacle patterns can be checked against the physics at compile time
+     * 
+     * @param obstacleSpeed Obstacle speed (px/s)
+     * @return Clearable span in px
+     */
+    static constexpr double getJumpClearance(double obstacleSpeed) {
+        return obstacleSpeed * (-2.0 * JUMP_STRENGTH / GRAVITY) - DEFAULT_WIDTH;
+    }
+
+    /**
+     * Get the ground the player needs between two obstacle runs to land and jump again
+     * constexpr for the same compile-time pattern checks as getJumpClearance()
+     * 
+     * @return Player width in px
+     */
+    static constexpr double getLandingRoom() {
+        return DEFAULT_WIDTH;
+    }
 
     /**
      * Get player's current size
@@ -216,6 +328,20 @@ public:
      */
     sf::Vector2f getSize() const;
 
+    /**
+     * Get size while standing, running or jumping
+     * 
+     * @return Size vector (width, height)
+     */
+    static sf::Vector2f getDefaultSize();
+
+    /**
+     * Get size while ducking or fast falling
+     * 
+     * @return Size vector (width, height)
+     */
+    static sf::Vector2f getDuckingSize();
+
     // ===== Debugging Methods =====
         /**
      * Toggle debug collision box visibility
@@ -241,29 +367,29 @@ private:
     
     /**
      * Update the player's sprite based on current state
-     * Chooses appropriate sprite (running, jumping, ducking) and applies it
+     * Chooses appropriate clip (running, jumping, ducking) and applies it
      */
     void updateSprite();
     
     /**
      * Update running animation frame
-     * Cycles between running frames for smooth animation
+     * Advances the current clip and touches the sprite only when its frame flips
      * 
      * @param deltaTime Time elapsed since last frame
      */
     void updateRunningAnimation(float deltaTime);
     
     /**
-     * Apply the current sprite to the sprite object
-     * Handles texture loading, scaling, and positioning
+     * Continue the stride in another clip and show its frame
+     * 
+     * @param clipId Clip matching the new state
      */
-    void applySpriteType(TextureManager::SpriteType spriteType);
+    void applyClip(AnimationClip::Id clipId);
     
     /**
-     * Update the invisible bounding box for collision detection
-     * Ensures collision box matches sprite position and size
+     * Copy the shown frame into the sprite: texture rectangle, scale to targetSize, position
      */
-    void updateBoundingBox();
+    void syncSpriteFrame();
     
     /**
      * Initialize sprite system
@@ -274,40 +400,51 @@ private:
     // ===== Triple Collision Box Management =====
     
     /**
-     * Initialize all three collision boxes with proper visual debugging properties
-     * Sets up colors, transparency, and outline for debugging visualization
+     * Initialize the debug shapes of all collision boxes (colors, transparency, outline)
      */
     void initializeTripleCollisionBoxes();
     
     /**
-     * Update all collision boxes based on current player state
-     * Handles position, size, and state-specific adjustments
+     * Select the hitbox table entry for the current state and animation frame
+     * and translate it to the current position
      */
     void updateTripleCollisionBoxes();
     
     /**
-     * Update collision boxes for normal standing/running state
-     * Standard three-box configuration for regular gameplay
+     * Copy the current boxes into the debug shapes (debug drawing only)
+     */
+    void syncDebugBoxes();
+    
+    /**
+     * Build the hitbox table (startup only)
+     * 
+     * @return Boxes of every state and animation frame
      */
-    void updateNormalStateCollision();
+    static HitboxTable buildHitboxTable();
     
     /**
-     * Update collision boxes for ducking state
-     * Adjusts boxes for lowered profile when ducking
+     * Compute boxes for standing, running or jumping
+     * 
+     * @param size Player size the boxes scale with
+     * @return Head, body and tail boxes
      */
-    void updateDuckingStateCollision();
+    static HitboxSet computeNormalHitboxes(const sf::Vector2f& size);
     
     /**
-     * Update collision boxes for jumping state
-     * Maintains boxes during aerial movement
+     * Compute boxes for ground ducking (lowered profile)
+     * 
+     * @param size Player size the boxes scale with
+     * @return Head, body and tail boxes
      */
-    void updateJumpingStateCollision();
+    static HitboxSet computeDuckingHitboxes(const sf::Vector2f& size);
     
     /**
-     * Update legacy bounding box for backward compatibility
-     * Synchronizes legacy box with body collision box
+     * Compute boxes for fast falling: the jumping boxes at duck size, shifted down
+     * with a narrower tail at the back
+     * 
+     * @return Head, body and tail boxes
      */
-    void updateLegacyBoundingBox();
+    static HitboxSet computeFastFallHitboxes();
 
 };
 
@@ -0,0 +1,67 @@
+#ifndef RENDER_SNAPSHOT_HPP
+#define RENDER_SNAPSHOT_HPP
+
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "TextureManager.hpp"
+#include "Obstacle.hpp"
+#include "ParallaxBackground.hpp"
+
+/**
+ * RenderSnapshot struct: Everything one frame draws, copied out of the simulation after a tick
+ *
+ * Design Philosophy:
+ * - Plain values only: the render thread never touches Player, ObstacleManager or Game state
+ * - Previous and current positions are both kept, so the render thread can
+ *   interpolate between the last two ticks like the single-threaded loop does
+ * - Lives in a TripleBuffer slot and is refilled in place (obstacles keeps its capacity)
+ */
+struct RenderSnapshot {
+    /**
+     * One obstacle as drawn
+     */
+    struct ObstacleView {
+        float x;                        // Sprite left edge at the current tick
+        float previousX;                // Sprite left edge at the previous tick
+        float y;                        // Sprite top edge
+        Obstacle::ObstacleType type;    // Indexes Obstacle::getTypeInfo()
+    };
+
+    static const size_t OBSTACLE_RESERVE = 64;   // Initial capacity (far above the on-screen peak)
+
+    // ===== Timing =====
+    uint64_t tick;                                      // Simulation ticks when captured
+    std::chrono::steady_clock::time_point capturedAt;   // Real time the current tick stands for
+    double tickDuration;                                // Seconds per tick (interpolation span)
+
+    // ===== Player =====
+    float playerX;
+    float playerY;                                      // Sprite top edge at the current tick
+    float previousPlayerY;                              // Sprite top edge at the previous tick
+    TextureManager::SpriteType playerSprite;
+    sf::Vector2f playerSize;                            // Drawn sprite size
+
+    // ===== World =====
+    std::vector<ObstacleView> obstacles;
+    float sceneryOffsets[ParallaxBackground::LAYER_COUNT];          // At the current tick
+    float previousSceneryOffsets[ParallaxBackground::LAYER_COUNT];  // At the previous tick
+
+    // ===== HUD =====
+    int score;
+    int highScore;
+    bool gameOver;
+
+    RenderSnapshot() : tick(0), tickDuration(0.0), playerX(0.0f), playerY(0.0f), previousPlayerY(0.0f),
+                       playerSprite(TextureManager::SpriteType::DINO_RUNNING_1), playerSize(0.0f, 0.0f),
+                       score(0), highScore(0), gameOver(false) {
+        obstacles.reserve(OBSTACLE_RESERVE);
+        for (int i = 0; i < ParallaxBackground::LAYER_COUNT; ++i) {
+            sceneryOffsets[i] = 0.0f;
+            previousSceneryOffsets[i] = 0.0f;
+        }
+    }
+};
+
+#endif // RENDER_SNAPSHOT_HPP
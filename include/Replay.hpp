@@ -0,0 +1,188 @@
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Replay class: Recorded input of a run, enough to simulate it again tick for tick
+ *
+ * Design Philosophy:
+ * - The simulation is deterministic for a given obstacle seed and tick rate,
+ *   so a replay stores only those plus the gameplay inputs and the tick each one arrived on
+ * - Inputs are applied between ticks, exactly where keyboard events land in the fixed-step loop
+ * - Compact file: every event is one varint of (ticks since previous event << 3 | input),
+ *   usually a single byte
+ *
+ * File layout (little-endian): Header | varint events[eventCount]
+ */
+class Replay {
+public:
+    /**
+     * Gameplay inputs (everything that changes the simulation)
+     */
+    enum class Input : unsigned char {
+        JUMP,               // Space / Up pressed
+        DUCK_START,         // Down pressed
+        DUCK_STOP,          // Down released
+        RESTART,            // New session after game over (R)
+        FORCE_GAME_OVER,    // Escape (debug)
+        REWIND,             // Back to a few seconds before the game over (Backspace, practice)
+        COUNT               // Number of inputs (not a real input)
+    };
+
+    static const uint32_t FORMAT_VERSION = 2;   // 2: PCG32 obstacle generator, REWIND input
+    static const uint32_t FLAG_AUTOPILOT = 1;   // Run was played by AutoPilot
+    static const uint32_t FLAG_PIXEL_COLLISION = 2;  // Run used the pixel collision narrow phase
+    static const int INPUT_BITS = 3;            // Low bits of an event varint holding the input
+    static const char MAGIC[8];                 // Expected Header::magic
+
+    /**
+     * File header (40 bytes)
+     */
+    struct Header {
+        char magic[8];          // "DINOREP\0"
+        uint32_t version;       // FORMAT_VERSION
+        uint32_t flags;         // FLAG_* bits
+        uint32_t seed;          // Obstacle random seed
+        uint32_t eventCount;    // Events following the header
+        double tickRate;        // Simulation steps per second
+        uint64_t tickCount;     // Ticks simulated when recording stopped
+    };
+
+    /**
+     * One input and the tick it is applied before
+     */
+    struct Event {
+        uint64_t tick;          // Number of ticks simulated before the input arrived
+        Input input;
+    };
+
+private:
+    Header header;
+    std::vector<Event> events;
+    size_t cursor;              // Next event for playback
+
+public:
+    /**
+     * Constructor: Create an empty replay
+     */
+    Replay();
+
+    // ===== Recording =====
+
+    /**
+     * Start a new recording (drops any recorded or loaded events)
+     *
+     * @param seed Obstacle seed of the run
+     * @param tickRate Simulation steps per second
+     * @param autopilot Whether AutoPilot plays the run
+     * @param pixelCollision Whether collisions use the sprite masks
+     */
+    void beginRecording(uint32_t seed, double tickRate, bool autopilot, bool pixelCollision = false);
+
+    /**
+     * Append an input
+     *
+     * @param tick Ticks simulated so far (must not decrease)
+     * @param input Input applied before the next tick
+     */
+    void record(uint64_t tick, Input input);
+
+    /**
+     * Write the recording to a file
+     *
+     * @param path Output file
+     * @param tickCount Ticks simulated by the end of the run
+     * @return true if the file was written
+     */
+    bool save(const std::string& path, uint64_t tickCount);
+
+    // ===== Playback =====
+
+    /**
+     * Read and validate a replay file
+     *
+     * @param path Replay file
+     * @return true if the replay can be played
+     */
+    bool load(const std::string& path);
+
+    /**
+     * Get the next input scheduled before a given tick
+     * Call repeatedly with the same tick until it returns false
+     *
+     * @param tick Ticks simulated so far
+     * @param input Receives the input
+     * @return true if an input was returned
+     */
+    bool nextInput(uint64_t tick, Input& input);
+
+    /**
+     * Check whether playback reached the recorded tick count
+     *
+     * @param tick Ticks simulated so far
+     * @return true once the replay has nothing left to apply
+     */
+    bool isFinished(uint64_t tick) const;
+
+    /**
+     * Restart playback from the first event
+     */
+    void rewind();
+
+    /**
+     * Continue playback from a tick (after restoring a snapshot of that tick)
+     *
+     * @param tick Next tick to simulate; its inputs are applied again
+     */
+    void seek(uint64_t tick);
+
+    // ===== Header Access =====
+
+    /**
+     * Get obstacle seed of the recorded run
+     *
+     * @return Seed passed to ObstacleManager::setSeed
+     */
+    uint32_t getSeed() const;
+
+    /**
+     * Get simulation rate of the recorded run
+     *
+     * @return Ticks per second
+     */
+    double getTickRate() const;
+
+    /**
+     * Check whether the run was played by AutoPilot
+     *
+     * @return true if AutoPilot has to be recreated for playback
+     */
+    bool isAutopilot() const;
+
+    /**
+     * Check whether the run used pixel-accurate collision
+     *
+     * @return true if playback needs the sprite masks to reproduce the run
+     */
+    bool isPixelCollision() const;
+
+    /**
+     * Get number of ticks in the recording
+     *
+     * @return Ticks simulated when recording stopped
+     */
+    uint64_t getTickCount() const;
+
+    /**
+     * Get number of recorded inputs
+     *
+     * @return Event count
+     */
+    size_t getEventCount() const;
+};
+
+#endif // REPLAY_HPP
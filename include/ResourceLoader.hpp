@@ -0,0 +1,123 @@
+#ifndef RESOURCE_LOADER_HPP
+#define RESOURCE_LOADER_HPP
+
+#include <functional>
+#include <future>
+#include <string>
+#include <vector>
+
+/**
+ * ResourceLoader class: Runs startup loading tasks in parallel
+ *
+ * Design Philosophy:
+ * - Each resource is split into a load step (file I/O, decoding) that runs on
+ *   its own worker thread, and a finish step that runs on the main thread
+ *   from poll() (GPU texture upload, attaching buffers to sounds)
+ * - REQUIRED resources gate the start of gameplay; OPTIONAL ones (sounds)
+ *   may finish while the game is already running
+ * - Load steps must not touch state the main thread uses until their finish step ran
+ */
+class ResourceLoader {
+public:
+    /**
+     * Whether gameplay has to wait for a resource
+     */
+    enum class Priority {
+        REQUIRED,   // Game starts only after this finished
+        OPTIONAL    // May finish after gameplay begins
+    };
+
+    typedef std::function<bool()> LoadStep;             // Worker thread: returns true on success
+    typedef std::function<void(bool)> FinishStep;       // Main thread: receives the load result
+
+private:
+    /**
+     * One queued resource
+     */
+    struct Task {
+        std::string name;               // For log output
+        Priority priority;
+        std::future<bool> result;       // Load step running on a worker
+        FinishStep finish;              // May be empty
+        bool finished;                  // Finish step already ran
+    };
+
+    std::vector<Task> tasks;
+    size_t requiredCount;               // REQUIRED tasks queued
+    size_t requiredFinished;            // REQUIRED tasks whose finish step ran
+    size_t finishedCount;               // All tasks whose finish step ran
+    size_t failedCount;                 // Load steps that returned false
+
+public:
+    ResourceLoader();
+
+    /**
+     * Destructor: waits for load steps that are still running
+     * (their finish steps are dropped)
+     */
+    ~ResourceLoader();
+
+    ResourceLoader(const ResourceLoader&) = delete;
+    ResourceLoader& operator=(const ResourceLoader&) = delete;
+
+    /**
+     * Queue a resource; its load step starts immediately on a worker thread
+     *
+     * @param name Resource name (log output)
+     * @param priority REQUIRED or OPTIONAL
+     * @param load Worker-thread step
+     * @param finish Main-thread step run from poll() (may be empty)
+     */
+    void add(const std::string& name, Priority priority, LoadStep load, FinishStep finish = FinishStep());
+
+    /**
+     * Run finish steps of every load step that completed (main thread only)
+     * Never blocks
+     *
+     * @return Number of finish steps run
+     */
+    size_t poll();
+
+    /**
+     * Block until every REQUIRED resource finished (main thread only)
+     */
+    void waitForRequired();
+
+    /**
+     * Check whether every REQUIRED resource finished
+     *
+     * @return true once gameplay may start
+     */
+    bool isRequiredReady() const;
+
+    /**
+     * Check whether every resource finished
+     *
+     * @return true when nothing is left to poll
+     */
+    bool isComplete() const;
+
+    /**
+     * Get fraction of REQUIRED resources finished (loading screen progress)
+     *
+     * @return Progress from 0.0 to 1.0
+     */
+    float getRequiredProgress() const;
+
+    /**
+     * Get number of load steps that reported failure
+     *
+     * @return Failed resource count
+     */
+    size_t getFailedCount() const;
+
+private:
+    /**
+     * Collect a completed load result and run the task's finish step
+     *
+     * @param task Task whose future is ready
+     */
+    void finishTask(Task& task);
+};
+
+#endif // RESOURCE_LOADER_HPP
@@ -0,0 +1,179 @@
+#ifndef SCORE_JOURNAL_HPP
+#define SCORE_JOURNAL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * ScoreJournal class: Append-only file of finished runs plus an all-time summary
+ *
+ * Design Philosophy:
+ * - Every run is one fixed-size binary record appended to the file; nothing is rewritten
+ *   except the small header in front
+ * - The header carries the all-time summary (high score, runs, play time), so startup
+ *   reads 64 bytes instead of parsing the history
+ * - append() only queues the record: a background writer thread does the file I/O,
+ *   so a game over never waits for the disk
+ * - When the file passes COMPACT_THRESHOLD_BYTES the writer keeps only the newest
+ *   COMPACT_KEEP_RECORDS records; the summary in the header still covers every run
+ *
+ * File layout (little-endian): Header | Record records[recordCount]
+ * Records past recordCount (written before a crash, header not yet updated) are
+ * folded into the summary on open().
+ */
+class ScoreJournal {
+public:
+    static const uint32_t FORMAT_VERSION = 1;
+    static const uint32_t FLAG_AUTOPILOT = 1;               // Run was played by AutoPilot
+    static const size_t PATTERN_NAME_SIZE = 32;             // Bytes for the death pattern name (null padded)
+    static const uint64_t COMPACT_THRESHOLD_BYTES = 1 << 20;    // File size that triggers compaction (~16k runs)
+    static const uint64_t COMPACT_KEEP_RECORDS = 1024;      // Newest records kept by compaction
+    static const char MAGIC[8];                             // Expected Header::magic
+    static const std::string DEFAULT_PATH;                  // Journal location used by the game
+
+    /**
+     * All-time statistics (24 bytes, stored in the header)
+     */
+    struct Summary {
+        uint64_t totalRuns;     // Runs ever journaled (compaction keeps counting)
+        double totalSeconds;    // Play time of all runs
+        int32_t highScore;      // Best score of all runs
+        float peakSpeed;        // Fastest obstacle speed reached (px/s)
+    };
+
+    /**
+     * File header (64 bytes)
+     */
+    struct Header {
+        char magic[8];          // "DINOJRN\0"
+        uint32_t version;       // FORMAT_VERSION
+        uint32_t recordSize;    // sizeof(Record)
+        uint64_t recordCount;   // Records following the header
+        Summary summary;
+        uint8_t reserved[16];
+    };
+
+    /**
+     * One finished run (64 bytes)
+     */
+    struct Record {
+        int64_t endedAt;                        // Unix time of the game over
+        uint32_t seed;                          // Obstacle seed of the run
+        int32_t score;
+        float durationSeconds;                  // Simulated time from start to game over
+        float peakSpeed;                        // Fastest obstacle speed of the run (px/s)
+        uint32_t flags;                         // FLAG_* bits
+        uint32_t reserved;
+        char deathPattern[PATTERN_NAME_SIZE];   // ObstacleManager::getCurrentPatternName() at the game over
+    };
+
+private:
+    std::string path;
+    Summary summary;                    // Main thread view, includes queued records
+    bool opened;
+
+    // ===== Write-Behind Queue =====
+    std::thread writerThread;
+    std::mutex queueMutex;              // Guards pending and stopping
+    std::condition_variable queueReady;
+    std::vector<Record> pending;        // Records not yet handed to the writer
+    bool stopping;
+
+    // ===== Writer Thread State =====
+    Header fileHeader;                  // Header as it is (or will be) on disk
+
+public:
+    /**
+     * Constructor: Create a closed journal (append() drops records until open())
+     */
+    ScoreJournal();
+
+    /**
+     * Destructor: Write every queued record, then stop the writer thread
+     */
+    ~ScoreJournal();
+
+    ScoreJournal(const ScoreJournal&) = delete;
+    ScoreJournal& operator=(const ScoreJournal&) = delete;
+
+    /**
+     * Read the summary of a journal file and start the writer thread
+     * A missing file is fine (created on the first append); a file with an
+     * unknown format is left untouched and the journal stays closed
+     *
+     * @param journalPath Journal file
+     * @return true if runs will be journaled
+     */
+    bool open(const std::string& journalPath);
+
+    /**
+     * Queue a finished run (never blocks on disk I/O)
+     *
+     * @param record Run to append
+     */
+    void append(const Record& record);
+
+    /**
+     * Get the all-time statistics, including runs still queued
+     *
+     * @return Summary (all zero for a new journal)
+     */
+    const Summary& getSummary() const;
+
+    /**
+     * Check whether open() succeeded
+     *
+     * @return true if runs are journaled
+     */
+    bool isOpen() const;
+
+    /**
+     * Build a record for a finished run
+     *
+     * @param score Final score
+     * @param durationSeconds Simulated run length
+     * @param peakSpeed Fastest obstacle speed of the run
+     * @param deathPattern Pattern active at the game over (truncated to fit)
+     * @param seed Obstacle seed
+     * @param autopilot Whether AutoPilot played
+     * @return Record stamped with the current time
+     */
+    static Record makeRecord(int score, double durationSeconds, double peakSpeed,
+                             const std::string& deathPattern, uint32_t seed, bool autopilot);
+
+private:
+    /**
+     * Writer thread body: write queued batches until stopped and drained
+     */
+    void writerLoop();
+
+    /**
+     * Append records and rewrite the header (writer thread only)
+     *
+     * @param records Records to write
+     * @return true if the file was updated
+     */
+    bool writeRecords(const std::vector<Record>& records);
+
+    /**
+     * Replace the file with a copy holding only the newest records (writer thread only)
+     *
+     * @return true if the journal was compacted
+     */
+    bool compact();
+
+    /**
+     * Fold one run into a summary
+     *
+     * @param target Summary to update
+     * @param record Finished run
+     */
+    static void addToSummary(Summary& target, const Record& record);
+};
+
+#endif // SCORE_JOURNAL_HPP
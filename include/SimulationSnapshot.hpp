@@ -0,0 +1,33 @@
+#ifndef SIMULATION_SNAPSHOT_HPP
+#define SIMULATION_SNAPSHOT_HPP
+
+#include <type_traits>
+#include "Player.hpp"
+#include "ObstacleManager.hpp"
+
+/**
+ * Everything the simulation needs to continue from one tick (about 1.4 KB)
+ *
+ * Plain data of fixed size: copied into SnapshotRing slots every tick and back
+ * on rewind, restart and replay seeking, never heap allocated. Derived state
+ * (sprites, collision boxes, the pattern selection table) is rebuilt on restore.
+ * Only valid within the process that captured it (the animation clip is a pointer).
+ */
+struct SimulationSnapshot {
+    long long tick;                     // Game::simulationTick after the captured tick (next tick to run)
+    int session;                        // Game::sessionCount (rewinds never cross a restart)
+    int gameState;                      // Game::GameState
+    long long runTick;                  // Game::runTick (ghost position)
+    double gameTime;                    // Run time (score and difficulty)
+    int score;
+    int lastScoreMilestone;
+    double runPeakSpeed;
+    bool practiceRun;                   // Game::runRewound
+    Player::Snapshot player;
+    ObstacleManager::Snapshot obstacles;
+};
+
+static_assert(std::is_trivially_copyable<SimulationSnapshot>::value,
+              "Simulation snapshots are copied as raw memory");
+
+#endif // SIMULATION_SNAPSHOT_HPP
@@ -0,0 +1,94 @@
+#ifndef SNAPSHOT_RING_HPP
+#define SNAPSHOT_RING_HPP
+
+#include <cstddef>
+#include <memory>
+#include "SimulationSnapshot.hpp"
+
+/**
+ * SnapshotRing class: Fixed number of the newest SimulationSnapshots
+ *
+ * Design Philosophy:
+ * - Storage is allocated once at construction; push() hands out the slot of the
+ *   oldest snapshot when full, so capturing never allocates
+ * - Snapshots are written straight into their slot (no temporary copy)
+ * - Pushed ticks only grow: after restoring an older snapshot, the newer ones
+ *   are dropped with dropAfter() before capturing continues
+ */
+class SnapshotRing {
+private:
+    std::unique_ptr<SimulationSnapshot[]> slots;
+    size_t capacity;
+    size_t head;            // Slot of the oldest snapshot
+    size_t count;           // Snapshots held
+
+public:
+    /**
+     * Constructor: Allocate every slot
+     *
+     * @param slotCount Snapshots the ring holds
+     */
+    explicit SnapshotRing(size_t slotCount);
+
+    /**
+     * Get the slot for a new newest snapshot (overwrites the oldest when full)
+     *
+     * @return Slot to fill
+     */
+    SimulationSnapshot& push();
+
+    /**
+     * Get a snapshot counted from the newest
+     *
+     * @param back 0 = newest, 1 = the one before, ...
+     * @return Snapshot, or nullptr if the ring holds fewer
+     */
+    const SimulationSnapshot* fromNewest(size_t back) const;
+
+    /**
+     * Find the newest snapshot captured at or before a tick
+     *
+     * @param tick Simulation tick
+     * @return Snapshot, or nullptr if every snapshot is newer
+     */
+    const SimulationSnapshot* findAtOrBefore(long long tick) const;
+
+    /**
+     * Forget every snapshot newer than a tick
+     *
+     * @param tick Last tick to keep
+     */
+    void dropAfter(long long tick);
+
+    /**
+     * Forget every snapshot
+     */
+    void clear();
+
+    /**
+     * Get number of snapshots held
+     *
+     * @return Snapshot count
+     */
+    size_t size() const;
+
+    /**
+     * Get number of snapshots the ring can hold
+     *
+     * @return Slot count
+     */
+    size_t getCapacity() const;
+
+private:
+    /**
+     * Get a snapshot by age
+     *
+     * @param index 0 = oldest (must be below size())
+     * @return Snapshot
+     */
+    const SimulationSnapshot& at(size_t index) const {
+        return slots[(head + index) % capacity];
+    }
+};
+
+#endif // SNAPSHOT_RING_HPP
@@ -0,0 +1,91 @@
+#ifndef SPRITE_BATCH_HPP
+#define SPRITE_BATCH_HPP
+
+#include <SFML/Graphics.hpp>
+
+/**
+ * SpriteBatch class: Collects many sprites from one sprite sheet into a single vertex array
+ * 
+ * Design Philosophy:
+ * - One batch per sprite sheet, rebuilt every frame
+ * - All queued sprites are submitted with a single draw call
+ * - Vertex storage is reused between frames (clear keeps capacity)
+ * 
+ * Drawing each sf::Sprite on its own costs one draw call per sprite, which is
+ * the first limit low-end GPUs hit once many obstacles are on screen. Since every
+ * obstacle comes from obstacles_sheet.png (and the dino from dino_sheet.png),
+ * their quads can share one texture and one draw call.
+ */
+class SpriteBatch {
+private:
+    sf::VertexArray vertices;       // Two triangles per queued sprite
+    const sf::Texture* texture;     // Sprite sheet shared by every queued sprite
+    size_t spriteCount;             // Number of sprites queued since last clear
+
+public:
+    /**
+     * Constructor: Create an empty batch with no texture bound
+     */
+    SpriteBatch();
+    
+    /**
+     * Remove all queued sprites (keeps allocated vertex storage)
+     * Call once at the start of every frame before adding sprites
+     */
+    void clear();
+    
+    /**
+     * Queue a sprite using its texture, texture rectangle and transform
+     * The first queued sprite decides the batch texture; sprites from a
+     * different texture (or without one) are rejected
+     * 
+     * @param sprite Sprite to append
+     * @return true if the sprite was added to the batch
+     */
+    bool add(const sf::Sprite& sprite);
+    
+    /**
+     * Queue an axis-aligned textured quad without building an sf::Sprite
+     * 
+     * @param sheet Texture the quad samples from
+     * @param textureRect Area of the sheet to draw
+     * @param position Top-left corner on screen
+     * @param size Size on screen in pixels
+     * @param color Vertex color (used for tinting or translucency)
+     * @return true if the quad was added to the batch
+     */
+    bool add(const sf::Texture* sheet, const sf::IntRect& textureRect,
+             const sf::Vector2f& position, const sf::Vector2f& size,
+             const sf::Color& color = sf::Color::White);
+    
+    /**
+     * Submit every queued sprite with one draw call
+     * 
+     * @param target Render target (usually the game window)
+     */
+    void draw(sf::RenderTarget& target) const;
+    
+    /**
+     * Get number of sprites queued since last clear
+     * 
+     * @return Queued sprite count
+     */
+    size_t getSpriteCount() const;
+
+private:
+    /**
+     * Bind the batch texture or verify the incoming one matches it
+     * 
+     * @param sheet Texture of the sprite being added
+     * @return true if the sprite can join this batch
+     */
+    bool acceptTexture(const sf::Texture* sheet);
+    
+    /**
+     * Append the two triangles of a quad
+     * Corner order: top-left, top-right, bottom-right, bottom-left
+     */
+    void appendQuad(const sf::Vector2f corners[4], const sf::FloatRect& texCoords, const sf::Color& color);
+};
+
+#endif // SPRITE_BATCH_HPP
@@ -0,0 +1,297 @@
+#ifndef STATE_STREAM_HPP
+#define STATE_STREAM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Obstacle.hpp"
+
+class Player;
+class ObstacleManager;
+
+/**
+ * StateStream class: Per-tick world state as a compact byte stream (spectators, ghost runs)
+ *
+ * Design Philosophy:
+ * - Everything is quantized (player y to 1/4 px, speed to 1/16 px/s, obstacle x to 1/8 px)
+ *   and only changes are written: a tick where nothing but the obstacles moved is one byte
+ * - Obstacle motion is not sent: every obstacle moves at the shared speed, so a tick only
+ *   carries spawns (type and position once) and how many obstacles retired on the left
+ * - The encoder keeps a mirror of what the decoder will reconstruct and checks it after every
+ *   tick; whenever the mirror drifts or disagrees (session restart, rare reordering) it writes
+ *   a keyframe with the absolute state instead of a delta
+ * - Keyframes also come every KEYFRAME_INTERVAL ticks, so a spectator can join at any
+ *   keyframe offset without the history before it
+ *
+ * Tick layout: header byte (BIT_* flags), then the fields the bits announce, in bit order.
+ * File layout (little-endian): Header | stream bytes[byteCount]
+ */
+class StateStream {
+public:
+    static const uint32_t FORMAT_VERSION = 1;
+    static const char MAGIC[8];                     // Expected Header::magic
+    static const uint32_t KEYFRAME_INTERVAL = 240;  // Ticks between forced keyframes (2 s at 120 Hz)
+
+    // ===== Quantization =====
+    static const int POSITION_Y_SCALE = 4;          // Player and obstacle y steps per pixel
+    static const int POSITION_X_SCALE = 8;          // Obstacle x steps per pixel
+    static const int SPEED_SCALE = 16;              // Speed steps per px/s
+    static const float MAX_DRIFT;                   // Mirror error (px) that forces a keyframe
+
+    // ===== Tick Header Bits =====
+    static const uint8_t BIT_PLAYER_Y = 1;          // zigzag varint: change of quantized player y
+    static const uint8_t BIT_FLAGS = 2;             // byte: new player flags (FLAG_*)
+    static const uint8_t BIT_SPEED = 4;             // zigzag varint: change of quantized speed
+    static const uint8_t BIT_SPAWN = 8;             // varint count, then type byte, varint x, zigzag y per spawn
+    static const uint8_t BIT_RETIRE = 16;           // varint: obstacles retired on the left
+    static const uint8_t BIT_HOLD = 32;             // World did not move this tick (game over screen)
+    static const uint8_t BIT_KEYFRAME = 64;         // Absolute state follows instead of the fields above
+
+    // ===== Player Flags =====
+    static const uint8_t FLAG_SPRITE_MASK = 15;     // Low bits: TextureManager::SpriteType shown
+    static const uint8_t FLAG_SMALL = 16;           // Drawn at the ducking size
+    static const uint8_t FLAG_GAME_OVER = 32;       // Run has ended
+
+    /**
+     * File header (40 bytes)
+     */
+    struct Header {
+        char magic[8];              // "DINOSTR\0"
+        uint32_t version;           // FORMAT_VERSION
+        uint32_t keyframeInterval;  // KEYFRAME_INTERVAL of the encoder
+        double tickRate;            // Simulation steps per second
+        uint64_t tickCount;         // Ticks in the stream
+        uint64_t byteCount;         // Stream bytes following the header
+    };
+
+    /**
+     * One obstacle of the reconstructed world
+     */
+    struct ObstacleState {
+        Obstacle::ObstacleType type;
+        float x;                // Sprite left edge
+        float y;                // Sprite top edge
+    };
+
+    /**
+     * Reconstructed world at one tick
+     */
+    struct State {
+        uint64_t tick;                          // Tick number (0 = first encoded tick)
+        float playerX;
+        float playerY;                          // Sprite top edge at this tick
+        float previousPlayerY;                  // At the tick before (render interpolation)
+        uint8_t flags;                          // FLAG_* bits
+        float speed;                            // Obstacle speed (px/s)
+        std::vector<ObstacleState> obstacles;   // Sorted by x
+
+        State() : tick(0), playerX(0.0f), playerY(0.0f), previousPlayerY(0.0f), flags(0), speed(0.0f) {}
+    };
+
+private:
+    Header header;
+    std::vector<uint8_t> bytes;
+    double tickDuration;            // 1 / tickRate
+
+    // ===== Quantized World (encoder mirror, decoder state) =====
+    State state;
+    State backup;                   // Mirror before the current tick (encoder keyframe fallback)
+    State observed;                 // Real world of the tick being encoded
+    std::vector<ObstacleState> spawnScratch;
+    std::vector<ObstacleState> keyframeScratch;
+    int32_t playerYSteps;
+    int32_t speedSteps;
+    bool synced;                    // A keyframe has been applied (decoder) or written (encoder)
+    uint32_t ticksSinceKeyframe;
+    size_t lastKeyframeOffset;      // Byte offset of the newest keyframe
+
+    // ===== Decoder =====
+    size_t cursor;                  // Next byte to decode
+
+    /**
+     * Where a keyframe starts (seeking)
+     */
+    struct KeyframeEntry {
+        uint64_t ticksBefore;       // Ticks decoded before the keyframe tick
+        size_t offset;              // Byte offset of its tick header
+    };
+    std::vector<KeyframeEntry> keyframeIndex;   // Every keyframe of a loaded stream, in order
+
+    // ===== Statistics =====
+    uint64_t tickCount;             // Ticks encoded or decoded
+    uint64_t keyframeCount;
+
+public:
+    /**
+     * Constructor: Create an empty stream
+     */
+    StateStream();
+
+    // ===== Encoding =====
+
+    /**
+     * Start a new stream (drops any encoded or loaded bytes)
+     *
+     * @param tickRate Simulation steps per second
+     */
+    void beginEncoding(double tickRate);
+
+    /**
+     * Append the state after one simulation tick
+     *
+     * @param player Player after the tick
+     * @param obstacleManager Obstacles after the tick
+     * @param gameOver Whether the run has ended
+     * @param worldMoved Whether the obstacles were updated during the tick (false on the game over screen)
+     */
+    void encodeTick(const Player& player, const ObstacleManager& obstacleManager, bool gameOver, bool worldMoved);
+
+    /**
+     * Write the stream to a file
+     *
+     * @param path Output file
+     * @return true if the file was written
+     */
+    bool save(const std::string& path);
+
+    // ===== Decoding =====
+
+    /**
+     * Read and validate a stream file (decoding starts at its first byte)
+     *
+     * @param path Stream file
+     * @return true if the stream can be decoded
+     */
+    bool load(const std::string& path);
+
+    /**
+     * Append received bytes (live spectating; the first bytes must start at a keyframe)
+     *
+     * @param data Stream bytes
+     * @param size Number of bytes
+     */
+    void appendBytes(const uint8_t* data, size_t size);
+
+    /**
+     * Decode the next tick into getState()
+     *
+     * @return true if a tick was decoded, false at the end of the available bytes
+     */
+    bool decodeTick();
+
+    /**
+     * Restart decoding from the first byte
+     */
+    void rewind();
+
+    /**
+     * Decode up to a tick, starting from the nearest keyframe before it
+     * (or from the current tick when that is closer)
+     *
+     * @param ticks Ticks decoded afterwards (0 = before the first tick)
+     * @return true if the stream reached that tick, false if it ends earlier
+     */
+    bool seek(uint64_t ticks);
+
+    // ===== Access =====
+
+    /**
+     * Get the world after the last encoded or decoded tick
+     *
+     * @return Reconstructed state
+     */
+    const State& getState() const;
+
+    /**
+     * Get the encoded bytes
+     *
+     * @return Stream bytes (send from getLastKeyframeOffset() to a joining spectator)
+     */
+    const std::vector<uint8_t>& getBytes() const;
+
+    /**
+     * Get the byte offset of the newest keyframe
+     *
+     * @return Offset into getBytes()
+     */
+    size_t getLastKeyframeOffset() const;
+
+    /**
+     * Get simulation rate of the stream
+     *
+     * @return Ticks per second
+     */
+    double getTickRate() const;
+
+    /**
+     * Get number of ticks encoded or decoded
+     *
+     * @return Tick count
+     */
+    uint64_t getTickCount() const;
+
+    /**
+     * Get number of keyframes encoded or decoded
+     *
+     * @return Keyframe count
+     */
+    uint64_t getKeyframeCount() const;
+
+private:
+    /**
+     * Advance the quantized world by one tick the way the decoder does:
+     * player and speed, then obstacle motion, then spawns, then retires
+     *
+     * @param bits Tick header bits
+     * @param playerYDelta Change of quantized player y
+     * @param flags New flags (if BIT_FLAGS)
+     * @param speedDelta Change of quantized speed
+     * @param spawns Obstacles spawned this tick (quantized positions)
+     * @param retires Obstacles retired on the left
+     */
+    void applyDelta(uint8_t bits, int32_t playerYDelta, uint8_t flags, int32_t speedDelta,
+                    const std::vector<ObstacleState>& spawns, uint32_t retires);
+
+    /**
+     * Write an absolute state and make it the mirror
+     *
+     * @param target World to describe (player y and speed already quantized)
+     * @param targetYSteps Quantized player y
+     * @param targetSpeedSteps Quantized speed
+     */
+    void writeKeyframe(const State& target, int32_t targetYSteps, int32_t targetSpeedSteps);
+
+    /**
+     * Read one tick at the cursor and apply it
+     *
+     * @return true if a complete tick was read (cursor unchanged otherwise)
+     */
+    bool readTick();
+
+    /**
+     * Read an absolute state into the world
+     *
+     * @param position Byte just past the tick header (advanced past the keyframe)
+     * @return true if the keyframe was complete
+     */
+    bool readKeyframe(size_t& position);
+
+    /**
+     * Check whether the mirror matches the real world closely enough
+     *
+     * @param target Real world after the tick
+     * @return true if obstacle counts and types agree and positions are within MAX_DRIFT
+     */
+    bool mirrorMatches(const State& target) const;
+
+    /**
+     * Distance an obstacle travels in one tick at a quantized speed
+     *
+     * @param steps Quantized speed
+     * @return Pixels (same float rounding as ObstacleManager)
+     */
+    float tickTravel(int32_t steps) const;
+};
+
+#endif // STATE_STREAM_HPP
@@ -5,6 +5,10 @@
 #include <unordered_map>
 #include <string>
 #include <memory>
+#include <vector>
+#include "CollisionMask.hpp"
+
+class AssetBundle;
 
 /**
  * TextureManager class: Centralized texture and sprite management system
@@ -41,19 +45,46 @@ public:
         CLOUD,              // Cloud decoration
         BACKGROUND          // Background image
     };
+    
+    static const int SPRITE_TYPE_COUNT = 13;   // Number of SpriteType values
+    
+    /**
+     * Resolved sprite lookup: texture and rectangle for one SpriteType
+     * Rebuilt whenever textures or rectangles change, so render-time
+     * lookups are a single array index (no hashing, no strings)
+     */
+    struct SpriteHandle {
+        const sf::Texture* texture;     // nullptr if no texture serves this sprite
+        sf::IntRect rect;               // Area of the sprite in the texture
+        
+        SpriteHandle() : texture(nullptr) {}
+    };
+    
+    /**
+     * Opacity mask of one sprite at one drawn size (pixel collision)
+     */
+    struct SpriteCollisionMask {
+        SpriteType spriteType;
+        sf::Vector2i size;              // Drawn size in whole pixels
+        CollisionMask mask;             // Empty while no sheet with pixels backs the sprite
+    };
 
 private:
     // ===== Core Resource Storage =====
     std::unordered_map<std::string, std::unique_ptr<sf::Texture>> textures;
-    std::unordered_map<SpriteType, sf::IntRect> spriteRects;
+    std::unordered_map<SpriteType, sf::IntRect> spriteRects;     // Rectangles defined by the loaded sheets
+    SpriteHandle spriteHandles[SPRITE_TYPE_COUNT];              // Resolved per-type lookup (indexed by SpriteType)
+    
+    // ===== Collision Masks (built from decoded pixels at load time) =====
+    std::unordered_map<std::string, CollisionMask> textureMasks;  // Whole-texture masks of the loaded sheets
+    std::vector<SpriteCollisionMask> spriteCollisionMasks;       // Sprite masks at every prepared size
     
     // ===== Texture Paths Configuration =====
     static const std::unordered_map<SpriteType, std::string> SPRITE_PATHS;
-    static const std::unordered_map<SpriteType, sf::IntRect> DEFAULT_SPRITE_RECTS;
     
     // ===== Singleton Implementation =====
     static std::unique_ptr<TextureManager> instance;
-    TextureManager() = default;  // Private constructor
+    TextureManager();  // Private constructor
 
 public:
     // ===== Singleton Access =====
@@ -74,6 +105,15 @@ public:
      */
     bool initialize();
     
+    /**
+     * Finish sprite sheet setup after the sheets were loaded one by one
+     * (asynchronous startup): sheet rectangles if both sheets are present,
+     * colored fallbacks otherwise
+     * 
+     * @return true if sheets or fallback textures are ready
+     */
+    bool finishSheetLoading();
+    
     /**
      * Clean up all loaded textures and reset the manager
      * Call this when shutting down the game
@@ -92,6 +132,26 @@ public:
      */
     bool loadTexture(const std::string& name, const std::string& filepath);
     
+    /**
+     * Upload an already decoded image as a texture (main thread only)
+     * Lets worker threads do the decoding while only the upload runs here
+     * 
+     * @param name Unique identifier for the texture
+     * @param image Decoded image
+     * @param repeated Wrap texture coordinates outside the image (scrolling strips)
+     * @return true if the texture was created
+     */
+    bool loadTextureFromImage(const std::string& name, const sf::Image& image, bool repeated = false);
+    
+    /**
+     * Upload a pre-decoded image from an asset bundle as a texture
+     * 
+     * @param name Texture identifier, also the asset name in the bundle
+     * @param bundle Open asset bundle
+     * @return true if the asset exists and was uploaded
+     */
+    bool loadTextureFromBundle(const std::string& name, const AssetBundle& bundle);
+    
     /**
      * Load a sprite sheet and define sprite rectangles
      * Useful for loading multiple sprites from a single image file
@@ -133,6 +193,48 @@ public:
      */
     sf::IntRect getSpriteRect(SpriteType spriteType) const;
     
+    /**
+     * Get the resolved texture and rectangle for a sprite type
+     * Single indexed load; use this on per-frame paths
+     * 
+     * @param spriteType The type of sprite
+     * @return Handle valid until textures are loaded, created or cleaned up
+     */
+    const SpriteHandle& getSpriteHandle(SpriteType spriteType) const {
+        return spriteHandles[static_cast<int>(spriteType)];
+    }
+    
+    // ===== Collision Mask Methods =====
+    
+    /**
+     * Build (and keep rebuilt) the collision mask of a sprite at the size it is drawn at
+     * Call once per sprite and size at startup; masks follow later texture loads
+     * 
+     * @param spriteType The type of sprite
+     * @param renderSize Size the sprite is drawn at (rounded to whole pixels)
+     */
+    void prepareCollisionMask(SpriteType spriteType, const sf::Vector2f& renderSize);
+    
+    /**
+     * Get a prepared collision mask
+     * Fallback textures and textures without decoded pixels have no mask
+     * 
+     * @param spriteType The type of sprite
+     * @param renderSize Size the sprite is drawn at
+     * @return Mask, or nullptr if none was prepared or no sheet pixels back the sprite
+     */
+    const CollisionMask* getCollisionMask(SpriteType spriteType, const sf::Vector2f& renderSize) const;
+    
+    /**
+     * Copy the pixels of one sprite out of its texture (load time only: reads back from the GPU)
+     * Used to build derived textures such as the parallax cloud strip
+     * 
+     * @param spriteType The type of sprite
+     * @param image Receives the sprite pixels
+     * @return false if no sheet texture serves the sprite
+     */
+    bool copySpriteImage(SpriteType spriteType, sf::Image& image) const;
+    
     // ===== Sprite Creation Methods =====
     
     /**
@@ -190,6 +292,14 @@ public:
      */
     size_t getLoadedTextureCount() const;
     
+    /**
+     * Estimate GPU memory used by loaded textures
+     * Assumes 4 bytes (RGBA) per texel, no mipmaps
+     * 
+     * @return Estimated memory usage in bytes
+     */
+    size_t getTextureMemoryUsage() const;
+    
     /**
      * Print debug information about loaded textures
      * Shows memory usage and loaded texture list
@@ -208,6 +318,32 @@ private:
      */
     std::string getTextureNameForSprite(SpriteType spriteType) const;
     
+    /**
+     * Define the sprite sheet rectangles for every sprite the sheets contain
+     */
+    void applySheetSpriteRects();
+    
+    /**
+     * Rebuild spriteHandles from the loaded textures and defined rectangles
+     * Called after anything that changes textures or spriteRects
+     */
+    void resolveSpriteHandles();
+    
+    /**
+     * Rebuild every prepared sprite mask from the texture masks and sprite rectangles
+     * Called from resolveSpriteHandles()
+     */
+    void rebuildCollisionMasks();
+    
+    /**
+     * Build the whole-texture mask of a newly loaded texture
+     * 
+     * @param name Texture identifier
+     * @param pixels RGBA8 pixels of the texture
+     * @param size Texture size
+     */
+    void buildTextureMask(const std::string& name, const sf::Uint8* pixels, sf::Vector2u size);
+    
     /**
      * Load default textures and sprite definitions
      * Called during initialization to set up core game sprites
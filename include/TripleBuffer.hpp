@@ -0,0 +1,86 @@
+#ifndef TRIPLE_BUFFER_HPP
+#define TRIPLE_BUFFER_HPP
+
+#include <atomic>
+
+/**
+ * TripleBuffer class: Lock-free hand-off of the newest value from one writer thread to one reader thread
+ *
+ * Design Philosophy:
+ * - Three slots: the writer fills its back slot, the reader holds its front slot,
+ *   and the middle slot is swapped between them with a single atomic exchange
+ * - Neither side ever waits: the writer may publish faster than the reader reads
+ *   (older values are simply skipped), the reader may reread the same value
+ * - Slots are reused forever, so values that own memory (vectors) stop allocating
+ *   once their capacity has grown
+ *
+ * Exactly one thread may write and exactly one thread may read.
+ */
+template <typename T>
+class TripleBuffer {
+private:
+    static const unsigned int INDEX_MASK = 3u;  // Slot index bits of middle
+    static const unsigned int FRESH_BIT = 4u;   // Middle holds a value the reader has not taken yet
+
+    T slots[3];
+    std::atomic<unsigned int> middle;   // Slot in between, plus FRESH_BIT
+    unsigned int back;                  // Writer's slot
+    unsigned int front;                 // Reader's slot
+
+public:
+    /**
+     * Constructor: All slots default constructed, nothing published yet
+     */
+    TripleBuffer() : middle(1u), back(0u), front(2u) {}
+
+    // ===== Writer Side =====
+
+    /**
+     * Get the slot to fill before publish() (writer thread only)
+     * Holds whatever was written into it two publishes ago
+     *
+     * @return Writer's slot
+     */
+    T& writeBuffer() {
+        return slots[back];
+    }
+
+    /**
+     * Make the filled slot the newest value (writer thread only)
+     */
+    void publish() {
+        unsigned int previous = middle.exchange(back | FRESH_BIT, std::memory_order_acq_rel);
+        back = previous & INDEX_MASK;
+    }
+
+    // ===== Reader Side =====
+
+    /**
+     * Take the newest published value if there is one (reader thread only)
+     *
+     * @return true if readBuffer() now holds a value not seen before
+     */
+    bool fetch() {
+        if ((middle.load(std::memory_order_relaxed) & FRESH_BIT) == 0) {
+            return false;
+        }
+        unsigned int previous = middle.exchange(front, std::memory_order_acq_rel);
+        front = previous & INDEX_MASK;
+        return true;
+    }
+
+    /**
+     * Get the value taken by the last successful fetch() (reader thread only)
+     *
+     * @return Reader's slot (default constructed before the first fetch)
+     */
+    const T& readBuffer() const {
+        return slots[front];
+    }
+
+    // ===== Deleted Methods (slots are handed out by reference) =====
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+};
+
+#endif // TRIPLE_BUFFER_HPP
@@ -0,0 +1,99 @@
+#include "AllocationTracker.hpp"
+
+// ===== Static Member Definitions =====
+
+const bool AllocationTracker::ENABLED;
+
+#ifdef DINO_TRACK_ALLOCATIONS
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+// Plain integers, no constructors: usable from the very first allocation of any thread
+thread_local uint64_t threadAllocations = 0;
+std::atomic<uint64_t> totalAllocations(0);
+
+void* countedAllocate(std::size_t size) {
+    threadAllocations++;
+    totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    void* pointer = std::malloc(size ? size : 1);
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* countedAllocateNothrow(std::size_t size) noexcept {
+    threadAllocations++;
+    totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+} // namespace
+
+// ===== Global Allocation Replacements =====
+
+void* operator new(std::size_t size) {
+    return countedAllocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return countedAllocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocateNothrow(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocateNothrow(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+    std::free(pointer);
+}
+
+// ===== Counters =====
+
+uint64_t AllocationTracker::getThreadAllocations() {
+    return threadAllocations;
+}
+
+uint64_t AllocationTracker::getTotalAllocations() {
+    return totalAllocations.load(std::memory_order_relaxed);
+}
+
+#else
+
+uint64_t AllocationTracker::getThreadAllocations() {
+    return 0;
+}
+
+uint64_t AllocationTracker::getTotalAllocations() {
+    return 0;
+}
+
+#endif // DINO_TRACK_ALLOCATIONS
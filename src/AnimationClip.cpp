@@ -0,0 +1,76 @@
+#include "AnimationClip.hpp"
+
+// ===== Static Member Definitions =====
+
+const int AnimationClip::CLIP_COUNT;
+const int AnimationClip::MAX_FRAMES;
+
+namespace {
+
+typedef TextureManager::SpriteType Sprite;
+
+const float DINO_GAIT_FRAME = 1.0f / 8.0f;     // 8 stride frames per second
+const float BIRD_FLAP_FRAME = 1.0f / 6.0f;     // 6 wing frames per second
+
+/**
+ * Compile-time description of one clip
+ */
+struct ClipDefinition {
+    int frameCount;
+    Sprite sprites[AnimationClip::MAX_FRAMES];
+    float durations[AnimationClip::MAX_FRAMES];
+};
+
+// Indexed by AnimationClip::Id
+const ClipDefinition CLIP_DEFINITIONS[AnimationClip::CLIP_COUNT] = {
+    {2, {Sprite::DINO_RUNNING_1, Sprite::DINO_RUNNING_2}, {DINO_GAIT_FRAME, DINO_GAIT_FRAME}},  // DINO_RUN
+    {2, {Sprite::DINO_DUCKING_1, Sprite::DINO_DUCKING_2}, {DINO_GAIT_FRAME, DINO_GAIT_FRAME}},  // DINO_DUCK
+    {2, {Sprite::DINO_JUMPING, Sprite::DINO_JUMPING}, {DINO_GAIT_FRAME, DINO_GAIT_FRAME}},      // DINO_JUMP
+    {2, {Sprite::DINO_DUCKING_1, Sprite::DINO_DUCKING_1}, {DINO_GAIT_FRAME, DINO_GAIT_FRAME}},  // DINO_FAST_FALL
+    {2, {Sprite::BIRD_FLYING_1, Sprite::BIRD_FLYING_2}, {BIRD_FLAP_FRAME, BIRD_FLAP_FRAME}}     // BIRD_FLY
+};
+
+} // namespace
+
+// ===== Core Methods =====
+
+AnimationClip::AnimationClip() : frameCount(0) {
+    for (Frame& frame : frames) {
+        frame.spriteType = Sprite::DINO_RUNNING_1;
+        frame.duration = 0.0f;
+    }
+}
+
+const AnimationClip& AnimationClip::get(Id id) {
+    return library()[static_cast<int>(id)];
+}
+
+void AnimationClip::resolveAll(const TextureManager& textureManager) {
+    AnimationClip* clips = library();
+    for (int c = 0; c < CLIP_COUNT; ++c) {
+        for (int f = 0; f < clips[c].frameCount; ++f) {
+            Frame& frame = clips[c].frames[f];
+            frame.handle = textureManager.getSpriteHandle(frame.spriteType);
+        }
+    }
+}
+
+// ===== Private Helper Methods =====
+
+AnimationClip* AnimationClip::library() {
+    // Function-local static: built on first use from any thread, after all static initialization
+    static AnimationClip clips[CLIP_COUNT];
+    static bool built = [] {
+        for (int c = 0; c < CLIP_COUNT; ++c) {
+            const ClipDefinition& definition = CLIP_DEFINITIONS[c];
+            clips[c].frameCount = definition.frameCount;
+            for (int f = 0; f < definition.frameCount; ++f) {
+                clips[c].frames[f].spriteType = definition.sprites[f];
+                clips[c].frames[f].duration = definition.durations[f];
+            }
+        }
+        return true;
+    }();
+    (void)built;
+    return clips;
+}
@@ -0,0 +1,45 @@
+#include "AnimationPlayer.hpp"
+
+// ===== Core Methods =====
+
+AnimationPlayer::AnimationPlayer() : clip(nullptr), frameIndex(0), frameTimer(0.0) {
+}
+
+bool AnimationPlayer::play(const AnimationClip& newClip) {
+    bool changed = clip != &newClip || frameIndex != 0;
+    clip = &newClip;
+    frameIndex = 0;
+    frameTimer = 0.0;
+    return changed;
+}
+
+bool AnimationPlayer::switchClip(const AnimationClip& newClip) {
+    if (clip == &newClip) return false;
+
+    clip = &newClip;
+    if (frameIndex >= clip->getFrameCount()) {
+        frameIndex = 0;
+    }
+    return true;
+}
+
+bool AnimationPlayer::update(double deltaTime) {
+    if (!clip || clip->getFrameCount() < 2) return false;
+
+    frameTimer += deltaTime;
+    if (frameTimer < clip->getFrame(frameIndex).duration) {
+        return false;
+    }
+
+    frameIndex = (frameIndex + 1) % clip->getFrameCount();
+    frameTimer = 0.0;
+    return true;
+}
+
+void AnimationPlayer::applyTo(sf::Sprite& sprite) const {
+    const TextureManager::SpriteHandle& handle = getFrame().handle;
+    if (handle.texture && sprite.getTexture() != handle.texture) {
+        sprite.setTexture(*handle.texture);
+    }
+    sprite.setTextureRect(handle.rect);
+}
@@ -0,0 +1,245 @@
+#include "AssetBundle.hpp"
+#include "Logger.hpp"
+#include <cstring>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ===== Static Member Definitions =====
+
+const size_t AssetBundle::NAME_CAPACITY;
+const uint32_t AssetBundle::FORMAT_VERSION;
+const size_t AssetBundle::DATA_ALIGNMENT;
+const char AssetBundle::MAGIC[8] = {'D', 'I', 'N', 'O', 'P', 'A', 'K', '\0'};
+const std::string AssetBundle::DEFAULT_PATH = "../assets/dino_assets.bundle";  // bin/ 폴더에서 실행
+
+static_assert(sizeof(AssetBundle::Header) == 16, "Bundle header layout must not change");
+static_assert(sizeof(AssetBundle::Entry) == 64, "Bundle entry layout must not change");
+
+// ===== Lifetime =====
+
+AssetBundle::AssetBundle()
+    : mappedData(nullptr),
+      mappedSize(0),
+      entries(nullptr),
+      entryCount(0)
+#ifdef _WIN32
+      , fileHandle(nullptr),
+      mappingHandle(nullptr)
+#endif
+{
+}
+
+AssetBundle::~AssetBundle() {
+    close();
+}
+
+bool AssetBundle::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    mappingHandle = mapping;
+    mappedData = static_cast<const unsigned char*>(view);
+    mappedSize = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat fileInfo;
+    if (fstat(fd, &fileInfo) != 0 || fileInfo.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    void* view = mmap(nullptr, static_cast<size_t>(fileInfo.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // The mapping stays valid after the descriptor is closed
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    mappedData = static_cast<const unsigned char*>(view);
+    mappedSize = static_cast<size_t>(fileInfo.st_size);
+#endif
+
+    if (!validate()) {
+        DINO_LOG_ERROR(GAME, "Asset bundle {} is corrupt or from another version", path);
+        close();
+        return false;
+    }
+
+    DINO_LOG_INFO(GAME, "Mapped asset bundle {} ({} entries, {} bytes)", path, entryCount, mappedSize);
+    return true;
+}
+
+void AssetBundle::close() {
+    if (!mappedData) {
+        return;
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile(mappedData);
+    CloseHandle(static_cast<HANDLE>(mappingHandle));
+    CloseHandle(static_cast<HANDLE>(fileHandle));
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    munmap(const_cast<unsigned char*>(mappedData), mappedSize);
+#endif
+
+    mappedData = nullptr;
+    mappedSize = 0;
+    entries = nullptr;
+    entryCount = 0;
+}
+
+bool AssetBundle::isOpen() const {
+    return mappedData != nullptr;
+}
+
+// ===== Entry Access =====
+
+const AssetBundle::Entry* AssetBundle::find(const std::string& name) const {
+    // A handful of entries, looked up once at startup: a linear scan is enough
+    for (uint32_t i = 0; i < entryCount; ++i) {
+        if (name == entries[i].name) {
+            return &entries[i];
+        }
+    }
+    return nullptr;
+}
+
+const void* AssetBundle::getData(const Entry& entry) const {
+    return mappedData + entry.offset;
+}
+
+size_t AssetBundle::getEntryCount() const {
+    return entryCount;
+}
+
+// ===== SFML Loaders =====
+
+bool AssetBundle::loadTexture(const std::string& name, sf::Texture& texture) const {
+    const Entry* entry = findOfKind(name, AssetKind::IMAGE_RGBA8);
+    if (!entry || !texture.create(entry->param0, entry->param1)) {
+        return false;
+    }
+
+    // Upload straight from the mapping: no sf::Image in between
+    texture.update(static_cast<const sf::Uint8*>(getData(*entry)));
+    return true;
+}
+
+bool AssetBundle::loadSoundBuffer(const std::string& name, sf::SoundBuffer& buffer) const {
+    const Entry* entry = findOfKind(name, AssetKind::SOUND_PCM16);
+    if (!entry) {
+        return false;
+    }
+
+    sf::Uint64 sampleCount = entry->size / sizeof(sf::Int16);
+    return buffer.loadFromSamples(static_cast<const sf::Int16*>(getData(*entry)),
+                                  sampleCount, entry->param0, entry->param1);
+}
+
+bool AssetBundle::loadFont(const std::string& name, sf::Font& font) const {
+    const Entry* entry = findOfKind(name, AssetKind::FONT);
+    if (!entry) {
+        return false;
+    }
+    return font.loadFromMemory(getData(*entry), static_cast<size_t>(entry->size));
+}
+
+// ===== Private Helper Methods =====
+
+bool AssetBundle::validate() {
+    if (mappedSize < sizeof(Header)) {
+        return false;
+    }
+
+    Header header;
+    std::memcpy(&header, mappedData, sizeof(Header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != FORMAT_VERSION) {
+        return false;
+    }
+
+    uint64_t tableEnd = sizeof(Header) + static_cast<uint64_t>(header.entryCount) * sizeof(Entry);
+    if (tableEnd > mappedSize) {
+        return false;
+    }
+
+    // Header is 16 bytes and the mapping is page aligned, so the table is aligned for Entry
+    const Entry* table = reinterpret_cast<const Entry*>(mappedData + sizeof(Header));
+    for (uint32_t i = 0; i < header.entryCount; ++i) {
+        const Entry& entry = table[i];
+        if (std::memchr(entry.name, '\0', NAME_CAPACITY) == nullptr) {
+            return false;  // Name must be terminated inside its field
+        }
+        // Offset checked first: mappedSize - entry.offset must not wrap
+        if (entry.offset < tableEnd || entry.offset > mappedSize || entry.offset % DATA_ALIGNMENT != 0 ||
+            entry.size > mappedSize - entry.offset) {
+            return false;
+        }
+
+        switch (static_cast<AssetKind>(entry.kind)) {
+            case AssetKind::IMAGE_RGBA8:
+                if (entry.size != static_cast<uint64_t>(entry.param0) * entry.param1 * 4) {
+                    return false;
+                }
+                break;
+            case AssetKind::SOUND_PCM16:
+                if (entry.size % sizeof(sf::Int16) != 0 || entry.param0 == 0 || entry.param1 == 0) {
+                    return false;
+                }
+                break;
+            case AssetKind::FONT:
+                break;
+            default:
+                return false;
+        }
+    }
+
+    entries = table;
+    entryCount = header.entryCount;
+    return true;
+}
+
+const AssetBundle::Entry* AssetBundle::findOfKind(const std::string& name, AssetKind kind) const {
+    const Entry* entry = find(name);
+    if (entry && entry->kind != static_cast<uint32_t>(kind)) {
+        DINO_LOG_WARN(GAME, "Asset {} has unexpected kind {}", name, entry->kind);
+        return nullptr;
+    }
+    return entry;
+}
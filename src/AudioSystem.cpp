@@ -0,0 +1,128 @@
+#include "AudioSystem.hpp"
+#include "Logger.hpp"
+
+// ===== Static Member Definitions =====
+
+const int AudioSystem::EFFECT_COUNT;
+const int AudioSystem::MAX_VOICES_PER_EFFECT;
+
+/**
+ * Fixed playback settings of one effect
+ */
+struct EffectConfig {
+    const char* name;   // For log output
+    int voiceCount;     // Overlapping plays allowed before stealing
+    float volume;       // 0 - 100
+};
+
+// In SoundEffect order
+static const EffectConfig EFFECT_CONFIGS[AudioSystem::EFFECT_COUNT] = {
+    {"jump",            2, 70.0f},
+    {"game over",       1, 80.0f},
+    {"score milestone", 2, 50.0f}   // 더 조용하게
+};
+
+// ===== Core Methods =====
+
+AudioSystem::AudioSystem()
+    : queueLength(0) {
+    for (int i = 0; i < EFFECT_COUNT; ++i) {
+        channels[i].voiceCount = EFFECT_CONFIGS[i].voiceCount;
+        channels[i].loaded = false;
+        queued[i] = false;
+    }
+    stats.enqueued = 0;
+    stats.deduplicated = 0;
+    stats.played = 0;
+    stats.stolen = 0;
+}
+
+void AudioSystem::setBuffer(SoundEffect effect, const sf::SoundBuffer& buffer, float pitch) {
+    int index = static_cast<int>(effect);
+    EffectChannel& channel = channels[index];
+
+    // Voices must let go of the old buffer before it is overwritten
+    for (int i = 0; i < channel.voiceCount; ++i) {
+        channel.voices[i].stop();
+        channel.voices[i].resetBuffer();
+    }
+
+    channel.buffer = buffer;
+    for (int i = 0; i < channel.voiceCount; ++i) {
+        channel.voices[i].setBuffer(channel.buffer);
+        channel.voices[i].setVolume(EFFECT_CONFIGS[index].volume);
+        channel.voices[i].setPitch(pitch);
+    }
+    channel.loaded = channel.buffer.getDuration() != sf::Time::Zero;
+
+    DINO_LOG_INFO(AUDIO, "{} sound ready ({} voices)", EFFECT_CONFIGS[index].name, channel.voiceCount);
+}
+
+bool AudioSystem::hasBuffer(SoundEffect effect) const {
+    return channels[static_cast<int>(effect)].loaded;
+}
+
+void AudioSystem::enqueue(SoundEffect effect) {
+    int index = static_cast<int>(effect);
+    if (!channels[index].loaded) {
+        return;
+    }
+    if (queued[index]) {
+        stats.deduplicated++;
+        return;
+    }
+
+    queued[index] = true;
+    queue[queueLength++] = effect;
+    stats.enqueued++;
+}
+
+void AudioSystem::processQueue() {
+    for (int q = 0; q < queueLength; ++q) {
+        int index = static_cast<int>(queue[q]);
+        EffectChannel& channel = channels[index];
+
+        int voice = selectVoice(channel);
+        if (channel.voices[voice].getStatus() == sf::Sound::Playing) {
+            stats.stolen++;
+        }
+        channel.voices[voice].play();  // Restarts from the beginning when stolen
+        stats.played++;
+
+        queued[index] = false;
+    }
+    queueLength = 0;
+}
+
+void AudioSystem::stopAll() {
+    for (int i = 0; i < EFFECT_COUNT; ++i) {
+        for (int v = 0; v < channels[i].voiceCount; ++v) {
+            channels[i].voices[v].stop();
+        }
+        queued[i] = false;
+    }
+    queueLength = 0;
+}
+
+const AudioSystem::AudioStats& AudioSystem::getStats() const {
+    return stats;
+}
+
+// ===== Private Helper Methods =====
+
+int AudioSystem::selectVoice(const EffectChannel& channel) const {
+    int oldest = 0;
+    sf::Time oldestOffset = sf::Time::Zero;
+
+    for (int i = 0; i < channel.voiceCount; ++i) {
+        if (channel.voices[i].getStatus() != sf::Sound::Playing) {
+            return i;
+        }
+        sf::Time offset = channel.voices[i].getPlayingOffset();
+        if (offset > oldestOffset) {
+            oldestOffset = offset;
+            oldest = i;
+        }
+    }
+    return oldest;
+}
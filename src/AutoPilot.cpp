@@ -0,0 +1,63 @@
+#include "AutoPilot.hpp"
+#include "Player.hpp"
+#include "ObstacleManager.hpp"
+#include <algorithm>
+
+// ===== Static Constants =====
+const double AutoPilot::JUMP_LEAD_TIME = 0.25;     // Jump when the obstacle is ~0.25 s away
+const double AutoPilot::JUMP_LEAD_MARGIN = 20.0;   // Small fixed cushion in pixels
+
+AutoPilot::AutoPilot() : jumpCount(0) {
+}
+
+bool AutoPilot::update(Player& player, const ObstacleManager& obstacleManager) {
+    Aabb playerBoxes[3];
+    player.getCollisionAabbs(playerBoxes);
+    float playerLeft = std::min(playerBoxes[0].left, std::min(playerBoxes[1].left, playerBoxes[2].left));
+    float playerRight = std::max(playerBoxes[0].right, std::max(playerBoxes[1].right, playerBoxes[2].right));
+    float leadDistance = static_cast<float>(obstacleManager.getCurrentSpeed() * JUMP_LEAD_TIME + JUMP_LEAD_MARGIN);
+    
+    if (player.getIsJumping()) {
+        bool obstacleAhead = hasObstacleAhead(obstacleManager, playerLeft, playerRight, leadDistance);
+        if (!player.getIsFastFalling() && !obstacleAhead) {
+            // Nothing below or just ahead: fast fall to be ready for the next obstacle
+            player.startDucking();
+        } else if (player.getIsFastFalling() && obstacleAhead) {
+            // Landing in the wider duck pose would run into it: land standing instead
+            player.stopDucking();
+        }
+        return false;
+    }
+    
+    // Landed from a fast fall: release the duck key before deciding on the next jump
+    if (player.getIsDucking()) {
+        player.stopDucking();
+    }
+    
+    if (hasObstacleAhead(obstacleManager, playerLeft, playerRight, leadDistance)) {
+        player.jump();
+        jumpCount++;
+        return true;
+    }
+    
+    return false;
+}
+
+bool AutoPilot::hasObstacleAhead(const ObstacleManager& obstacleManager, float playerLeft, float playerRight,
+                                 float leadDistance) {
+    size_t first = 0;
+    size_t last = 0;
+    obstacleManager.findObstaclesInRange(playerLeft, playerRight + leadDistance, first, last);
+    
+    for (size_t i = first; i < last; ++i) {
+        Aabb obstacleBox = obstacleManager.getCollisionAabb(i);
+        if (obstacleBox.right > playerLeft && obstacleBox.left - playerRight <= leadDistance) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int AutoPilot::getJumpCount() const {
+    return jumpCount;
+}
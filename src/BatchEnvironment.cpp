@@ -0,0 +1,175 @@
+#include "BatchEnvironment.hpp"
+#include "CollisionManager.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+
+// ===== Static Member Definitions =====
+
+const int BatchEnvironment::OBS_PLAYER_Y;
+const int BatchEnvironment::OBS_PLAYER_VELOCITY_Y;
+const int BatchEnvironment::OBS_DUCKING;
+const int BatchEnvironment::OBS_FAST_FALLING;
+const int BatchEnvironment::OBS_OBSTACLE_SPEED;
+const int BatchEnvironment::OBS_FIRST_OBSTACLE;
+const int BatchEnvironment::OBSTACLE_SLOTS;
+const int BatchEnvironment::OBSTACLE_FEATURES;
+const int BatchEnvironment::OBSERVATION_SIZE;
+const float BatchEnvironment::EMPTY_SLOT_DISTANCE = 1000.0f;  // Beyond the spawn point, as if nothing were coming
+const float BatchEnvironment::DEATH_REWARD = -1.0f;
+
+static const double PLAYER_START_X = 100.0;    // Same start position as Game::initializeSystems
+static const double PLAYER_START_Y = 400.0;
+
+// ===== Core Methods =====
+
+BatchEnvironment::BatchEnvironment(size_t size, double tickRate)
+    : tickDuration(1.0 / tickRate),
+      gameTimes(size, 0.0),
+      duckHeld(size, 0),
+      observations(size * OBSERVATION_SIZE, 0.0f),
+      rewards(size, 0.0f),
+      dones(size, 1),   // Nothing to step until reset()
+      stepCount(0) {
+    // Reserved up front so the objects stay contiguous and are never relocated
+    players.reserve(size);
+    obstacleManagers.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+        players.emplace_back(PLAYER_START_X, PLAYER_START_Y);
+        obstacleManagers.emplace_back();
+    }
+
+    DINO_LOG_INFO(GAME, "Batch environment created: {} environments at {} Hz", size, tickRate);
+}
+
+bool BatchEnvironment::reset(const std::vector<uint32_t>& seeds) {
+    if (seeds.size() != size()) {
+        DINO_LOG_ERROR(GAME, "Batch reset needs {} seeds, got {}", size(), seeds.size());
+        return false;
+    }
+    for (size_t i = 0; i < seeds.size(); ++i) {
+        resetEnvironment(i, seeds[i]);
+    }
+    return true;
+}
+
+void BatchEnvironment::resetEnvironment(size_t index, uint32_t seed) {
+    players[index].reset();
+    obstacleManagers[index].clear();
+    obstacleManagers[index].setSeed(seed);
+    gameTimes[index] = 0.0;
+    duckHeld[index] = 0;
+    rewards[index] = 0.0f;
+    dones[index] = 0;
+    writeObservation(index);
+}
+
+bool BatchEnvironment::step(const std::vector<Action>& actions) {
+    if (actions.size() != size()) {
+        DINO_LOG_ERROR(GAME, "Batch step needs {} actions, got {}", size(), actions.size());
+        return false;
+    }
+
+    for (size_t i = 0; i < actions.size(); ++i) {
+        if (dones[i]) {
+            rewards[i] = 0.0f;
+            continue;
+        }
+
+        // Same order as Game::updatePlayingState
+        applyAction(i, actions[i]);
+        gameTimes[i] += tickDuration;
+        players[i].update(tickDuration);
+        obstacleManagers[i].update(tickDuration, gameTimes[i]);
+
+        if (CollisionManager::checkPlayerObstacleCollisionTriple(players[i], obstacleManagers[i])) {
+            rewards[i] = DEATH_REWARD;
+            dones[i] = 1;
+        } else {
+            rewards[i] = static_cast<float>(tickDuration);
+        }
+        writeObservation(i);
+        stepCount++;
+    }
+    return true;
+}
+
+// ===== Step Output Access =====
+
+const std::vector<float>& BatchEnvironment::getObservations() const {
+    return observations;
+}
+
+const std::vector<float>& BatchEnvironment::getRewards() const {
+    return rewards;
+}
+
+const std::vector<unsigned char>& BatchEnvironment::getDones() const {
+    return dones;
+}
+
+size_t BatchEnvironment::size() const {
+    return players.size();
+}
+
+uint64_t BatchEnvironment::getStepCount() const {
+    return stepCount;
+}
+
+// ===== Private Helper Methods =====
+
+void BatchEnvironment::applyAction(size_t index, Action action) {
+    Player& player = players[index];
+    bool duck = action == Action::DUCK;
+
+    // Only key changes reach the player, exactly like press / release events
+    if (duckHeld[index] && !duck) {
+        player.stopDucking();
+    } else if (!duckHeld[index] && duck) {
+        player.startDucking();
+    }
+    duckHeld[index] = duck ? 1 : 0;
+
+    if (action == Action::JUMP) {
+        player.jump();
+    }
+}
+
+void BatchEnvironment::writeObservation(size_t index) {
+    const Player& player = players[index];
+    const ObstacleManager& obstacleManager = obstacleManagers[index];
+    float* row = &observations[index * OBSERVATION_SIZE];
+
+    row[OBS_PLAYER_Y] = static_cast<float>(player.getPosY());
+    row[OBS_PLAYER_VELOCITY_Y] = static_cast<float>(player.getVelocityY());
+    row[OBS_DUCKING] = player.getIsDucking() ? 1.0f : 0.0f;
+    row[OBS_FAST_FALLING] = player.getIsFastFalling() ? 1.0f : 0.0f;
+    row[OBS_OBSTACLE_SPEED] = static_cast<float>(obstacleManager.getCurrentSpeed());
+
+    Aabb playerBoxes[3];
+    player.getCollisionAabbs(playerBoxes);
+    float playerLeft = std::min(playerBoxes[0].left, std::min(playerBoxes[1].left, playerBoxes[2].left));
+    float playerRight = std::max(playerBoxes[0].right, std::max(playerBoxes[1].right, playerBoxes[2].right));
+
+    // Obstacles are sorted by x: the first one still reaching the player starts the slots
+    size_t first = 0;
+    size_t last = 0;
+    obstacleManager.findObstaclesInRange(playerLeft, playerLeft, first, last);
+
+    const ObstacleManager::ObstacleArrays& data = obstacleManager.getObstacleData();
+    int slot = 0;
+    for (size_t i = first; i < data.size() && slot < OBSTACLE_SLOTS; ++i) {
+        Aabb box = obstacleManager.getCollisionAabb(i);
+        if (box.right <= playerLeft) {
+            continue;   // Already passed
+        }
+        float* features = row + OBS_FIRST_OBSTACLE + slot * OBSTACLE_FEATURES;
+        features[0] = box.left - playerRight;
+        features[1] = static_cast<float>(data.type[data.slot(i)]);
+        slot++;
+    }
+    for (; slot < OBSTACLE_SLOTS; ++slot) {
+        float* features = row + OBS_FIRST_OBSTACLE + slot * OBSTACLE_FEATURES;
+        features[0] = EMPTY_SLOT_DISTANCE;
+        features[1] = -1.0f;
+    }
+}
@@ -0,0 +1,109 @@
+#include "CollisionMask.hpp"
+#include <algorithm>
+
+// ===== Static Member Definitions =====
+
+const int CollisionMask::WORD_BITS;
+const sf::Uint8 CollisionMask::DEFAULT_ALPHA_THRESHOLD;
+
+// ===== Construction =====
+
+CollisionMask::CollisionMask() : width(0), height(0), wordsPerRow(0) {
+}
+
+CollisionMask::CollisionMask(int width, int height)
+    : width(std::max(width, 0)),
+      height(std::max(height, 0)),
+      wordsPerRow((std::max(width, 0) + WORD_BITS - 1) / WORD_BITS) {
+    words.assign(static_cast<size_t>(wordsPerRow) * this->height, 0);
+}
+
+CollisionMask CollisionMask::fromPixels(const sf::Uint8* pixels, unsigned int width, unsigned int height,
+                                        sf::Uint8 alphaThreshold) {
+    CollisionMask mask(static_cast<int>(width), static_cast<int>(height));
+    for (unsigned int y = 0; y < height; ++y) {
+        const sf::Uint8* row = pixels + static_cast<size_t>(y) * width * 4;
+        for (unsigned int x = 0; x < width; ++x) {
+            if (row[x * 4 + 3] >= alphaThreshold) {
+                mask.setSolid(static_cast<int>(x), static_cast<int>(y));
+            }
+        }
+    }
+    return mask;
+}
+
+CollisionMask CollisionMask::resampled(const sf::IntRect& area, int newWidth, int newHeight) const {
+    CollisionMask result(newWidth, newHeight);
+    if (result.isEmpty() || area.width <= 0 || area.height <= 0) {
+        return result;
+    }
+
+    // Same texel the sprite shows at each screen pixel (pixel centers, nearest neighbour)
+    for (int y = 0; y < result.height; ++y) {
+        int sourceY = area.top + static_cast<int>((2 * y + 1) * static_cast<long long>(area.height) / (2 * result.height));
+        for (int x = 0; x < result.width; ++x) {
+            int sourceX = area.left + static_cast<int>((2 * x + 1) * static_cast<long long>(area.width) / (2 * result.width));
+            if (isSolid(sourceX, sourceY)) {
+                result.setSolid(x, y);
+            }
+        }
+    }
+    return result;
+}
+
+// ===== Overlap Test =====
+
+bool CollisionMask::overlaps(const CollisionMask& a, int ax, int ay, const CollisionMask& b, int bx, int by) {
+    // Intersection of both masks in world pixels
+    int left = std::max(ax, bx);
+    int right = std::min(ax + a.width, bx + b.width);
+    int top = std::max(ay, by);
+    int bottom = std::min(ay + a.height, by + b.height);
+    if (left >= right || top >= bottom) {
+        return false;
+    }
+
+    // One word of each row at a time; columns past either mask's right edge read as 0
+    for (int y = top; y < bottom; ++y) {
+        for (int x = left; x < right; x += WORD_BITS) {
+            if (a.extractBits(y - ay, x - ax) & b.extractBits(y - by, x - bx)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// ===== Pixel Access =====
+
+bool CollisionMask::isSolid(int x, int y) const {
+    if (x < 0 || y < 0 || x >= width || y >= height) {
+        return false;
+    }
+    uint64_t word = words[static_cast<size_t>(y) * wordsPerRow + x / WORD_BITS];
+    return (word >> (x % WORD_BITS)) & 1u;
+}
+
+void CollisionMask::setSolid(int x, int y) {
+    if (x < 0 || y < 0 || x >= width || y >= height) {
+        return;
+    }
+    words[static_cast<size_t>(y) * wordsPerRow + x / WORD_BITS] |= uint64_t(1) << (x % WORD_BITS);
+}
+
+// ===== Private Helper Methods =====
+
+uint64_t CollisionMask::extractBits(int row, int column) const {
+    int wordIndex = column / WORD_BITS;
+    int shift = column % WORD_BITS;
+    if (wordIndex >= wordsPerRow) {
+        return 0;
+    }
+
+    const uint64_t* rowWords = &words[static_cast<size_t>(row) * wordsPerRow];
+    uint64_t bits = rowWords[wordIndex] >> shift;
+    if (shift != 0 && wordIndex + 1 < wordsPerRow) {
+        bits |= rowWords[wordIndex + 1] << (WORD_BITS - shift);
+    }
+    return bits;
+}
@@ -2,8 +2,34 @@
 #include "Player.hpp"
 #include "Obstacle.hpp"
 #include "ObstacleManager.hpp"
+#include "CollisionMask.hpp"
+#include "TextureManager.hpp"
+#include "Logger.hpp"
 #include <cmath>  // for sqrt, pow functions
-#include <iostream>
+#include <algorithm>
+
+// SIMD lanes for the batch kernel (scalar fallback elsewhere)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DINO_COLLISION_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define DINO_COLLISION_NEON
+#include <arm_neon.h>
+#endif
+
+// Candidates packed per kernel call (stack arrays, no allocation)
+static const size_t COLLISION_BATCH_SIZE = 64;
+
+// Convert between the SFML rectangle and the POD box
+static Aabb toAabb(const sf::FloatRect& rect) {
+    return Aabb::fromRect(rect.left, rect.top, rect.width, rect.height);
+}
+
+static sf::FloatRect toFloatRect(const Aabb& box) {
+    return sf::FloatRect(box.left, box.top, box.right - box.left, box.bottom - box.top);
+}
+
+thread_local CollisionManager::BroadPhaseStats CollisionManager::broadPhaseStats;
 
 // ===== Basic Collision Detection Methods =====
 
@@ -31,13 +57,118 @@ bool CollisionManager::checkMultipleRectangleCollision(const std::vector<sf::Rec
 // ===== Enhanced Game-Specific Collision Methods =====
 
 bool CollisionManager::checkPlayerObstacleCollisionTriple(const Player& player, const ObstacleManager& obstacleManager) {
-    // Get all obstacles from the obstacle manager
-    const std::vector<Obstacle>& obstacles = obstacleManager.getObstacles();
+    return checkPlayerObstacleCollisionTriple(player, obstacleManager, nullptr);
+}
+
+bool CollisionManager::checkPlayerObstacleCollisionTriple(const Player& player, const ObstacleManager& obstacleManager,
+                                                          CollisionInfo* info) {
+    Aabb playerBoxes[3];
+    player.getCollisionAabbs(playerBoxes);
+    
+    // Broad phase: only obstacles overlapping the player's x-extent can collide
+    float playerMinX = 0.0f;
+    float playerMaxX = 0.0f;
+    getPlayerExtentX(playerBoxes, playerMinX, playerMaxX);
+    
+    size_t first = 0;
+    size_t last = 0;
+    obstacleManager.findObstaclesInRange(playerMinX, playerMaxX, first, last);
+    
+    size_t candidateCount = last - first;
+    broadPhaseStats.queries++;
+    broadPhaseStats.candidates += candidateCount;
+    broadPhaseStats.maxCandidatesPerQuery = std::max(broadPhaseStats.maxCandidatesPerQuery, candidateCount);
+    
+    // Narrow phase: pack candidates into float lanes and run the batch kernel
+    float left[COLLISION_BATCH_SIZE];
+    float top[COLLISION_BATCH_SIZE];
+    float right[COLLISION_BATCH_SIZE];
+    float bottom[COLLISION_BATCH_SIZE];
+    
+    for (size_t batchStart = first; batchStart < last; batchStart += COLLISION_BATCH_SIZE) {
+        size_t batchCount = std::min(COLLISION_BATCH_SIZE, last - batchStart);
+        for (size_t i = 0; i < batchCount; ++i) {
+            Aabb box = obstacleManager.getCollisionAabb(batchStart + i);
+            left[i] = box.left;
+            top[i] = box.top;
+            right[i] = box.right;
+            bottom[i] = box.bottom;
+        }
+        
+        broadPhaseStats.narrowPhaseTests += 3 * batchCount;
+        int hit = findFirstHit(playerBoxes, left, top, right, bottom, batchCount);
+        if (hit >= 0) {
+            // Details only when the caller asked for them
+            if (info) {
+                *info = buildTripleCollisionInfo(playerBoxes, obstacleManager.getCollisionAabb(batchStart + hit));
+                info->obstacleIndex = batchStart + hit;
+            }
+            return true;  // Early exit on first collision found
+        }
+    }
     
-    // Check collision against each obstacle using triple collision system
-    for (const auto& obstacle : obstacles) {
-        CollisionInfo info = checkPlayerSingleObstacleTriple(player, obstacle);
-        if (info.hasCollision) {
+    return false;  // No collision detected
+}
+
+bool CollisionManager::checkPlayerObstacleCollisionPixel(const Player& player, const ObstacleManager& obstacleManager,
+                                                         CollisionInfo* info) {
+    const TextureManager& textureManager = TextureManager::getInstance();
+    const CollisionMask* playerMask = textureManager.getCollisionMask(player.getSpriteType(), player.getSpriteSize());
+    if (!playerMask) {
+        return checkPlayerObstacleCollisionTriple(player, obstacleManager, info);
+    }
+    
+    // Masks are compared on the whole-pixel grid the sprites are drawn on
+    int playerX = static_cast<int>(std::floor(player.getPosX()));
+    int playerY = static_cast<int>(std::floor(player.getPosY()));
+    Aabb playerBounds = Aabb::fromRect(static_cast<float>(playerX), static_cast<float>(playerY),
+                                       static_cast<float>(playerMask->getWidth()),
+                                       static_cast<float>(playerMask->getHeight()));
+    Aabb playerBoxes[3];
+    player.getCollisionAabbs(playerBoxes);
+    
+    // Broad phase over sprite areas: anything the boxes could miss is still a candidate
+    size_t first = 0;
+    size_t last = 0;
+    obstacleManager.findObstacleSpritesInRange(playerBounds.left, playerBounds.right, first, last);
+    
+    size_t candidateCount = last - first;
+    broadPhaseStats.queries++;
+    broadPhaseStats.candidates += candidateCount;
+    broadPhaseStats.maxCandidatesPerQuery = std::max(broadPhaseStats.maxCandidatesPerQuery, candidateCount);
+    
+    const ObstacleManager::ObstacleArrays& data = obstacleManager.getObstacleData();
+    for (size_t i = first; i < last; ++i) {
+        Aabb spriteBox = obstacleManager.getSpriteAabb(i);
+        if (!playerBounds.intersects(spriteBox)) {
+            continue;
+        }
+        
+        const Obstacle::TypeInfo& typeInfo = Obstacle::getTypeInfo(data.type[data.slot(i)]);
+        const CollisionMask* obstacleMask = textureManager.getCollisionMask(typeInfo.spriteType, typeInfo.spriteSize);
+        broadPhaseStats.narrowPhaseTests++;
+        if (!obstacleMask) {
+            // No mask for this sprite: the regular boxes decide
+            Aabb obstacleBox = obstacleManager.getCollisionAabb(i);
+            if (anyBoxHit(playerBoxes, obstacleBox)) {
+                if (info) {
+                    *info = buildTripleCollisionInfo(playerBoxes, obstacleBox);
+                    info->obstacleIndex = i;
+                }
+                return true;
+            }
+            continue;
+        }
+        
+        if (CollisionMask::overlaps(*playerMask, playerX, playerY, *obstacleMask,
+                                    static_cast<int>(std::floor(spriteBox.left)),
+                                    static_cast<int>(std::floor(spriteBox.top)))) {
+            if (info) {
+                *info = getDetailedCollision(toFloatRect(playerBounds), toFloatRect(spriteBox));
+                info->hasCollision = true;
+                info->collisionType = CollisionType::PIXEL_COLLISION;
+                info->obstacleIndex = i;
+            }
             return true;  // Early exit on first collision found
         }
     }
@@ -47,20 +178,24 @@ bool CollisionManager::checkPlayerObstacleCollisionTriple(const Player& player,
 
 CollisionManager::CollisionInfo CollisionManager::checkPlayerSingleObstacleTriple(const Player& player, 
                                                                                   const Obstacle& obstacle) {
+    return checkPlayerBoundsTriple(player, obstacle.getShape().getGlobalBounds());
+}
+
+CollisionManager::CollisionInfo CollisionManager::checkPlayerBoundsTriple(const Player& player, 
+                                                                          const sf::FloatRect& obstacleBounds) {
+    Aabb playerBoxes[3];
+    player.getCollisionAabbs(playerBoxes);
+    return buildTripleCollisionInfo(playerBoxes, toAabb(obstacleBounds));
+}
+
+CollisionManager::CollisionInfo CollisionManager::buildTripleCollisionInfo(const Aabb playerBoxes[3], 
+                                                                           const Aabb& obstacleBox) {
     CollisionInfo info;
     
-    // Get all collision boxes from player
-    const sf::RectangleShape& headBox = player.getHeadCollisionBox();
-    const sf::RectangleShape& bodyBox = player.getBodyCollisionBox();
-    const sf::RectangleShape& tailBox = player.getTailCollisionBox();
-    
-    // Get obstacle collision box
-    const sf::RectangleShape& obstacleBox = obstacle.getShape();
-    
-    // Check each collision box individually
-    info.headHit = checkRectangleCollision(headBox, obstacleBox);
-    info.bodyHit = checkRectangleCollision(bodyBox, obstacleBox);
-    info.tailHit = checkRectangleCollision(tailBox, obstacleBox);
+    // Check each collision box individually (head, body, tail)
+    info.headHit = playerBoxes[0].intersects(obstacleBox);
+    info.bodyHit = playerBoxes[1].intersects(obstacleBox);
+    info.tailHit = playerBoxes[2].intersects(obstacleBox);
     
     // Determine if any collision occurred
     info.hasCollision = info.headHit || info.bodyHit || info.tailHit;
@@ -70,27 +205,15 @@ CollisionManager::CollisionInfo CollisionManager::checkPlayerSingleObstacleTripl
         info.collisionType = determineCollisionType(info.headHit, info.bodyHit, info.tailHit);
         
         // Calculate collision details using the primary collision box (body is primary)
-        if (info.bodyHit) {
-            CollisionInfo detailedInfo = getDetailedCollision(bodyBox, obstacleBox);
-            info.collisionPoint = detailedInfo.collisionPoint;
-            info.normal = detailedInfo.normal;
-            info.penetrationDepth = detailedInfo.penetrationDepth;
-        } else if (info.headHit) {
-            CollisionInfo detailedInfo = getDetailedCollision(headBox, obstacleBox);
-            info.collisionPoint = detailedInfo.collisionPoint;
-            info.normal = detailedInfo.normal;
-            info.penetrationDepth = detailedInfo.penetrationDepth;
-        } else if (info.tailHit) {
-            CollisionInfo detailedInfo = getDetailedCollision(tailBox, obstacleBox);
-            info.collisionPoint = detailedInfo.collisionPoint;
-            info.normal = detailedInfo.normal;
-            info.penetrationDepth = detailedInfo.penetrationDepth;
-        }
+        const Aabb& primaryBox = info.bodyHit ? playerBoxes[1] : (info.headHit ? playerBoxes[0] : playerBoxes[2]);
+        CollisionInfo detailedInfo = getDetailedCollision(toFloatRect(primaryBox), toFloatRect(obstacleBox));
+        info.collisionPoint = detailedInfo.collisionPoint;
+        info.normal = detailedInfo.normal;
+        info.penetrationDepth = detailedInfo.penetrationDepth;
         
         // Debug output for development
-        std::cout << "Triple collision detected - Head: " << info.headHit 
-                  << ", Body: " << info.bodyHit 
-                  << ", Tail: " << info.tailHit << std::endl;
+        DINO_LOG_DEBUG(COLLISION, "Triple collision detected - Head: {}, Body: {}, Tail: {}",
+                       info.headHit, info.bodyHit, info.tailHit);
     }
     
     return info;
@@ -106,15 +229,13 @@ CollisionManager::CollisionType CollisionManager::getPlayerObstacleCollisionType
 // ===== Legacy Collision Methods =====
 
 bool CollisionManager::checkPlayerObstacleCollision(const Player& player, const ObstacleManager& obstacleManager) {
-    // Get the player's shape for collision testing
-    const sf::RectangleShape& playerShape = player.getShape();
+    // Get the player's shape bounds for collision testing
+    sf::FloatRect playerBounds = player.getShape().getGlobalBounds();
     
-    // Get all obstacles from the obstacle manager
-    const std::vector<Obstacle>& obstacles = obstacleManager.getObstacles();
-    
-    // Check collision against each obstacle
-    for (const auto& obstacle : obstacles) {
-        if (checkPlayerSingleObstacle(player, obstacle)) {
+    // Check collision against each obstacle's packed collision box
+    size_t obstacleCount = obstacleManager.getObstacleCount();
+    for (size_t i = 0; i < obstacleCount; ++i) {
+        if (playerBounds.intersects(obstacleManager.getCollisionBounds(i))) {
             return true;  // Early exit on first collision found
         }
     }
@@ -135,11 +256,13 @@ bool CollisionManager::checkPlayerSingleObstacle(const Player& player, const Obs
 
 CollisionManager::CollisionInfo CollisionManager::getDetailedCollision(const sf::RectangleShape& rect1, 
                                                                        const sf::RectangleShape& rect2) {
-    CollisionManager::CollisionInfo info;
-    
     // Get bounds of both rectangles
-    sf::FloatRect bounds1 = rect1.getGlobalBounds();
-    sf::FloatRect bounds2 = rect2.getGlobalBounds();
+    return getDetailedCollision(rect1.getGlobalBounds(), rect2.getGlobalBounds());
+}
+
+CollisionManager::CollisionInfo CollisionManager::getDetailedCollision(const sf::FloatRect& bounds1, 
+                                                                       const sf::FloatRect& bounds2) {
+    CollisionManager::CollisionInfo info;
     
     // Check if collision exists
     sf::FloatRect intersection;
@@ -226,8 +349,119 @@ bool CollisionManager::checkCircleCircleCollision(const sf::Vector2f& center1, d
     return distance <= (radius1 + radius2);
 }
 
+// ===== Batch Narrow Phase =====
+
+int CollisionManager::findFirstHit(const Aabb playerBoxes[3], const float* left, const float* top,
+                                   const float* right, const float* bottom, size_t count) {
+    size_t i = 0;
+    
+#if defined(DINO_COLLISION_SSE2)
+    // Broadcast each player box edge once, then test four obstacles per step
+    __m128 boxLeft[3], boxTop[3], boxRight[3], boxBottom[3];
+    for (int b = 0; b < 3; ++b) {
+        boxLeft[b] = _mm_set1_ps(playerBoxes[b].left);
+        boxTop[b] = _mm_set1_ps(playerBoxes[b].top);
+        boxRight[b] = _mm_set1_ps(playerBoxes[b].right);
+        boxBottom[b] = _mm_set1_ps(playerBoxes[b].bottom);
+    }
+    
+    for (; i + 4 <= count; i += 4) {
+        __m128 obstacleLeft = _mm_loadu_ps(left + i);
+        __m128 obstacleTop = _mm_loadu_ps(top + i);
+        __m128 obstacleRight = _mm_loadu_ps(right + i);
+        __m128 obstacleBottom = _mm_loadu_ps(bottom + i);
+        
+        __m128 hit = _mm_setzero_ps();
+        for (int b = 0; b < 3; ++b) {
+            // Same strict comparisons as Aabb::intersects
+            __m128 overlap = _mm_and_ps(_mm_and_ps(_mm_cmplt_ps(boxLeft[b], obstacleRight),
+                                                   _mm_cmplt_ps(obstacleLeft, boxRight[b])),
+                                        _mm_and_ps(_mm_cmplt_ps(boxTop[b], obstacleBottom),
+                                                   _mm_cmplt_ps(obstacleTop, boxBottom[b])));
+            hit = _mm_or_ps(hit, overlap);
+        }
+        
+        int mask = _mm_movemask_ps(hit);
+        if (mask != 0) {
+            // Lowest set lane is the first obstacle hit
+            int lane = 0;
+            while (!(mask & (1 << lane))) {
+                lane++;
+            }
+            return static_cast<int>(i) + lane;
+        }
+    }
+#elif defined(DINO_COLLISION_NEON)
+    float32x4_t boxLeft[3], boxTop[3], boxRight[3], boxBottom[3];
+    for (int b = 0; b < 3; ++b) {
+        boxLeft[b] = vdupq_n_f32(playerBoxes[b].left);
+        boxTop[b] = vdupq_n_f32(playerBoxes[b].top);
+        boxRight[b] = vdupq_n_f32(playerBoxes[b].right);
+        boxBottom[b] = vdupq_n_f32(playerBoxes[b].bottom);
+    }
+    
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t obstacleLeft = vld1q_f32(left + i);
+        float32x4_t obstacleTop = vld1q_f32(top + i);
+        float32x4_t obstacleRight = vld1q_f32(right + i);
+        float32x4_t obstacleBottom = vld1q_f32(bottom + i);
+        
+        uint32x4_t hit = vdupq_n_u32(0);
+        for (int b = 0; b < 3; ++b) {
+            uint32x4_t overlap = vandq_u32(vandq_u32(vcltq_f32(boxLeft[b], obstacleRight),
+                                                     vcltq_f32(obstacleLeft, boxRight[b])),
+                                           vandq_u32(vcltq_f32(boxTop[b], obstacleBottom),
+                                                     vcltq_f32(obstacleTop, boxBottom[b])));
+            hit = vorrq_u32(hit, overlap);
+        }
+        
+        if (vmaxvq_u32(hit) != 0) {
+            // Lowest set lane is the first obstacle hit
+            uint32_t lanes[4];
+            vst1q_u32(lanes, hit);
+            int lane = 0;
+            while (lanes[lane] == 0) {
+                lane++;
+            }
+            return static_cast<int>(i) + lane;
+        }
+    }
+#endif
+    
+    // Scalar fallback (and the remainder after the SIMD lanes)
+    for (; i < count; ++i) {
+        Aabb obstacleBox = {left[i], top[i], right[i], bottom[i]};
+        if (anyBoxHit(playerBoxes, obstacleBox)) {
+            return static_cast<int>(i);
+        }
+    }
+    
+    return -1;  // No overlap in this batch
+}
+
+// ===== Broad Phase Instrumentation =====
+
+const CollisionManager::BroadPhaseStats& CollisionManager::getBroadPhaseStats() {
+    return broadPhaseStats;
+}
+
+void CollisionManager::resetBroadPhaseStats() {
+    broadPhaseStats = BroadPhaseStats();
+}
+
 // ===== Private Helper Methods =====
 
+void CollisionManager::getPlayerExtentX(const Aabb playerBoxes[3], float& minX, float& maxX) {
+    minX = std::min(playerBoxes[0].left, std::min(playerBoxes[1].left, playerBoxes[2].left));
+    maxX = std::max(playerBoxes[0].right, std::max(playerBoxes[1].right, playerBoxes[2].right));
+}
+
+bool CollisionManager::anyBoxHit(const Aabb playerBoxes[3], const Aabb& obstacleBox) {
+    return playerBoxes[0].intersects(obstacleBox) ||
+           playerBoxes[1].intersects(obstacleBox) ||
+           playerBoxes[2].intersects(obstacleBox);
+}
+
 double CollisionManager::calculateDistance(const sf::Vector2f& point1, const sf::Vector2f& point2) {
     // Use Pythagorean theorem to calculate Euclidean distance
     double dx = point2.x - point1.x;
@@ -0,0 +1,71 @@
+#include "FrameArena.hpp"
+#include <algorithm>
+
+// ===== Static Member Definitions =====
+
+const size_t FrameArena::DEFAULT_CAPACITY;
+
+// ===== Core Methods =====
+
+FrameArena::FrameArena(size_t initialCapacity)
+    : block(new unsigned char[initialCapacity]),
+      capacity(initialCapacity),
+      used(0),
+      overflowBytes(0),
+      highWater(0),
+      overflowCount(0) {
+}
+
+void* FrameArena::allocate(size_t size, size_t alignment) {
+    uintptr_t base = reinterpret_cast<uintptr_t>(block.get());
+    size_t offset = ((base + used + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1)) - base;
+    if (offset + size <= capacity) {
+        used = offset + size;
+        return block.get() + offset;
+    }
+
+    // Does not fit this frame: a heap block of its own, kept until reset()
+    if (overflowBlocks.empty()) {
+        overflowCount++;
+    }
+    std::unique_ptr<unsigned char[]> extra(new unsigned char[size + alignment]);
+    uintptr_t extraBase = reinterpret_cast<uintptr_t>(extra.get());
+    uintptr_t aligned = (extraBase + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    overflowBytes += size + alignment;
+    overflowBlocks.push_back(std::move(extra));
+    return reinterpret_cast<void*>(aligned);
+}
+
+void FrameArena::reset() {
+    highWater = std::max(highWater, used + overflowBytes);
+
+    // Grow once so the frames that follow fit the main block again
+    if (!overflowBlocks.empty()) {
+        overflowBlocks.clear();
+        capacity = std::max<size_t>(capacity, 1);
+        while (capacity < highWater) {
+            capacity *= 2;
+        }
+        block.reset(new unsigned char[capacity]);
+    }
+    used = 0;
+    overflowBytes = 0;
+}
+
+// ===== Statistics =====
+
+size_t FrameArena::getUsed() const {
+    return used + overflowBytes;
+}
+
+size_t FrameArena::getCapacity() const {
+    return capacity;
+}
+
+size_t FrameArena::getHighWater() const {
+    return std::max(highWater, used + overflowBytes);
+}
+
+uint64_t FrameArena::getOverflowCount() const {
+    return overflowCount;
+}
@@ -0,0 +1,175 @@
+#include "FramePacer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+// ===== Static Member Definitions =====
+
+const int FramePacer::LOW_POWER_FPS;
+const int FramePacer::BUCKET_COUNT;
+const double FramePacer::BUCKET_MS = 0.25;          // 0-100 ms in quarter milliseconds
+const double FramePacer::SPIN_MARGIN = 0.002;       // Covers typical sleep overshoot
+const double FramePacer::MISS_TOLERANCE = 1.5;      // Half a period late = a visibly repeated frame
+
+static const char* const MODE_NAMES[static_cast<int>(FramePacer::Mode::COUNT)] = {
+    "vsync",
+    "sleep-spin",
+    "uncapped",
+    "low-power"
+};
+
+// ===== Core Methods =====
+
+FramePacer::FramePacer()
+    : mode(Mode::VSYNC),
+      targetFps(60),
+      targetPeriod(1.0 / 60.0),
+      lowPowerActive(false),
+      nextDeadline(Clock::now()),
+      lastFrameEnd(Clock::now()) {
+    resetStats();
+}
+
+void FramePacer::configure(sf::RenderWindow& window, Mode pacingMode, int framesPerSecond) {
+    mode = pacingMode;
+    targetFps = std::max(framesPerSecond, 1);
+    targetPeriod = 1.0 / targetFps;
+    lowPowerActive = false;
+
+    // Never both: the frame limit is left to this class in every mode
+    window.setFramerateLimit(0);
+    window.setVerticalSyncEnabled(mode == Mode::VSYNC || mode == Mode::LOW_POWER);
+
+    nextDeadline = Clock::now();
+    lastFrameEnd = nextDeadline;
+}
+
+void FramePacer::endFrame(sf::RenderWindow& window, bool idle) {
+    // Low power idles on its own slow limiter; vsync would wake it at the refresh rate
+    bool lowPower = mode == Mode::LOW_POWER && idle;
+    if (lowPower != lowPowerActive) {
+        window.setVerticalSyncEnabled(!lowPower);
+        lowPowerActive = lowPower;
+        nextDeadline = Clock::now();
+    }
+
+    if (mode == Mode::SLEEP_SPIN || lowPower) {
+        double period = lowPower ? 1.0 / LOW_POWER_FPS : targetPeriod;
+        nextDeadline += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(period));
+
+        // More than a period behind: start over from now instead of rushing frames to catch up
+        Clock::time_point now = Clock::now();
+        if (nextDeadline < now) {
+            nextDeadline = now;
+        }
+        waitUntil(nextDeadline);
+    }
+
+    Clock::time_point frameEnd = Clock::now();
+    double interval = std::chrono::duration<double>(frameEnd - lastFrameEnd).count();
+    lastFrameEnd = frameEnd;
+
+    if (lowPower) {
+        idleFrames++;
+    } else {
+        recordFrame(interval);
+    }
+}
+
+// ===== Statistics =====
+
+void FramePacer::resetStats() {
+    std::fill(buckets, buckets + BUCKET_COUNT + 1, 0ull);
+    idleFrames = 0;
+    missedDeadlines = 0;
+    totalSeconds = 0.0;
+    maxSeconds = 0.0;
+    lastFrameEnd = Clock::now();
+}
+
+FramePacer::Stats FramePacer::getStats() const {
+    Stats stats;
+    for (int i = 0; i <= BUCKET_COUNT; ++i) {
+        stats.frames += buckets[i];
+    }
+    stats.idleFrames = idleFrames;
+    stats.missedDeadlines = missedDeadlines;
+    if (stats.frames == 0) {
+        return stats;
+    }
+
+    stats.avgMs = totalSeconds * 1000.0 / stats.frames;
+    stats.p50Ms = percentileMs(0.50, stats.frames);
+    stats.p95Ms = percentileMs(0.95, stats.frames);
+    stats.p99Ms = percentileMs(0.99, stats.frames);
+    stats.maxMs = maxSeconds * 1000.0;
+    return stats;
+}
+
+std::string FramePacer::formatSummary() const {
+    Stats stats = getStats();
+    std::ostringstream summary;
+    summary << std::fixed << std::setprecision(2);
+    summary << "pacing " << getModeName(mode) << " @" << targetFps
+            << ": p50 " << stats.p50Ms << " p95 " << stats.p95Ms << " p99 " << stats.p99Ms
+            << " max " << stats.maxMs << " ms, missed " << stats.missedDeadlines << "/" << stats.frames;
+    if (stats.idleFrames > 0) {
+        summary << ", idle " << stats.idleFrames;
+    }
+    return summary.str();
+}
+
+// ===== Mode Names =====
+
+const char* FramePacer::getModeName(Mode pacingMode) {
+    return MODE_NAMES[static_cast<int>(pacingMode)];
+}
+
+bool FramePacer::parseMode(const std::string& name, Mode& pacingMode) {
+    for (int i = 0; i < static_cast<int>(Mode::COUNT); ++i) {
+        if (name == MODE_NAMES[i]) {
+            pacingMode = static_cast<Mode>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// ===== Private Helper Methods =====
+
+void FramePacer::waitUntil(Clock::time_point deadline) {
+    Clock::time_point sleepUntil = deadline -
+        std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(SPIN_MARGIN));
+    if (Clock::now() < sleepUntil) {
+        std::this_thread::sleep_until(sleepUntil);
+    }
+    while (Clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
+void FramePacer::recordFrame(double seconds) {
+    double ms = seconds * 1000.0;
+    int bucket = static_cast<int>(ms / BUCKET_MS);
+    buckets[std::min(std::max(bucket, 0), BUCKET_COUNT)]++;
+
+    totalSeconds += seconds;
+    maxSeconds = std::max(maxSeconds, seconds);
+    if (seconds > targetPeriod * MISS_TOLERANCE) {
+        missedDeadlines++;
+    }
+}
+
+double FramePacer::percentileMs(double fraction, unsigned long long frames) const {
+    unsigned long long rank = static_cast<unsigned long long>(std::ceil(fraction * frames));
+    unsigned long long seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; ++i) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            return (i + 1) * BUCKET_MS;
+        }
+    }
+    return maxSeconds * 1000.0;  // Percentile lies in the overflow bucket
+}
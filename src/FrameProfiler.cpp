@@ -0,0 +1,168 @@
+#include "FrameProfiler.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+// ===== Static Member Definitions =====
+
+const int FrameProfiler::PHASE_COUNT;
+const int FrameProfiler::HISTORY_SIZE;
+
+static const char* const PHASE_NAMES[FrameProfiler::PHASE_COUNT] = {
+    "events",
+    "player",
+    "obstacles",
+    "collision",
+    "world",
+    "ui",
+    "display"
+};
+
+// ===== Core Methods =====
+
+FrameProfiler::FrameProfiler()
+    : historyHead(0),
+      historyCount(0),
+      frameIndex(0),
+      frameStart(std::chrono::steady_clock::now()),
+      enabled(true) {
+    std::fill(currentFrame, currentFrame + PHASE_COUNT, 0.0);
+}
+
+void FrameProfiler::beginFrame() {
+    std::fill(currentFrame, currentFrame + PHASE_COUNT, 0.0);
+    frameStart = std::chrono::steady_clock::now();
+}
+
+void FrameProfiler::endFrame() {
+    if (!enabled) return;
+
+    std::chrono::duration<double> frameTime = std::chrono::steady_clock::now() - frameStart;
+
+    // Push the finished frame into the ring
+    std::copy(currentFrame, currentFrame + PHASE_COUNT, history[historyHead]);
+    frameHistory[historyHead] = frameTime.count();
+    historyHead = (historyHead + 1) % HISTORY_SIZE;
+    historyCount = std::min(historyCount + 1, HISTORY_SIZE);
+
+    if (csvFile.is_open()) {
+        csvFile << frameIndex << ',' << frameTime.count() * 1000.0;
+        for (int i = 0; i < PHASE_COUNT; ++i) {
+            csvFile << ',' << currentFrame[i] * 1000.0;
+        }
+        csvFile << '\n';  // No flush per frame; the stream buffers rows
+    }
+
+    frameIndex++;
+}
+
+// ===== Statistics =====
+
+FrameProfiler::PhaseStats FrameProfiler::getPhaseStats(Phase phase) const {
+    double samples[HISTORY_SIZE];
+    collectSamples(static_cast<int>(phase), samples);
+    return computeStats(samples, historyCount);
+}
+
+FrameProfiler::PhaseStats FrameProfiler::getFrameStats() const {
+    double samples[HISTORY_SIZE];
+    collectSamples(-1, samples);
+    return computeStats(samples, historyCount);
+}
+
+std::string FrameProfiler::formatSummary() const {
+    std::ostringstream summary;
+    summary << std::fixed << std::setprecision(2);
+    summary << "phase       min   avg   p99 (ms)\n";
+
+    for (int i = 0; i < PHASE_COUNT; ++i) {
+        PhaseStats stats = getPhaseStats(static_cast<Phase>(i));
+        summary << std::left << std::setw(10) << PHASE_NAMES[i] << std::right
+                << std::setw(6) << stats.minMs
+                << std::setw(6) << stats.avgMs
+                << std::setw(6) << stats.p99Ms << '\n';
+    }
+
+    PhaseStats frame = getFrameStats();
+    summary << std::left << std::setw(10) << "frame" << std::right
+            << std::setw(6) << frame.minMs
+            << std::setw(6) << frame.avgMs
+            << std::setw(6) << frame.p99Ms;
+
+    if (csvFile.is_open()) {
+        summary << "\n[CSV recording]";
+    }
+    return summary.str();
+}
+
+const char* FrameProfiler::getPhaseName(Phase phase) {
+    return PHASE_NAMES[static_cast<int>(phase)];
+}
+
+// ===== Configuration =====
+
+void FrameProfiler::setEnabled(bool isEnabled) {
+    enabled = isEnabled;
+}
+
+// ===== CSV Export =====
+
+bool FrameProfiler::startCsvDump(const std::string& path) {
+    stopCsvDump();
+
+    csvFile.open(path.c_str(), std::ios::out | std::ios::trunc);
+    if (!csvFile.is_open()) {
+        return false;
+    }
+
+    csvFile << "frame,frame_ms";
+    for (int i = 0; i < PHASE_COUNT; ++i) {
+        csvFile << ',' << PHASE_NAMES[i] << "_ms";
+    }
+    csvFile << '\n';
+    return true;
+}
+
+void FrameProfiler::stopCsvDump() {
+    if (csvFile.is_open()) {
+        csvFile.close();
+    }
+}
+
+bool FrameProfiler::isCsvDumpActive() const {
+    return csvFile.is_open();
+}
+
+// ===== Private Helper Methods =====
+
+FrameProfiler::PhaseStats FrameProfiler::computeStats(const double* samples, int count) {
+    PhaseStats stats;
+    if (count == 0) return stats;
+
+    double sorted[HISTORY_SIZE];
+    std::copy(samples, samples + count, sorted);
+    std::sort(sorted, sorted + count);
+
+    double sum = 0.0;
+    for (int i = 0; i < count; ++i) {
+        sum += sorted[i];
+    }
+
+    // Nearest-rank 99th percentile
+    int p99Index = std::min(count - 1, static_cast<int>(count * 0.99));
+
+    stats.minMs = sorted[0] * 1000.0;
+    stats.avgMs = sum / count * 1000.0;
+    stats.p99Ms = sorted[p99Index] * 1000.0;
+    stats.lastMs = samples[count - 1] * 1000.0;
+    return stats;
+}
+
+void FrameProfiler::collectSamples(int phaseIndex, double* out) const {
+    // Oldest valid frame sits historyCount slots behind the head
+    int start = (historyHead - historyCount + HISTORY_SIZE) % HISTORY_SIZE;
+    for (int i = 0; i < historyCount; ++i) {
+        int slot = (start + i) % HISTORY_SIZE;
+        out[i] = (phaseIndex < 0) ? frameHistory[slot] : history[slot][phaseIndex];
+    }
+}
@@ -3,39 +3,130 @@
 #include "ObstacleManager.hpp"
 #include "CollisionManager.hpp"
 #include "TextureManager.hpp"   // NEW: Add TextureManager include
+#include "Logger.hpp"
+#include "AutoPilot.hpp"
+#include "AssetBundle.hpp"
+#include "ResourceLoader.hpp"
+#include "Replay.hpp"
+#include "AllocationTracker.hpp"
+#include "StateStream.hpp"
+#include "ScoreJournal.hpp"
 #include <iostream>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <random>
 
 // Static constant definitions - centralized game configuration
 const int Game::WINDOW_WIDTH = 800;
 const int Game::WINDOW_HEIGHT = 600;
 const int Game::TARGET_FPS = 60;
 const std::string Game::WINDOW_TITLE = "DinoRun - Complete OOP Architecture";
+const double Game::DEFAULT_HEADLESS_DURATION = 600.0;   // 10 simulated minutes
+const double Game::DEFAULT_TICK_RATE = 120.0;           // 120 simulation steps per second
+const int Game::DEFAULT_MAX_CATCH_UP_STEPS = 8;         // Drop backlog beyond ~66ms at 120 Hz
+const double Game::PROFILER_OVERLAY_REFRESH = 0.25;     // Overlay text rebuilt 4 times per second
+const std::string Game::PROFILER_CSV_PATH = "frame_profile.csv";
+const int Game::SCORE_MILESTONE_INTERVAL = 200;
+const double Game::STEADY_STATE_WARMUP = 1.0;
+const int Game::SNAPSHOT_CAPACITY = 1024;              // ~8.5 s at 120 Hz
+const int Game::CHECKPOINT_CAPACITY = 1024;            // ~17 replay minutes
+const double Game::REWIND_SECONDS = 3.0;
+const double Game::CHECKPOINT_INTERVAL = 1.0;          // Seeking simulates at most this plus REWIND_SECONDS
+const double Game::SEEK_STEP_SECONDS = 5.0;
 
 // ===== Core Lifecycle Methods =====
 
-Game::Game() 
-    : currentState(GameState::PLAYING),  // Start directly in playing state for now
+Game::Game(const Options& options) 
+    : options(options),
+      tickDuration(1.0 / options.tickRate),
+      tickAccumulator(0.0),
+      interpolationAlpha(1.0),
+      simulationTick(0),
+      runTick(0),
+      lastFrameAllocations(0),
+      snapshotRing(SNAPSHOT_CAPACITY),
+      sessionStart(),
+      rewindTicks(0),
+      checkpointTicks(1),
+      runRewound(false),
+      currentState(GameState::PLAYING),  // Start directly in playing state for now
       previousState(GameState::PLAYING),
       gameTime(0.0),
       currentScore(0),
       highScore(0),
+      sessionCount(1),
+      runPeakSpeed(0.0),
       isRunning(false),
-      fontLoaded(false) {
+      fontLoaded(false),
+      lastScoreMilestone(0),
+      showProfilerOverlay(false),
+      profilerOverlayTimer(0.0),
+      renderThreadActive(false) {
     
-    // Initialize all subsystems in proper order
+    // A replay decides seed and tick rate, so it is read before any system exists
+    if (!options.replayPath.empty()) {
+        loadReplay();
+    }
+    
+    // Headless mode only needs the simulation systems
+    if (options.headless) {
+        // Per-event gameplay logs would only flood the ring at simulation speed
+        Logger::getInstance().setLevel(LogLevel::INFO);
+        frameProfiler.setEnabled(false);  // No frames to profile
+        if (this->options.pixelCollision) {
+            // No textures, no masks: a pixel-collision replay may end differently here
+            DINO_LOG_WARN(COLLISION, "Pixel collision needs the sprite sheets, headless mode uses the collision boxes");
+            this->options.pixelCollision = false;
+        }
+        if (!options.ghostPaths.empty()) {
+            DINO_LOG_WARN(GAME, "Ghosts are only drawn in windowed mode");
+        }
+        initializeSystems();
+        std::cout << "Game system initialized in headless mode!" << std::endl;
+        return;
+    }
+    
+    // Only the journal header is read here; runs are written by its own thread
+    if (options.journal) {
+        scoreJournal = std::make_unique<ScoreJournal>();
+        const std::string& journalPath = options.journalPath.empty() ? ScoreJournal::DEFAULT_PATH : options.journalPath;
+        if (scoreJournal->open(journalPath)) {
+            const ScoreJournal::Summary& summary = scoreJournal->getSummary();
+            highScore = summary.highScore;
+            DINO_LOG_INFO(GAME, "Score journal: {} runs, high score {}", summary.totalRuns, summary.highScore);
+        } else {
+            scoreJournal.reset();
+        }
+    }
+    
+    // The render thread draws from snapshots, which carry no ghosts
+    if (options.threadedRender && !options.ghostPaths.empty()) {
+        DINO_LOG_WARN(GAME, "Ghosts are not drawn with the threaded renderer");
+    } else {
+        for (const std::string& ghostPath : options.ghostPaths) {
+            if (!ghosts.addGhost(ghostPath, this->options.tickRate)) {
+                std::cerr << "Warning: Could not load ghost " << ghostPath << std::endl;
+            }
+        }
+    }
+    
+    // Window first so the loading screen can show up right away;
+    // resources load on worker threads while run() draws it
     initializeWindow();
-    initializeSoundSystem();
-    initializeTextureSystem();  // NEW: Initialize texture system first
-    loadResources();
-    initializeSystems();
-    initializeUI();
+    loadingStart = std::chrono::steady_clock::now();
+    openAssetBundle();
+    startResourceLoading();
     
-    std::cout << "Game system initialized successfully!" << std::endl;
+    std::cout << "Game system initialized, resources loading in background" << std::endl;
 }
 
 Game::~Game() {
     std::cout << "Game system shutting down..." << std::endl;
     
+    // Wait for loading tasks before the members they fill are destroyed
+    resourceLoader.reset();
+    
     // Clean up texture manager
     TextureManager::getInstance().cleanup();
     
@@ -44,6 +135,20 @@ Game::~Game() {
 }
 
 int Game::run() {
+    if (options.headless) {
+        return runHeadless();
+    }
+    
+    // Gameplay starts only once the required resources are in
+    if (!runLoadingScreen()) {
+        return 0;  // Window closed while loading
+    }
+    finishResourceLoading();
+    
+    if (playback && options.seekTick > 0) {
+        fastForward(options.seekTick);
+    }
+    
     std::cout << "Starting main game loop with sprite system..." << std::endl;
     isRunning = true;
     
@@ -53,31 +158,301 @@ int Game::run() {
         std::cerr << "Warning: No textures loaded. Game may not display correctly." << std::endl;
     }
     
+    // Loading screen frames say nothing about gameplay pacing
+    framePacer.resetStats();
+    
+    if (options.threadedRender) {
+        return runThreaded();
+    }
+    
     // Main game loop
+    frameClock.restart();
     while (isRunning && window.isOpen()) {
-        double deltaTime = frameClock.restart().asSeconds();
+        double frameTime = frameClock.restart().asSeconds();
+        frameProfiler.beginFrame();
+        frameArena.reset();
+        AllocationTracker::Scope frameAllocations;
+        
+        // Optional resources (sounds) may still be arriving
+        if (resourceLoader) {
+            resourceLoader->poll();
+            if (resourceLoader->isComplete()) {
+                resourceLoader.reset();
+            }
+        }
         
         // The three pillars of game development: Handle, Update, Render
-        handleEvents();
-        update(deltaTime);
+        // Updates run in fixed ticks so simulation is frame-rate independent
+        {
+            FrameProfiler::ScopedTimer timer(frameProfiler, FrameProfiler::Phase::HANDLE_EVENTS);
+            handleEvents();
+        }
+        maintainFrameRate(frameTime);
+        audioSystem.processQueue();  // Sounds triggered by this frame's ticks
+        
+        // Keyboard takes over where the replay ends
+        if (playback && playback->isFinished(static_cast<uint64_t>(simulationTick))) {
+            DINO_LOG_INFO(GAME, "Replay finished at tick {}, keyboard control", simulationTick);
+            playback.reset();
+        }
         render();
         
-        // Maintain consistent performance
-        maintainFrameRate();
+        frameProfiler.endFrame();
+        updateProfilerOverlay(frameTime);
         
         // Optional: Log debug info every few seconds
         static double debugTimer = 0.0;
-        debugTimer += deltaTime;
+        debugTimer += frameTime;
         if (debugTimer > 10.0 && currentState == GameState::PLAYING) {  // Every 5 seconds
             logDebugInfo();
             debugTimer = 0.0;
         }
+        lastFrameAllocations = frameAllocations.count();
+    }
+    
+    frameProfiler.stopCsvDump();
+    saveRecording();
+    saveStateStream();
+    std::cout << framePacer.formatSummary() << std::endl;
+    std::cout << "Game loop ended. Final score: " << currentScore << std::endl;
+    return 0;
+}
+
+int Game::runThreaded() {
+    // Frame phases now run on two threads; the profiler only measures the single-threaded loop
+    frameProfiler.setEnabled(false);
+    showProfilerOverlay = false;
+    
+    // The render thread starts with a valid snapshot and takes over the GL context
+    publishSnapshot();
+    window.setActive(false);
+    renderThreadActive = true;
+    renderThread = std::thread(&Game::renderThreadLoop, this);
+    DINO_LOG_INFO(GAME, "Threaded rendering started");
+    
+    // Events must stay on the thread that created the window (SFML requirement)
+    frameClock.restart();
+    while (isRunning && window.isOpen()) {
+        double frameTime = frameClock.restart().asSeconds();
+        frameArena.reset();
+        AllocationTracker::Scope frameAllocations;
+        
+        if (resourceLoader) {
+            resourceLoader->poll();
+            if (resourceLoader->isComplete()) {
+                resourceLoader.reset();
+            }
+        }
+        
+        handleEvents();
+        long long ticksBefore = simulationTick;
+        maintainFrameRate(frameTime);
+        audioSystem.processQueue();
+        if (simulationTick != ticksBefore) {
+            publishSnapshot();
+        }
+        
+        if (playback && playback->isFinished(static_cast<uint64_t>(simulationTick))) {
+            DINO_LOG_INFO(GAME, "Replay finished at tick {}, keyboard control", simulationTick);
+            playback.reset();
+        }
+        
+        lastFrameAllocations = frameAllocations.count();
+        
+        // Nothing to do before the next tick is due; display() no longer paces this loop
+        std::this_thread::sleep_for(std::chrono::duration<double>(tickDuration - tickAccumulator));
     }
     
+    renderThreadActive = false;
+    renderThread.join();
+    window.setActive(true);
+    
+    saveRecording();
+    saveStateStream();
+    std::cout << framePacer.formatSummary() << std::endl;
     std::cout << "Game loop ended. Final score: " << currentScore << std::endl;
     return 0;
 }
 
+void Game::publishSnapshot() {
+    RenderSnapshot& snapshot = renderSnapshots.writeBuffer();
+    
+    snapshot.playerX = static_cast<float>(player->getPosX());
+    snapshot.playerY = static_cast<float>(player->getPosY());
+    snapshot.previousPlayerY = static_cast<float>(player->getPreviousPosY());
+    snapshot.playerSprite = player->getSpriteType();
+    snapshot.playerSize = player->getSpriteSize();
+    
+    // Slot is refilled in place: clear() keeps the capacity of earlier frames
+    const ObstacleManager::ObstacleArrays& obstacles = obstacleManager->getObstacleData();
+    snapshot.obstacles.clear();
+    for (size_t i = 0; i < obstacles.size(); ++i) {
+        size_t s = obstacles.slot(i);
+        RenderSnapshot::ObstacleView view;
+        view.x = obstacles.posX[s];
+        view.previousX = obstacles.previousPosX[s];
+        view.y = obstacles.posY[s];
+        view.type = obstacles.type[s];
+        snapshot.obstacles.push_back(view);
+    }
+    
+    background.getOffsets(0.0, snapshot.previousSceneryOffsets);
+    background.getOffsets(1.0, snapshot.sceneryOffsets);
+    
+    snapshot.score = currentScore;
+    snapshot.highScore = highScore;
+    snapshot.gameOver = currentState == GameState::GAME_OVER;
+    
+    // Real time the current tick stands for: the leftover accumulator has already passed it
+    snapshot.tick = static_cast<uint64_t>(simulationTick);
+    snapshot.tickDuration = tickDuration;
+    snapshot.capturedAt = std::chrono::steady_clock::now() -
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(tickAccumulator));
+    
+    renderSnapshots.publish();
+}
+
+void Game::renderThreadLoop() {
+    window.setActive(true);
+    
+    while (renderThreadActive) {
+        renderSnapshots.fetch();  // Keeps the previous snapshot when no tick ran since
+        const RenderSnapshot& snapshot = renderSnapshots.readBuffer();
+        
+        // Same blend as the single-threaded loop, driven by time since the tick instead of the accumulator
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - snapshot.capturedAt).count();
+        double alpha = snapshot.tickDuration > 0.0 ? std::min(std::max(elapsed / snapshot.tickDuration, 0.0), 1.0) : 1.0;
+        
+        renderSnapshot(snapshot, alpha);
+        window.display();
+        framePacer.endFrame(window, snapshot.gameOver);  // Pacing waits block this thread only
+    }
+    
+    window.setActive(false);
+}
+
+void Game::renderSnapshot(const RenderSnapshot& snapshot, double alpha) {
+    window.clear(sf::Color::White);
+    
+    // Scenery, farthest first
+    float sceneryOffsets[ParallaxBackground::LAYER_COUNT];
+    for (int i = 0; i < ParallaxBackground::LAYER_COUNT; ++i) {
+        sceneryOffsets[i] = snapshot.previousSceneryOffsets[i] +
+            (snapshot.sceneryOffsets[i] - snapshot.previousSceneryOffsets[i]) * static_cast<float>(alpha);
+    }
+    background.render(window, sceneryOffsets);
+    
+    // Player and obstacles through the same sprite handles their render() methods use
+    TextureManager& textureManager = TextureManager::getInstance();
+    const TextureManager::SpriteHandle& playerSprite = textureManager.getSpriteHandle(snapshot.playerSprite);
+    float playerY = snapshot.previousPlayerY + (snapshot.playerY - snapshot.previousPlayerY) * static_cast<float>(alpha);
+    snapshotPlayerBatch.clear();
+    snapshotPlayerBatch.add(playerSprite.texture, playerSprite.rect,
+                            sf::Vector2f(snapshot.playerX, playerY), snapshot.playerSize);
+    snapshotPlayerBatch.draw(window);
+    
+    snapshotObstacleBatch.clear();
+    for (const RenderSnapshot::ObstacleView& view : snapshot.obstacles) {
+        const Obstacle::TypeInfo& info = Obstacle::getTypeInfo(view.type);
+        const TextureManager::SpriteHandle& sprite = textureManager.getSpriteHandle(info.spriteType);
+        float x = view.previousX + (view.x - view.previousX) * static_cast<float>(alpha);
+        snapshotObstacleBatch.add(sprite.texture, sprite.rect, sf::Vector2f(x, view.y), info.spriteSize);
+    }
+    snapshotObstacleBatch.draw(window);
+    
+    // HUD: the counters belong to this thread in threaded mode (see updateScoreDisplays)
+    if (!fontLoaded) return;
+    scoreCounter.setValue(snapshot.score);
+    highScoreCounter.setValue(snapshot.highScore);
+    scoreCounter.draw(window);
+    highScoreCounter.draw(window);
+    window.draw(instructionText);
+    if (snapshot.gameOver) {
+        window.draw(gameOverText);
+    }
+}
+
+int Game::runHeadless() {
+    std::cout << "Starting headless simulation for " << options.headlessDuration 
+              << " simulated seconds..." << std::endl;
+    isRunning = true;
+    
+    double simulatedTime = 0.0;
+    long long tickCount = 0;
+    auto wallStart = std::chrono::steady_clock::now();
+    
+    // A replay runs to its recorded end, or stops early at the seek tick
+    bool replaying = playback != nullptr;
+    long long replayEnd = replaying ? static_cast<long long>(playback->getTickCount()) : 0;
+    if (replaying && options.seekTick >= 0 && options.seekTick < replayEnd) {
+        replayEnd = options.seekTick;
+    }
+    
+    // No events, no rendering, no frame limiting: just step the simulation
+    // using the same fixed tick as the windowed loop
+    // Every tick is a frame here: the same arena reset and allocation count as the windowed loop
+    AllocationTracker::Scope tickAllocations;
+    while (isRunning && (replaying ? simulationTick < replayEnd : simulatedTime < options.headlessDuration)) {
+        frameArena.reset();
+        tickAllocations.restart();
+        bool wasPlaying = currentState == GameState::PLAYING && gameTime >= STEADY_STATE_WARMUP;
+        
+        update(tickDuration);
+        simulatedTime += tickDuration;
+        tickCount++;
+        
+        // Ticks that start or end a run (game over, logs, journal) are not steady state
+        if (wasPlaying && currentState == GameState::PLAYING) {
+            headlessReport.steadyTicks++;
+            headlessReport.steadyAllocations += tickAllocations.count();
+        }
+        
+        // Start a fresh session immediately after each game over (replays restart themselves)
+        if (currentState == GameState::GAME_OVER && !replaying) {
+            applyInput(Replay::Input::RESTART);
+        }
+    }
+    
+    std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - wallStart;
+    double wallSeconds = wallTime.count();
+    double speedup = (wallSeconds > 0.0) ? simulatedTime / wallSeconds : 0.0;
+    
+    std::cout << "Headless simulation finished: " << simulatedTime << " simulated s in " 
+              << wallSeconds << " wall s (" << speedup << " simulated s per wall s)" << std::endl;
+    std::cout << "Sessions played: " << sessionCount << ", High score: " << highScore << std::endl;
+    if (replaying) {
+        std::cout << "Replay stopped at tick " << simulationTick << ": "
+                  << (currentState == GameState::GAME_OVER ? "game over" : "playing")
+                  << ", score " << currentScore << ", game time " << gameTime << " s" << std::endl;
+    }
+    saveRecording();
+    saveStateStream();
+    
+    headlessReport.simulatedSeconds = simulatedTime;
+    headlessReport.wallSeconds = wallSeconds;
+    headlessReport.ticks = tickCount;
+    headlessReport.sessions = sessionCount;
+    headlessReport.highScore = highScore;
+    headlessReport.jumps = autoPilot ? autoPilot->getJumpCount() : 0;
+    
+    const CollisionManager::BroadPhaseStats& collisionStats = CollisionManager::getBroadPhaseStats();
+    std::cout << "Collision queries: " << collisionStats.queries 
+              << ", broad-phase candidates: " << collisionStats.candidates 
+              << ", narrow-phase tests: " << collisionStats.narrowPhaseTests 
+              << ", max candidates per query: " << collisionStats.maxCandidatesPerQuery << std::endl;
+    
+    const ObstacleManager::PoolStats& poolStats = obstacleManager->getPoolStats();
+    std::cout << "Obstacle pool: " << poolStats.capacity << " slots, peak " << poolStats.peakCount 
+              << ", spawned " << poolStats.spawned << ", retired " << poolStats.retired 
+              << ", allocations " << poolStats.reallocations << std::endl;
+    if (AllocationTracker::ENABLED) {
+        std::cout << "Steady-state heap allocations: " << headlessReport.steadyAllocations
+                  << " over " << headlessReport.steadyTicks << " ticks (frame arena peak "
+                  << frameArena.getHighWater() << " bytes)" << std::endl;
+    }
+    return 0;
+}
+
 // ===== Initialization Methods =====
 
 void Game::initializeWindow() {
@@ -86,16 +461,27 @@ void Game::initializeWindow() {
                   WINDOW_TITLE, 
                   sf::Style::Titlebar | sf::Style::Close);
     
-    // Enable VSync for smooth rendering
-    window.setVerticalSyncEnabled(true);
-    
-    // Set frame rate limit as backup to VSync
-    window.setFramerateLimit(TARGET_FPS);
+    // One pacing source only: vsync and the frame limit together jitter on high refresh monitors
+    framePacer.configure(window, options.pacing, options.targetFps);
     
     std::cout << "Window initialized: " << WINDOW_WIDTH << "x" << WINDOW_HEIGHT << std::endl;
 }
 
 // ===== Sound System Initialization =====
+bool Game::openAssetBundle() {
+    const std::string& path = options.assetBundlePath.empty() ? AssetBundle::DEFAULT_PATH : options.assetBundlePath;
+    
+    std::unique_ptr<AssetBundle> bundle = std::make_unique<AssetBundle>();
+    if (!bundle->open(path)) {
+        std::cout << "Asset bundle not found at " << path << " - loading individual asset files" << std::endl;
+        return false;
+    }
+    
+    assetBundle = std::move(bundle);
+    std::cout << "Asset bundle mapped: " << path << std::endl;
+    return true;
+}
+
 bool Game::initializeSoundSystem() {
     std::cout << "Initializing sound system..." << std::endl;
     
@@ -122,39 +508,53 @@ bool Game::initializeSoundSystem() {
         "sounds/point.wav"
     };
     
-    // 점프 사운드 로드
-    bool jumpLoaded = false;
-    for (const std::string& path : jumpSoundPaths) {
-        if (loadSoundFile(jumpSoundBuffer, path)) {
-            jumpSound.setBuffer(jumpSoundBuffer);
-            jumpSound.setVolume(70.0f);  // 볼륨 조절 (0-100)
-            jumpLoaded = true;
-            std::cout << "✅ Jump sound loaded from: " << path << std::endl;
-            break;
-        }
-    }
+    // Sounds are optional: decoding runs on workers and may finish after gameplay began.
+    // Workers fill a private buffer; the main thread hands it to the audio system, so playback never races the load
+    std::shared_ptr<sf::SoundBuffer> loadedJump = std::make_shared<sf::SoundBuffer>();
+    resourceLoader->add("jump sound", ResourceLoader::Priority::OPTIONAL,
+        [this, loadedJump, jumpSoundPaths]() {
+            return loadSoundAsset(*loadedJump, "jump", jumpSoundPaths);
+        },
+        [this, loadedJump](bool loaded) {
+            if (!loaded) {
+                // 사운드 파일이 없어도 게임은 계속 진행
+                std::cout << "⚠️ Jump sound file not found - game will run without jump sound" << std::endl;
+                return;
+            }
+            audioSystem.setBuffer(AudioSystem::SoundEffect::JUMP, *loadedJump);
+            if (!audioSystem.hasBuffer(AudioSystem::SoundEffect::SCORE_MILESTONE)) {
+                // Until point.wav arrives (or if it is missing): higher-pitched jump sound
+                audioSystem.setBuffer(AudioSystem::SoundEffect::SCORE_MILESTONE, *loadedJump, 1.5f);
+            }
+        });
     
-    // 게임오버 사운드 로드
-    bool gameOverLoaded = false;
-    for (const std::string& path : gameOverSoundPaths) {
-        if (loadSoundFile(gameOverSoundBuffer, path)) {
-            gameOverSound.setBuffer(gameOverSoundBuffer);
-            gameOverSound.setVolume(80.0f);  // 볼륨 조절
-            gameOverLoaded = true;
-            std::cout << "✅ Game over sound loaded from: " << path << std::endl;
-            break;
-        }
-    }
+    std::shared_ptr<sf::SoundBuffer> loadedGameOver = std::make_shared<sf::SoundBuffer>();
+    resourceLoader->add("game over sound", ResourceLoader::Priority::OPTIONAL,
+        [this, loadedGameOver, gameOverSoundPaths]() {
+            return loadSoundAsset(*loadedGameOver, "gameover", gameOverSoundPaths);
+        },
+        [this, loadedGameOver](bool loaded) {
+            if (!loaded) {
+                std::cout << "⚠️ Game over sound file not found - game will run without game over sound" << std::endl;
+                return;
+            }
+            audioSystem.setBuffer(AudioSystem::SoundEffect::GAME_OVER, *loadedGameOver);
+        });
     
-    // 사운드 파일이 없어도 게임은 계속 진행
-    if (!jumpLoaded) {
-        std::cout << "⚠️ Jump sound file not found - game will run without jump sound" << std::endl;
-    }
-    if (!gameOverLoaded) {
-        std::cout << "⚠️ Game over sound file not found - game will run without game over sound" << std::endl;
-    }
+    std::shared_ptr<sf::SoundBuffer> loadedScore = std::make_shared<sf::SoundBuffer>();
+    resourceLoader->add("score sound", ResourceLoader::Priority::OPTIONAL,
+        [this, loadedScore, scoreSoundPaths]() {
+            return loadSoundAsset(*loadedScore, "point", scoreSoundPaths);
+        },
+        [this, loadedScore](bool loaded) {
+            if (!loaded) {
+                std::cout << "⚠️ Score sound file not found - using jump sound for milestones" << std::endl;
+                return;
+            }
+            audioSystem.setBuffer(AudioSystem::SoundEffect::SCORE_MILESTONE, *loadedScore);
+        });
     
-    std::cout << "Sound system initialization completed" << std::endl;
+    std::cout << "Sound loading queued" << std::endl;
     return true;  // 사운드가 없어도 게임은 계속 실행
 }
 
@@ -165,33 +565,29 @@ bool Game::loadSoundFile(sf::SoundBuffer& buffer, const std::string& filename) {
     return false;
 }
 
-// ===== Sound Playing Methods =====
-void Game::playJumpSound() {
-    // 점프 사운드가 로드되었고 현재 재생 중이 아니라면 재생
-    if (jumpSoundBuffer.getDuration() != sf::Time::Zero && 
-        jumpSound.getStatus() != sf::Sound::Playing) {
-        jumpSound.play();
-        std::cout << "🎵 Playing jump sound" << std::endl;
+bool Game::loadSoundAsset(sf::SoundBuffer& buffer, const std::string& bundleName,
+                          const std::vector<std::string>& fallbackPaths) {
+    if (assetBundle && assetBundle->loadSoundBuffer(bundleName, buffer)) {
+        std::cout << "✅ " << bundleName << " sound loaded from asset bundle" << std::endl;
+        return true;
     }
-}
-
-void Game::playGameOverSound() {
-    // 게임오버 사운드가 로드되었다면 재생
-    if (gameOverSoundBuffer.getDuration() != sf::Time::Zero) {
-        gameOverSound.play();
-        std::cout << "🎵 Playing game over sound" << std::endl;
+    
+    for (const std::string& path : fallbackPaths) {
+        if (loadSoundFile(buffer, path)) {
+            std::cout << "✅ " << bundleName << " sound loaded from: " << path << std::endl;
+            return true;
+        }
     }
+    return false;
 }
 
-void Game::playScoreSound() {
-    // 점수 사운드 (현재는 점프 사운드 재사용, 다른 사운드로 교체 가능)
-    if (jumpSoundBuffer.getDuration() != sf::Time::Zero && 
-        scoreSound.getStatus() != sf::Sound::Playing) {
-        scoreSound.setBuffer(jumpSoundBuffer);
-        scoreSound.setVolume(50.0f);  // 더 조용하게
-        scoreSound.setPitch(1.5f);    // 더 높은 음높이로
-        scoreSound.play();
-        std::cout << "🎵 Playing score sound" << std::endl;
+// ===== Sound Methods =====
+void Game::checkScoreMilestone() {
+    // Crossing test: the score may skip a multiple or stay on it for several ticks
+    int milestone = currentScore / SCORE_MILESTONE_INTERVAL;
+    if (milestone > lastScoreMilestone) {
+        lastScoreMilestone = milestone;
+        audioSystem.enqueue(AudioSystem::SoundEffect::SCORE_MILESTONE);
     }
 }
 
@@ -199,17 +595,108 @@ void Game::playScoreSound() {
 void Game::initializeTextureSystem() {
     std::cout << "Initializing texture management system..." << std::endl;
     
-    // Get TextureManager instance and initialize it
-    TextureManager& textureManager = TextureManager::getInstance();
+    // Decoding runs on workers; the GPU upload happens in the finish step on the main thread
+    const char* const sheetNames[] = {"dino_sheet", "obstacles_sheet"};
+    for (const char* sheetName : sheetNames) {
+        std::string name = sheetName;
+        std::string path = "../assets/sprites/" + name + ".png";   // bin/ 폴더에서 실행
+        std::shared_ptr<sf::Image> image = std::make_shared<sf::Image>();
+        
+        resourceLoader->add(name, ResourceLoader::Priority::REQUIRED,
+            [this, name, path, image]() {
+                if (assetBundle && assetBundle->find(name)) {
+                    return true;  // Bundle pixels are already decoded
+                }
+                return image->loadFromFile(path);
+            },
+            [this, name, image](bool loaded) {
+                if (!loaded) {
+                    return;  // finishSheetLoading() falls back to colored textures
+                }
+                TextureManager& textureManager = TextureManager::getInstance();
+                if (assetBundle && assetBundle->find(name)) {
+                    textureManager.loadTextureFromBundle(name, *assetBundle);
+                } else {
+                    textureManager.loadTextureFromImage(name, *image);
+                }
+            });
+    }
+}
+
+void Game::startResourceLoading() {
+    resourceLoader = std::make_unique<ResourceLoader>();
     
-    if (!textureManager.initialize()) {
-        std::cerr << "Warning: TextureManager initialization failed. Using fallback graphics." << std::endl;
-    } else {
-        std::cout << "TextureManager initialized successfully!" << std::endl;
+    initializeSoundSystem();
+    initializeTextureSystem();
+    
+    // Font file I/O on a worker too; gameFont is not touched on the main thread until UI setup
+    resourceLoader->add("font", ResourceLoader::Priority::REQUIRED, [this]() {
+        loadResources();
+        return fontLoaded;
+    });
+}
+
+bool Game::runLoadingScreen() {
+    while (!resourceLoader->isRequiredReady()) {
+        // Keep the window responsive while workers run
+        while (window.pollEvent(currentEvent)) {
+            if (currentEvent.type == sf::Event::Closed) {
+                window.close();
+                return false;
+            }
+        }
+        
+        resourceLoader->poll();
+        renderLoadingScreen(resourceLoader->getRequiredProgress());
     }
+    return true;
+}
+
+void Game::renderLoadingScreen(float progress) {
+    // Drawn without font or textures: those are what is being loaded
+    const sf::Vector2f barSize(400.0f, 20.0f);
+    const sf::Vector2f barPosition((WINDOW_WIDTH - barSize.x) / 2.0f, (WINDOW_HEIGHT - barSize.y) / 2.0f);
+    
+    sf::RectangleShape frame(barSize);
+    frame.setPosition(barPosition);
+    frame.setFillColor(sf::Color::Transparent);
+    frame.setOutlineColor(sf::Color(83, 83, 83));
+    frame.setOutlineThickness(2.0f);
+    
+    sf::RectangleShape fill(sf::Vector2f(barSize.x * progress, barSize.y));
+    fill.setPosition(barPosition);
+    fill.setFillColor(sf::Color(83, 83, 83));
     
-    // Print debug information about loaded textures
+    window.clear(sf::Color::White);
+    window.draw(fill);
+    window.draw(frame);
+    window.display();
+    framePacer.endFrame(window, false);  // Keeps this loop from spinning in every pacing mode
+}
+
+void Game::finishResourceLoading() {
+    TextureManager& textureManager = TextureManager::getInstance();
+    if (!textureManager.finishSheetLoading()) {
+        std::cerr << "Warning: TextureManager initialization failed. Using fallback graphics." << std::endl;
+    }
     textureManager.printDebugInfo();
+    
+    // Masks are cut from the sheets just loaded, before the first collision check
+    if (options.pixelCollision) {
+        Player::prepareCollisionMasks();
+        Obstacle::prepareCollisionMasks();
+    }
+    
+    // Player sprites need the textures, the UI needs the font
+    if (!background.initialize(static_cast<float>(WINDOW_WIDTH))) {
+        std::cerr << "Warning: Some background layers are unavailable." << std::endl;
+    }
+    initializeSystems();
+    initializeUI();
+    
+    std::chrono::duration<double, std::milli> loadTime = std::chrono::steady_clock::now() - loadingStart;
+    std::cout << "Required assets ready in " << loadTime.count() << " ms"
+              << (assetBundle ? " (asset bundle)" : " (individual files)") << std::endl;
 }
 
 void Game::initializeSystems() {
@@ -217,22 +704,58 @@ void Game::initializeSystems() {
     // The make_unique function is the modern C++ way to create smart pointers
     player = std::make_unique<Player>(100, 400);
     obstacleManager = std::make_unique<ObstacleManager>();
+    obstacleManager->setFrameArena(&frameArena);
+    
+    // Always seed explicitly so every run can be reproduced: pick one if none was given
+    std::random_device seedSource;
+    while (options.seed == 0) {
+        options.seed = seedSource();
+    }
+    obstacleManager->setSeed(options.seed);
+    DINO_LOG_INFO(GAME, "Obstacle seed: {}", options.seed);
+    
+    if (options.autopilot) {
+        autoPilot = std::make_unique<AutoPilot>();
+    }
+    if (!options.recordPath.empty()) {
+        recording = std::make_unique<Replay>();
+        recording->beginRecording(options.seed, options.tickRate, options.autopilot, options.pixelCollision);
+    }
+    if (!options.stateStreamPath.empty()) {
+        stateStream = std::make_unique<StateStream>();
+        stateStream->beginEncoding(options.tickRate);
+    }
+    
+    // Restarts go back to this state; the tick rate is final here (a replay may have changed it)
+    rewindTicks = std::min<long long>(std::llround(REWIND_SECONDS * options.tickRate),
+                                      snapshotRing.getCapacity() - 1);
+    checkpointTicks = std::max<long long>(1, std::llround(CHECKPOINT_INTERVAL * options.tickRate));
+    if (playback) {
+        replayCheckpoints = std::make_unique<SnapshotRing>(CHECKPOINT_CAPACITY);
+    }
+    captureSnapshot(sessionStart);
     
     std::cout << "Game systems initialized: Player, ObstacleManager" << std::endl;
 }
 
 void Game::loadResources() {
+    // Packed font first: the bundle stays mapped for the game's lifetime
+    fontLoaded = assetBundle && assetBundle->loadFont("font", gameFont);
+    if (fontLoaded) {
+        std::cout << "Font loaded from asset bundle" << std::endl;
+        return;
+    }
+    
     // Try multiple font paths for better compatibility across different systems
     std::vector<std::string> fontPaths = {
         "C:/Windows/Fonts/arial.ttf",           // Windows standard path
         "/System/Library/Fonts/Arial.ttf",      // macOS path
         "/usr/share/fonts/truetype/arial.ttf",  // Linux path
         "assets/fonts/arial.ttf",               // Local assets folder
-        "arial.ttf"                             // Current directory fallback
+        "arial.ttf",                            // Current directory fallback
         "../fonts/arial.ttf"                    // Relative path for development
     };
     
-    fontLoaded = false;
     for (const auto& path : fontPaths) {
         if (loadFont(path)) {
             fontLoaded = true;
@@ -256,15 +779,18 @@ void Game::initializeUI() {
     configureText(gameOverText, "GAME OVER! Press R to Restart", 30, 
                   sf::Vector2f(200, 250), sf::Color::Red);
     
-    configureText(scoreText, "Score: 000000", 24, 
-                  sf::Vector2f(20, 20), sf::Color::Black);  // Top-Left corner
+    scoreCounter.setup(gameFont, "Score: ", 24, 
+                       sf::Vector2f(20, 20), sf::Color::Black);  // Top-Left corner
     
-    configureText(highScoreText, "High: 000000", 24, 
-                  sf::Vector2f(20, 50), sf::Color::Black);  // Below current score
+    highScoreCounter.setup(gameFont, "High: ", 24, 
+                           sf::Vector2f(20, 50), sf::Color::Black);  // Below current score
     
-    configureText(instructionText, "Press SPACE BAR or UP key to Jump", 18, 
+    configureText(instructionText, "Press SPACE BAR or UP key to Jump, BACKSPACE after a crash to rewind", 18, 
                   sf::Vector2f(20, WINDOW_HEIGHT - 30), sf::Color::Green); // Bottom-Left corner
     
+    configureText(profilerText, "", 12, 
+                  sf::Vector2f(WINDOW_WIDTH - 220, 20), sf::Color::Blue);   // Top-Right corner
+    
     std::cout << "UI elements initialized successfully" << std::endl;
 }
 
@@ -278,6 +804,14 @@ void Game::handleEvents() {
             return;
         }
         
+        // Replays can be scrubbed in any state
+        if (playback && currentEvent.type == sf::Event::KeyPressed &&
+            (currentEvent.key.code == sf::Keyboard::Left || currentEvent.key.code == sf::Keyboard::Right)) {
+            long long step = std::llround(SEEK_STEP_SECONDS * options.tickRate);
+            seekReplay(simulationTick + (currentEvent.key.code == sf::Keyboard::Left ? -step : step));
+            continue;
+        }
+        
         // Handle state-specific events
         switch (currentState) {
             case GameState::PLAYING:
@@ -294,6 +828,14 @@ void Game::handleEvents() {
 }
 
 void Game::update(double deltaTime) {
+    // Replayed inputs land between ticks, exactly where keyboard events did
+    if (playback) {
+        applyReplayInputs();
+    }
+    
+    // The obstacles only move while playing (the state may change during the tick)
+    bool worldMoved = currentState == GameState::PLAYING;
+    
     // Update based on current game state
     switch (currentState) {
         case GameState::PLAYING:
@@ -309,18 +851,45 @@ void Game::update(double deltaTime) {
     
     // Always update UI regardless of state
     updateScoreDisplays();
+    
+    if (stateStream) {
+        stateStream->encodeTick(*player, *obstacleManager, currentState == GameState::GAME_OVER, worldMoved);
+    }
+    runTick++;
+    ghosts.setTick(static_cast<uint64_t>(runTick));
+    
+    simulationTick++;
+    
+    // Every tick of play is kept for rewinding, replays also keep sparse checkpoints for seeking
+    if (worldMoved) {
+        captureSnapshot(snapshotRing.push());
+    }
+    if (playback && simulationTick % checkpointTicks == 0) {
+        captureSnapshot(replayCheckpoints->push());
+    }
 }
 
 void Game::render() {
     window.clear(sf::Color::White);
     
     // Render game world elements
-    renderGameWorld();
+    {
+        FrameProfiler::ScopedTimer timer(frameProfiler, FrameProfiler::Phase::RENDER_GAME_WORLD);
+        renderGameWorld();
+    }
     
     // Render UI overlay
-    renderUI();
+    {
+        FrameProfiler::ScopedTimer timer(frameProfiler, FrameProfiler::Phase::RENDER_UI);
+        renderUI();
+    }
+    
+    // Profiler overlay is drawn outside the timers it reports on
+    renderProfilerOverlay();
     
+    FrameProfiler::ScopedTimer timer(frameProfiler, FrameProfiler::Phase::DISPLAY);
     window.display();
+    framePacer.endFrame(window, currentState == GameState::GAME_OVER);
 }
 
 // ===== State Management Methods =====
@@ -331,7 +900,7 @@ void Game::changeState(GameState newState) {
     previousState = currentState;
     currentState = newState;
     
-    std::cout << "State changed to: " << static_cast<int>(newState) << std::endl;
+    DINO_LOG_INFO(GAME, "State changed to: {}", newState);
     
     // Handle state-specific initialization
     switch (newState) {
@@ -342,6 +911,7 @@ void Game::changeState(GameState newState) {
         case GameState::GAME_OVER:
             // Finalize score and update high score
             updateHighScore();
+            journalRun();
             break;
         default:
             break;
@@ -353,30 +923,37 @@ void Game::handlePlayingStateEvents() {
         // Handle jump input
         if (currentEvent.key.code == sf::Keyboard::Space || 
             currentEvent.key.code == sf::Keyboard::Up) {
-            if (!player->getIsJumping()) {
-                playJumpSound();  // Play jump sound effect
-            }
-            player->jump();
+            submitKeyboardInput(Replay::Input::JUMP);
         }
         
         // Debug: Allow manual state change for testing
         if (currentEvent.key.code == sf::Keyboard::Escape) {
-            changeState(GameState::GAME_OVER);
+            submitKeyboardInput(Replay::Input::FORCE_GAME_OVER);
         }
 
         // Debug: Toggle debug mode
         if (currentEvent.key.code == sf::Keyboard::D) {
             player->toggleDebugMode();  // D키로 디버깅 모드 토글
+            obstacleManager->setDebugMode(player->isDebugMode());
+        }
+        
+        // Debug: Profiler overlay (P) and per-frame CSV dump (C)
+        if (currentEvent.key.code == sf::Keyboard::P) {
+            showProfilerOverlay = !showProfilerOverlay;
+            profilerOverlayTimer = PROFILER_OVERLAY_REFRESH;  // Refresh text right away
+        }
+        if (currentEvent.key.code == sf::Keyboard::C) {
+            toggleProfilerCsvDump();
         }
 
         if (currentEvent.key.code == sf::Keyboard::Down) {
-            player->startDucking();
+            submitKeyboardInput(Replay::Input::DUCK_START);
         }
     }
 
     if(currentEvent.type == sf::Event::KeyReleased) {
         if (currentEvent.key.code == sf::Keyboard::Down) {
-            player->stopDucking();
+            submitKeyboardInput(Replay::Input::DUCK_STOP);
         }
     }
 }
@@ -385,30 +962,185 @@ void Game::handleGameOverStateEvents() {
     if (currentEvent.type == sf::Event::KeyPressed) {
         // Handle restart input
         if (currentEvent.key.code == sf::Keyboard::R) {
-            changeState(GameState::PLAYING);
+            submitKeyboardInput(Replay::Input::RESTART);
+        }
+        
+        // Practice: retry the last few seconds of this run
+        if (currentEvent.key.code == sf::Keyboard::BackSpace) {
+            submitKeyboardInput(Replay::Input::REWIND);
         }
         
         // Future: Handle menu navigation, settings, etc.
     }
 }
 
+// ===== Input and Replay Methods =====
+
+void Game::applyInput(Replay::Input input) {
+    if (recording) {
+        recording->record(static_cast<uint64_t>(simulationTick), input);
+    }
+    
+    switch (input) {
+        case Replay::Input::JUMP:
+            if (!player->getIsJumping()) {
+                audioSystem.enqueue(AudioSystem::SoundEffect::JUMP);
+            }
+            player->jump();
+            break;
+        case Replay::Input::DUCK_START:
+            player->startDucking();
+            break;
+        case Replay::Input::DUCK_STOP:
+            player->stopDucking();
+            break;
+        case Replay::Input::RESTART:
+            changeState(GameState::PLAYING);
+            sessionCount++;
+            break;
+        case Replay::Input::FORCE_GAME_OVER:
+            changeState(GameState::GAME_OVER);
+            break;
+        case Replay::Input::REWIND:
+            rewindRun();
+            break;
+        default:
+            break;
+    }
+}
+
+void Game::submitKeyboardInput(Replay::Input input) {
+    if (playback) {
+        return;  // The replay owns the controls until it finished
+    }
+    applyInput(input);
+}
+
+void Game::applyReplayInputs() {
+    Replay::Input input;
+    while (playback->nextInput(static_cast<uint64_t>(simulationTick), input)) {
+        applyInput(input);
+    }
+}
+
+bool Game::loadReplay() {
+    std::unique_ptr<Replay> replay = std::make_unique<Replay>();
+    if (!replay->load(options.replayPath)) {
+        std::cerr << "Warning: Could not load replay " << options.replayPath << ", starting a normal game" << std::endl;
+        return false;
+    }
+    
+    // The recorded run's settings, or the simulation would diverge on the first tick
+    options.seed = replay->getSeed();
+    options.tickRate = replay->getTickRate();
+    options.autopilot = replay->isAutopilot();
+    options.pixelCollision = replay->isPixelCollision();
+    tickDuration = 1.0 / options.tickRate;
+    playback = std::move(replay);
+    
+    std::cout << "Playing replay " << options.replayPath << " (" << playback->getTickCount() 
+              << " ticks, " << playback->getEventCount() << " inputs)" << std::endl;
+    return true;
+}
+
+void Game::fastForward(long long targetTick) {
+    auto wallStart = std::chrono::steady_clock::now();
+    while (simulationTick < targetTick) {
+        update(tickDuration);
+    }
+    audioSystem.stopAll();  // Drop sounds queued while skipping
+    
+    std::chrono::duration<double, std::milli> wallTime = std::chrono::steady_clock::now() - wallStart;
+    DINO_LOG_INFO(GAME, "Fast-forwarded to tick {} in {} ms", simulationTick, wallTime.count());
+}
+
+void Game::seekReplay(long long targetTick) {
+    if (!playback) return;
+    if (recording || stateStream) {
+        DINO_LOG_WARN(GAME, "Replay seeking is disabled while recording or writing a state stream");
+        return;
+    }
+    
+    targetTick = std::max(0LL, std::min(targetTick, static_cast<long long>(playback->getTickCount())));
+    if (targetTick < simulationTick) {
+        // Restore far enough back that a recorded rewind after the target finds its snapshots again
+        long long restoreTick = targetTick - rewindTicks;
+        const SimulationSnapshot* snapshot = snapshotRing.findAtOrBefore(restoreTick);
+        const SimulationSnapshot* checkpoint = replayCheckpoints->findAtOrBefore(restoreTick);
+        if (!snapshot || (checkpoint && checkpoint->tick > snapshot->tick)) {
+            snapshot = checkpoint;
+        }
+        if (!snapshot) {
+            snapshot = &sessionStart;  // Older than every checkpoint: start of the replay
+        }
+        
+        restoreSnapshot(*snapshot, true);
+        simulationTick = snapshot->tick;
+        sessionCount = snapshot->session;
+        currentState = static_cast<GameState>(snapshot->gameState);
+        previousState = currentState;
+        playback->seek(static_cast<uint64_t>(simulationTick));
+        
+        // Snapshots up to the restored tick stay valid, newer ones are captured again
+        snapshotRing.dropAfter(simulationTick);
+        replayCheckpoints->dropAfter(simulationTick);
+    }
+    fastForward(targetTick);
+}
+
+void Game::saveRecording() {
+    if (!recording) return;
+    
+    if (recording->save(options.recordPath, static_cast<uint64_t>(simulationTick))) {
+        std::cout << "Replay written to " << options.recordPath << " (seed " << options.seed << ")" << std::endl;
+    }
+    recording.reset();
+}
+
+void Game::saveStateStream() {
+    if (!stateStream) return;
+    
+    if (stateStream->save(options.stateStreamPath) && stateStream->getTickCount() > 0) {
+        std::cout << "State stream written to " << options.stateStreamPath << " ("
+                  << stateStream->getBytes().size() << " bytes over "
+                  << stateStream->getTickCount() << " ticks)" << std::endl;
+    }
+    stateStream.reset();
+}
+
 void Game::updatePlayingState(double deltaTime) {
+    // Scripted input is applied at the start of the tick, like keyboard events
+    if (autoPilot) {
+        autoPilot->update(*player, *obstacleManager);
+    }
+    
     // Update game time for score calculation and difficulty
     gameTime += deltaTime;
     
     // Update all game systems in proper order
-    player->update(deltaTime);
-    obstacleManager->update(deltaTime, gameTime);
+    {
+        FrameProfiler::ScopedTimer timer(frameProfiler, FrameProfiler::Phase::PLAYER_UPDATE);
+        player->update(deltaTime);
+    }
+    {
+        FrameProfiler::ScopedTimer timer(frameProfiler, FrameProfiler::Phase::OBSTACLE_UPDATE);
+        obstacleManager->update(deltaTime, gameTime);
+    }
+    background.update(deltaTime, obstacleManager->getCurrentSpeed());  // Scenery stops with the obstacles
+    runPeakSpeed = std::max(runPeakSpeed, obstacleManager->getCurrentSpeed());
     
     // Calculate current score
     currentScore = calculateScore();
-    if (currentScore > 0 && currentScore % 200 == 0) {
-        playScoreSound();  // Play score sound effect at milestones
-    }
+    checkScoreMilestone();
     
     // Check for game-ending conditions
-    if (checkCollisions()) {
-        playGameOverSound();  // Play game over sound effect
+    bool collided = false;
+    {
+        FrameProfiler::ScopedTimer timer(frameProfiler, FrameProfiler::Phase::CHECK_COLLISIONS);
+        collided = checkCollisions();
+    }
+    if (collided) {
+        audioSystem.enqueue(AudioSystem::SoundEffect::GAME_OVER);
         changeState(GameState::GAME_OVER);
     }
 }
@@ -430,45 +1162,110 @@ int Game::calculateScore() const {
 }
 
 void Game::updateHighScore() {
+    if (runRewound) return;  // Practice runs do not count
+    
     if (currentScore > highScore) {
         highScore = currentScore;
-        std::cout << "New high score: " << highScore << std::endl;
+        DINO_LOG_INFO(GAME, "New high score: {}", highScore);
     }
 }
 
+void Game::journalRun() {
+    if (!scoreJournal || playback || runRewound) return;
+    
+    scoreJournal->append(ScoreJournal::makeRecord(currentScore, gameTime, runPeakSpeed,
+                                                  obstacleManager->getCurrentPatternName(),
+                                                  options.seed, options.autopilot));
+}
+
 bool Game::checkCollisions() const {
     // Delegate collision detection to the specialized manager
+    if (options.pixelCollision) {
+        return CollisionManager::checkPlayerObstacleCollisionPixel(*player, *obstacleManager);
+    }
     return CollisionManager::checkPlayerObstacleCollisionTriple(*player, *obstacleManager);
 }
 
 void Game::resetGame() {
-    // Reset all game state for a fresh start
-    gameTime = 0.0;
-    currentScore = 0;
+    // Back to the state captured at startup; the obstacle generator keeps its
+    // sequence, so every session still gets new obstacles
+    restoreSnapshot(sessionStart, false);  // Ghosts start over with the local run
     
-    // Reset all systems to initial state
-    player->reset();
-    obstacleManager->clear();
+    DINO_LOG_INFO(GAME, "Game reset to initial state");
+}
+
+// ===== Snapshot Methods =====
+
+void Game::captureSnapshot(SimulationSnapshot& snapshot) const {
+    snapshot.tick = simulationTick;
+    snapshot.session = sessionCount;
+    snapshot.gameState = static_cast<int>(currentState);
+    snapshot.runTick = runTick;
+    snapshot.gameTime = gameTime;
+    snapshot.score = currentScore;
+    snapshot.lastScoreMilestone = lastScoreMilestone;
+    snapshot.runPeakSpeed = runPeakSpeed;
+    snapshot.practiceRun = runRewound;
+    player->saveSnapshot(snapshot.player);
+    obstacleManager->saveSnapshot(snapshot.obstacles);
+}
+
+void Game::restoreSnapshot(const SimulationSnapshot& snapshot, bool restoreHistory) {
+    gameTime = snapshot.gameTime;
+    currentScore = snapshot.score;
+    lastScoreMilestone = snapshot.lastScoreMilestone;
+    runPeakSpeed = snapshot.runPeakSpeed;
+    runRewound = snapshot.practiceRun;
+    runTick = snapshot.runTick;
+    ghosts.setTick(static_cast<uint64_t>(runTick));
+    player->restoreSnapshot(snapshot.player);
+    obstacleManager->restoreSnapshot(snapshot.obstacles, restoreHistory);
+}
+
+void Game::rewindRun() {
+    if (currentState != GameState::GAME_OVER) return;
     
-    std::cout << "Game reset to initial state" << std::endl;
+    // The newest snapshot is the collision tick; walk back without crossing into the previous session
+    const SimulationSnapshot* target = nullptr;
+    for (long long back = 1; back <= rewindTicks; ++back) {
+        const SimulationSnapshot* candidate = snapshotRing.fromNewest(static_cast<size_t>(back));
+        if (!candidate || candidate->session != sessionCount) {
+            break;
+        }
+        target = candidate;
+    }
+    if (!target) {
+        return;  // Crashed on the first tick: nothing to go back to
+    }
+    
+    // The generator comes back too, so the same obstacles follow (the hard pattern can be retried)
+    restoreSnapshot(*target, true);
+    snapshotRing.dropAfter(target->tick);
+    runRewound = true;
+    
+    // Straight back to PLAYING: changeState() would start a new run
+    previousState = currentState;
+    currentState = GameState::PLAYING;
+    DINO_LOG_INFO(GAME, "Rewound {} ticks to game time {} s (practice run)", simulationTick - target->tick, gameTime);
 }
 
 // ===== UI Management Methods =====
 
 void Game::updateScoreDisplays() {
     if (!fontLoaded) return;
+    if (options.threadedRender) return;  // Render thread sets the counters from snapshots
     
-    // Update score text with proper formatting
-    scoreText.setString("Score: " + formatScore(currentScore));
-    highScoreText.setString("High: " + formatScore(highScore));
+    // Runs every tick, also in GAME_OVER: the counters skip unchanged values
+    scoreCounter.setValue(currentScore);
+    highScoreCounter.setValue(highScore);
 }
 
 void Game::renderUI() {
     if (!fontLoaded) return;
     
     // Always render score information
-    window.draw(scoreText);
-    window.draw(highScoreText);
+    scoreCounter.draw(window);
+    highScoreCounter.draw(window);
     window.draw(instructionText);
     
     // Render state-specific UI elements
@@ -484,29 +1281,75 @@ void Game::renderUI() {
 
 // ===== Updated renderGameWorld method with enhanced rendering =====
 void Game::renderGameWorld() {
-    // Future: Render background sprite here
-    // TextureManager& tm = TextureManager::getInstance();
-    // sf::Sprite background = tm.createSprite(TextureManager::SpriteType::BACKGROUND);
-    // window.draw(background);
-    
-    // Render all game world elements in proper order
-    player->render(window);
-    obstacleManager->render(window);
+    // Render all game world elements in proper order: scenery (farthest first), then actors
+    background.render(window, interpolationAlpha);
+    ghosts.render(window, interpolationAlpha);
+    player->render(window, interpolationAlpha);
+    obstacleManager->render(window, interpolationAlpha);
     
     // Future: Add particle effects, foreground elements, etc.
 }
 
+// ===== Profiler Overlay =====
+
+void Game::updateProfilerOverlay(double frameTime) {
+    if (!showProfilerOverlay || !fontLoaded) return;
+    
+    profilerOverlayTimer += frameTime;
+    if (profilerOverlayTimer >= PROFILER_OVERLAY_REFRESH) {
+        profilerText.setString(frameProfiler.formatSummary() + "\n" + framePacer.formatSummary());
+        profilerOverlayTimer = 0.0;
+    }
+}
+
+void Game::renderProfilerOverlay() {
+    if (!showProfilerOverlay || !fontLoaded) return;
+    window.draw(profilerText);
+}
+
+void Game::toggleProfilerCsvDump() {
+    if (frameProfiler.isCsvDumpActive()) {
+        frameProfiler.stopCsvDump();
+        DINO_LOG_INFO(GAME, "Profiler CSV dump stopped: {}", PROFILER_CSV_PATH);
+    } else if (frameProfiler.startCsvDump(PROFILER_CSV_PATH)) {
+        DINO_LOG_INFO(GAME, "Profiler CSV dump started: {}", PROFILER_CSV_PATH);
+    } else {
+        DINO_LOG_WARN(GAME, "Could not open profiler CSV file: {}", PROFILER_CSV_PATH);
+    }
+    profilerOverlayTimer = PROFILER_OVERLAY_REFRESH;  // Show recording state right away
+}
+
 // ===== Performance and Utility Methods =====
 
-void Game::maintainFrameRate() {
-    // VSync and frame rate limiting handle most timing,
-    // but we could add additional performance monitoring here
+void Game::maintainFrameRate(double frameTime) {
+    // Consume real time in fixed simulation ticks
+    tickAccumulator += frameTime;
+    
+    int steps = 0;
+    while (tickAccumulator >= tickDuration && steps < options.maxCatchUpSteps) {
+        update(tickDuration);
+        tickAccumulator -= tickDuration;
+        ++steps;
+    }
+    
+    // After a long hitch, drop the backlog instead of spiralling into ever more catch-up work
+    if (tickAccumulator >= tickDuration) {
+        tickAccumulator = std::fmod(tickAccumulator, tickDuration);
+    }
+    
+    // Fraction of a tick left over: used to blend the last two simulation states
+    interpolationAlpha = tickAccumulator / tickDuration;
+}
+
+const Game::HeadlessReport& Game::getHeadlessReport() const {
+    return headlessReport;
 }
 
-std::string Game::formatScore(int score) const {
-    std::stringstream ss;
-    ss << std::setfill('0') << std::setw(6) << score;
-    return ss.str();
+std::string Game::formatScore(int score) {
+    // Same digits as the HUD counters, without a stringstream
+    char digits[HudCounter::DIGIT_COUNT];
+    HudCounter::formatDigits(score, digits);
+    return std::string(digits, HudCounter::DIGIT_COUNT);
 }
 
 // ===== Updated logDebugInfo method with texture information =====
@@ -518,15 +1361,37 @@ void Game::logDebugInfo() const {
     std::cout << "Player Position: (" << player->getPosX() << ", " << player->getPosY() << ")" << std::endl;
     std::cout << "Obstacles Count: " << obstacleManager->getObstacleCount() << std::endl;
     
+    // Collision broad phase counters (should stay a handful per query)
+    const CollisionManager::BroadPhaseStats& collisionStats = CollisionManager::getBroadPhaseStats();
+    std::cout << "Collision Queries: " << collisionStats.queries 
+              << ", Candidates: " << collisionStats.candidates 
+              << ", Narrow Tests: " << collisionStats.narrowPhaseTests 
+              << ", Max Candidates/Query: " << collisionStats.maxCandidatesPerQuery << std::endl;
+    
     // Texture system debug info
     TextureManager& textureManager = TextureManager::getInstance();
-    std::cout << "Loaded Textures: " << textureManager.getLoadedTextureCount() << std::endl;
+    std::cout << "Loaded Textures: " << textureManager.getLoadedTextureCount() 
+              << " (" << getTextureMemoryUsage() / 1024 << " KB)" << std::endl;
+    
+    // Frame profiler summary over the rolling window
+    FrameProfiler::PhaseStats frameStats = frameProfiler.getFrameStats();
+    std::cout << "Frame Time (ms): min " << frameStats.minMs << ", avg " << frameStats.avgMs 
+              << ", p99 " << frameStats.p99Ms << std::endl;
+    std::cout << "Frame Pacing: " << framePacer.formatSummary() << std::endl;
+    if (AllocationTracker::ENABLED) {
+        std::cout << "Heap Allocations: " << lastFrameAllocations << " last frame, frame arena peak "
+                  << frameArena.getHighWater() << " of " << frameArena.getCapacity() << " bytes" << std::endl;
+    }
     
     std::cout << "==============================\n" << std::endl;
 }
 
 // ===== Resource Management Helpers =====
 
+size_t Game::getTextureMemoryUsage() const {
+    return TextureManager::getInstance().getTextureMemoryUsage();
+}
+
 bool Game::loadFont(const std::string& fontPath) {
     return gameFont.loadFromFile(fontPath);
 }
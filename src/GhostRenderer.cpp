@@ -0,0 +1,72 @@
+#include "GhostRenderer.hpp"
+#include "Logger.hpp"
+#include "Player.hpp"
+#include "TextureManager.hpp"
+#include <cmath>
+
+// ===== Static Member Definitions =====
+
+const uint8_t GhostRenderer::GHOST_ALPHA = 90;
+
+// ===== Core Methods =====
+
+bool GhostRenderer::addGhost(const std::string& path, double tickRate) {
+    Ghost ghost;
+    ghost.stream = std::make_unique<StateStream>();
+    if (!ghost.stream->load(path)) {
+        return false;
+    }
+    if (std::fabs(ghost.stream->getTickRate() - tickRate) > 1e-9) {
+        DINO_LOG_WARN(GAME, "Ghost {} was recorded at {} ticks/s, plays at {} ticks/s",
+                      path, ghost.stream->getTickRate(), tickRate);
+    }
+
+    DINO_LOG_INFO(GAME, "Ghost {} loaded ({} bytes)", path, ghost.stream->getBytes().size());
+    ghosts.push_back(std::move(ghost));
+    return true;
+}
+
+void GhostRenderer::setTick(uint64_t tick) {
+    for (Ghost& ghost : ghosts) {
+        StateStream& stream = *ghost.stream;
+        if (tick == stream.getTickCount() || (ghost.finished && tick > stream.getTickCount())) {
+            continue;  // Already there, or past the end of its run
+        }
+        if (tick == stream.getTickCount() + 1) {
+            ghost.finished = !stream.decodeTick();
+            continue;
+        }
+        ghost.finished = !stream.seek(tick);
+    }
+}
+
+void GhostRenderer::render(sf::RenderTarget& target, float alpha) {
+    if (ghosts.empty()) return;
+
+    TextureManager& textureManager = TextureManager::getInstance();
+    const sf::Color tint(255, 255, 255, GHOST_ALPHA);
+    const sf::Vector2f defaultSize = Player::getDefaultSize();
+    const sf::Vector2f duckingSize = Player::getDuckingSize();
+
+    batch.clear();
+    for (const Ghost& ghost : ghosts) {
+        const StateStream::State& state = ghost.stream->getState();
+        if (ghost.finished || (state.flags & StateStream::FLAG_GAME_OVER) || ghost.stream->getKeyframeCount() == 0) {
+            continue;
+        }
+
+        TextureManager::SpriteType spriteType =
+            static_cast<TextureManager::SpriteType>(state.flags & StateStream::FLAG_SPRITE_MASK);
+        const TextureManager::SpriteHandle& handle = textureManager.getSpriteHandle(spriteType);
+        if (!handle.texture) continue;
+
+        float y = state.previousPlayerY + (state.playerY - state.previousPlayerY) * alpha;
+        batch.add(handle.texture, handle.rect, sf::Vector2f(state.playerX, y),
+                  (state.flags & StateStream::FLAG_SMALL) ? duckingSize : defaultSize, tint);
+    }
+    batch.draw(target);
+}
+
+size_t GhostRenderer::getGhostCount() const {
+    return ghosts.size();
+}
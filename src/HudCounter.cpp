@@ -0,0 +1,129 @@
+#include "HudCounter.hpp"
+#include <algorithm>
+#include <cstring>
+
+// ===== Static Member Definitions =====
+
+const size_t HudCounter::DIGIT_COUNT;
+const int HudCounter::MAX_VALUE;
+const size_t HudCounter::VERTICES_PER_DIGIT;
+
+// ===== Core Methods =====
+
+HudCounter::HudCounter()
+    : font(nullptr),
+      characterSize(0),
+      slotAdvance(0.0f),
+      color(sf::Color::Black),
+      shownValue(-1),
+      relayoutCount(0) {
+    std::memset(shownDigits, 0, sizeof(shownDigits));
+}
+
+void HudCounter::setup(const sf::Font& fontToUse, const std::string& labelText, unsigned int size,
+                       const sf::Vector2f& position, const sf::Color& fillColor) {
+    font = &fontToUse;
+    characterSize = size;
+    color = fillColor;
+
+    label.setFont(fontToUse);
+    label.setString(labelText);
+    label.setCharacterSize(size);
+    label.setFillColor(fillColor);
+    label.setPosition(position);
+
+    // Look the ten glyphs up once; a slot is as wide as the widest digit so
+    // proportional fonts keep the number from jittering as it counts
+    slotAdvance = 0.0f;
+    for (int i = 0; i < 10; ++i) {
+        const sf::Glyph& glyph = fontToUse.getGlyph(static_cast<sf::Uint32>('0' + i), size, false);
+        digitGlyphs[i].bounds = glyph.bounds;
+        digitGlyphs[i].textureRect = sf::FloatRect(glyph.textureRect);
+        slotAdvance = std::max(slotAdvance, glyph.advance);
+    }
+
+    // sf::Text puts the first baseline characterSize pixels below its position
+    sf::Vector2f labelEnd = label.findCharacterPos(labelText.size());
+    digitOrigin = sf::Vector2f(labelEnd.x, position.y + static_cast<float>(size));
+
+    // Force a full layout on the next setValue()
+    std::memset(shownDigits, 0, sizeof(shownDigits));
+    shownValue = -1;
+    relayoutCount = 0;
+}
+
+bool HudCounter::setValue(int value) {
+    value = std::min(std::max(value, 0), MAX_VALUE);
+    if (value == shownValue) {
+        return false;
+    }
+
+    char digits[DIGIT_COUNT];
+    formatDigits(value, digits);
+
+    // Usually only the last digit or two change between updates
+    for (size_t slot = 0; slot < DIGIT_COUNT; ++slot) {
+        if (digits[slot] != shownDigits[slot]) {
+            writeDigitQuad(slot, digits[slot]);
+            shownDigits[slot] = digits[slot];
+        }
+    }
+
+    shownValue = value;
+    return true;
+}
+
+void HudCounter::draw(sf::RenderTarget& target) const {
+    if (!font) return;
+
+    target.draw(label);
+
+    sf::RenderStates states;
+    states.texture = &font->getTexture(characterSize);  // Looked up per draw: the page may have grown
+    target.draw(vertices, DIGIT_COUNT * VERTICES_PER_DIGIT, sf::Triangles, states);
+}
+
+size_t HudCounter::getRelayoutCount() const {
+    return relayoutCount;
+}
+
+void HudCounter::formatDigits(int value, char digits[DIGIT_COUNT]) {
+    value = std::min(std::max(value, 0), MAX_VALUE);
+
+    // Fill from the right so leading slots end up as zero padding
+    for (size_t i = DIGIT_COUNT; i > 0; --i) {
+        digits[i - 1] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+}
+
+// ===== Private Helper Methods =====
+
+void HudCounter::writeDigitQuad(size_t slot, char digit) {
+    const DigitGlyph& glyph = digitGlyphs[digit - '0'];
+
+    float left = digitOrigin.x + slotAdvance * static_cast<float>(slot) + glyph.bounds.left;
+    float top = digitOrigin.y + glyph.bounds.top;
+    float right = left + glyph.bounds.width;
+    float bottom = top + glyph.bounds.height;
+
+    float u0 = glyph.textureRect.left;
+    float v0 = glyph.textureRect.top;
+    float u1 = glyph.textureRect.left + glyph.textureRect.width;
+    float v1 = glyph.textureRect.top + glyph.textureRect.height;
+
+    sf::Vertex topLeft(sf::Vector2f(left, top), color, sf::Vector2f(u0, v0));
+    sf::Vertex topRight(sf::Vector2f(right, top), color, sf::Vector2f(u1, v0));
+    sf::Vertex bottomRight(sf::Vector2f(right, bottom), color, sf::Vector2f(u1, v1));
+    sf::Vertex bottomLeft(sf::Vector2f(left, bottom), color, sf::Vector2f(u0, v1));
+
+    sf::Vertex* quad = &vertices[slot * VERTICES_PER_DIGIT];
+    quad[0] = topLeft;
+    quad[1] = topRight;
+    quad[2] = bottomRight;
+    quad[3] = topLeft;
+    quad[4] = bottomRight;
+    quad[5] = bottomLeft;
+
+    ++relayoutCount;
+}
@@ -0,0 +1,267 @@
+#include "Logger.hpp"
+#include <iostream>
+#include <sstream>
+#include <chrono>
+#include <cstring>
+#include <algorithm>
+
+// ===== Static Member Definitions =====
+
+const size_t Logger::MAX_ARGS;
+const size_t Logger::TEXT_CAPACITY;
+const size_t Logger::RING_CAPACITY;
+
+static_assert((Logger::RING_CAPACITY & (Logger::RING_CAPACITY - 1)) == 0,
+              "Logger ring capacity must be a power of 2");
+
+// Idle wait of the drain thread when the ring is empty
+static const std::chrono::milliseconds DRAIN_IDLE_SLEEP(2);
+
+static const char* const LEVEL_NAMES[] = {"TRACE", "DEBUG", "INFO", "WARN", "ERROR"};
+static const char* const CATEGORY_NAMES[] = {"Game", "Player", "Obstacle", "Collision", "Texture", "Audio"};
+
+// ===== Core Methods =====
+
+Logger::Logger()
+    : ring(new Slot[RING_CAPACITY]),
+      enqueuePosition(0),
+      dequeuePosition(0),
+      droppedCount(0),
+      running(true) {
+
+    // Slot i is free for the producer that claims position i
+    for (size_t i = 0; i < RING_CAPACITY; ++i) {
+        ring[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    for (size_t i = 0; i < static_cast<size_t>(LogCategory::COUNT); ++i) {
+        categoryLevels[i].store(DINO_LOG_MIN_LEVEL, std::memory_order_relaxed);
+    }
+
+    drainThread = std::thread(&Logger::drainLoop, this);
+}
+
+Logger::~Logger() {
+    shutdown();
+}
+
+Logger& Logger::getInstance() {
+    // Unlike TextureManager, log calls can come from any thread
+    static Logger logger;
+    return logger;
+}
+
+void Logger::shutdown() {
+    if (!running.exchange(false)) {
+        return;  // Already stopped
+    }
+
+    // Stop accepting new messages, then let the thread write what is queued
+    setLevel(static_cast<LogLevel>(DINO_LOG_LEVEL_OFF));
+    if (drainThread.joinable()) {
+        drainThread.join();
+    }
+    drain();
+
+    size_t dropped = getDroppedCount();
+    if (dropped > 0) {
+        std::cerr << "Logger: " << dropped << " messages dropped (ring full)" << std::endl;
+    }
+}
+
+// ===== Runtime Filtering =====
+
+void Logger::setCategoryLevel(LogCategory category, LogLevel level) {
+    categoryLevels[static_cast<size_t>(category)].store(static_cast<unsigned char>(level), std::memory_order_relaxed);
+}
+
+void Logger::setLevel(LogLevel level) {
+    for (size_t i = 0; i < static_cast<size_t>(LogCategory::COUNT); ++i) {
+        categoryLevels[i].store(static_cast<unsigned char>(level), std::memory_order_relaxed);
+    }
+}
+
+size_t Logger::getDroppedCount() const {
+    return droppedCount.load(std::memory_order_relaxed);
+}
+
+// ===== Ring Buffer =====
+
+Logger::Slot* Logger::claimSlot() {
+    size_t position = enqueuePosition.load(std::memory_order_relaxed);
+
+    while (true) {
+        Slot* slot = &ring[position & (RING_CAPACITY - 1)];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        long long difference = static_cast<long long>(sequence) - static_cast<long long>(position);
+
+        if (difference == 0) {
+            // Slot is free for this position: try to take it
+            if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                return slot;
+            }
+            // CAS failure reloaded position, retry
+        } else if (difference < 0) {
+            // Slot still holds an undrained record from one lap ago
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        } else {
+            // Another producer got here first
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void Logger::publishSlot(Slot* slot) {
+    // Sequence = position + 1 marks the record as ready for the drain thread
+    size_t sequence = slot->sequence.load(std::memory_order_relaxed);
+    slot->sequence.store(sequence + 1, std::memory_order_release);
+}
+
+size_t Logger::drain() {
+    size_t written = 0;
+    bool wroteError = false;
+
+    while (true) {
+        Slot* slot = &ring[dequeuePosition & (RING_CAPACITY - 1)];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        if (sequence != dequeuePosition + 1) {
+            break;  // Next record not published yet
+        }
+
+        const Record& record = slot->record;
+        std::string line = formatRecord(record);
+        if (record.level >= LogLevel::WARN) {
+            std::cerr << line << '\n';
+            wroteError = true;
+        } else {
+            std::cout << line << '\n';
+        }
+
+        // Free the slot for the producer one lap ahead
+        slot->sequence.store(dequeuePosition + RING_CAPACITY, std::memory_order_release);
+        dequeuePosition++;
+        written++;
+    }
+
+    // One flush per batch instead of one per line
+    if (written > 0) {
+        std::cout.flush();
+        if (wroteError) {
+            std::cerr.flush();
+        }
+    }
+
+    return written;
+}
+
+void Logger::drainLoop() {
+    while (running.load(std::memory_order_acquire)) {
+        if (drain() == 0) {
+            std::this_thread::sleep_for(DRAIN_IDLE_SLEEP);
+        }
+    }
+}
+
+std::string Logger::formatRecord(const Record& record) {
+    std::ostringstream line;
+    line << '[' << LEVEL_NAMES[static_cast<size_t>(record.level)] << "]["
+         << CATEGORY_NAMES[static_cast<size_t>(record.category)] << "] ";
+
+    // Replace each "{}" with the next argument; extra placeholders are kept as-is
+    size_t argIndex = 0;
+    for (const char* c = record.format; *c != '\0'; ++c) {
+        if (c[0] == '{' && c[1] == '}' && argIndex < record.argCount) {
+            const Arg& arg = record.args[argIndex++];
+            switch (arg.type) {
+                case ArgType::INT:    line << arg.intValue; break;
+                case ArgType::UINT:   line << arg.uintValue; break;
+                case ArgType::DOUBLE: line << arg.doubleValue; break;
+                case ArgType::BOOL:   line << (arg.boolValue ? "true" : "false"); break;
+                case ArgType::TEXT:   line << (record.text + arg.textOffset); break;
+            }
+            ++c;  // Skip the closing brace
+        } else {
+            line << *c;
+        }
+    }
+
+    return line.str();
+}
+
+// ===== Argument Capture =====
+
+void Logger::storeArg(Record& record, bool value) {
+    Arg& arg = record.args[record.argCount++];
+    arg.type = ArgType::BOOL;
+    arg.boolValue = value;
+}
+
+void Logger::storeArg(Record& record, char value) {
+    storeText(record, &value, 1);
+}
+
+void Logger::storeArg(Record& record, int value) {
+    storeArg(record, static_cast<long long>(value));
+}
+
+void Logger::storeArg(Record& record, long value) {
+    storeArg(record, static_cast<long long>(value));
+}
+
+void Logger::storeArg(Record& record, long long value) {
+    Arg& arg = record.args[record.argCount++];
+    arg.type = ArgType::INT;
+    arg.intValue = value;
+}
+
+void Logger::storeArg(Record& record, unsigned int value) {
+    storeArg(record, static_cast<unsigned long long>(value));
+}
+
+void Logger::storeArg(Record& record, unsigned long value) {
+    storeArg(record, static_cast<unsigned long long>(value));
+}
+
+void Logger::storeArg(Record& record, unsigned long long value) {
+    Arg& arg = record.args[record.argCount++];
+    arg.type = ArgType::UINT;
+    arg.uintValue = value;
+}
+
+void Logger::storeArg(Record& record, float value) {
+    storeArg(record, static_cast<double>(value));
+}
+
+void Logger::storeArg(Record& record, double value) {
+    Arg& arg = record.args[record.argCount++];
+    arg.type = ArgType::DOUBLE;
+    arg.doubleValue = value;
+}
+
+void Logger::storeArg(Record& record, const char* value) {
+    const char* text = value ? value : "(null)";
+    storeText(record, text, std::strlen(text));
+}
+
+void Logger::storeArg(Record& record, const std::string& value) {
+    storeText(record, value.data(), value.size());
+}
+
+void Logger::storeText(Record& record, const char* text, size_t length) {
+    Arg& arg = record.args[record.argCount++];
+    arg.type = ArgType::TEXT;
+    arg.textOffset = record.textUsed;
+
+    // Keep room for the terminator; later strings get whatever space is left
+    size_t available = TEXT_CAPACITY - record.textUsed - 1;
+    size_t copied = std::min(length, available);
+    std::memcpy(record.text + record.textUsed, text, copied);
+    record.text[record.textUsed + copied] = '\0';
+    record.textUsed = static_cast<unsigned char>(record.textUsed + copied + 1);
+
+    // Buffer exhausted: point further strings at the final terminator
+    if (record.textUsed >= TEXT_CAPACITY) {
+        record.textUsed = static_cast<unsigned char>(TEXT_CAPACITY - 1);
+    }
+}
@@ -1,26 +1,57 @@
 #include "Obstacle.hpp"
-#include <iostream>
+#include "Logger.hpp"
 #include <random>
 
 // ===== Static Constants =====
 const double Obstacle::GROUND_Y = 400.0;
 
 // Define sizes for different obstacle types (based on sprite dimensions)
-const sf::Vector2f Obstacle::SMALL_CACTUS_SIZE = sf::Vector2f(15.0f, 35.0f);
-const sf::Vector2f Obstacle::MID_CACTUS_SIZE = sf::Vector2f(25.0f, 48.0f);
-const sf::Vector2f Obstacle::LARGE_CACTUS_SIZE = sf::Vector2f(32.0f, 68.0f);
-const sf::Vector2f Obstacle::CLUSTER_CACTUS_SIZE = sf::Vector2f(40.0f, 35.0f);  // Future use
+constexpr float Obstacle::SMALL_CACTUS_WIDTH;
+constexpr float Obstacle::MID_CACTUS_WIDTH;
+constexpr float Obstacle::LARGE_CACTUS_WIDTH;
+constexpr float Obstacle::CLUSTER_CACTUS_WIDTH;
+const sf::Vector2f Obstacle::SMALL_CACTUS_SIZE = sf::Vector2f(SMALL_CACTUS_WIDTH, 35.0f);
+const sf::Vector2f Obstacle::MID_CACTUS_SIZE = sf::Vector2f(MID_CACTUS_WIDTH, 48.0f);
+const sf::Vector2f Obstacle::LARGE_CACTUS_SIZE = sf::Vector2f(LARGE_CACTUS_WIDTH, 68.0f);
+const sf::Vector2f Obstacle::CLUSTER_CACTUS_SIZE = sf::Vector2f(CLUSTER_CACTUS_WIDTH, 35.0f);  // Future use
 
 // Define collision sizes for different obstacle types
-const sf::Vector2f Obstacle::SMALL_CACTUS_COLLISION_SIZE = sf::Vector2f(1.0f, 35.0f); 
-const sf::Vector2f Obstacle::MID_CACTUS_COLLISION_SIZE = sf::Vector2f(1.5f, 48.0f);
-const sf::Vector2f Obstacle::LARGE_CACTUS_COLLISION_SIZE = sf::Vector2f(2.5f, 68.0f);
-const sf::Vector2f Obstacle::CLUSTER_CACTUS_COLLISION_SIZE = sf::Vector2f(32.0f, 35.0f);  // Future use
+constexpr float Obstacle::SMALL_CACTUS_COLLISION_WIDTH;
+constexpr float Obstacle::MID_CACTUS_COLLISION_WIDTH;
+constexpr float Obstacle::LARGE_CACTUS_COLLISION_WIDTH;
+constexpr float Obstacle::CLUSTER_CACTUS_COLLISION_WIDTH;
+const sf::Vector2f Obstacle::SMALL_CACTUS_COLLISION_SIZE = sf::Vector2f(SMALL_CACTUS_COLLISION_WIDTH, 35.0f); 
+const sf::Vector2f Obstacle::MID_CACTUS_COLLISION_SIZE = sf::Vector2f(MID_CACTUS_COLLISION_WIDTH, 48.0f);
+const sf::Vector2f Obstacle::LARGE_CACTUS_COLLISION_SIZE = sf::Vector2f(LARGE_CACTUS_COLLISION_WIDTH, 68.0f);
+const sf::Vector2f Obstacle::CLUSTER_CACTUS_COLLISION_SIZE = sf::Vector2f(CLUSTER_CACTUS_COLLISION_WIDTH, 35.0f);  // Future use
+
+constexpr float Obstacle::COLLISION_OUTLINE_THICKNESS;
+
+// Per-type table: collision box is centered in the sprite (same as updateBoundingBox),
+// then grown by the outline on every side like sf::Shape::getGlobalBounds()
+static Obstacle::TypeInfo makeTypeInfo(const sf::Vector2f& spriteSize, const sf::Vector2f& collisionSize,
+                                       TextureManager::SpriteType spriteType) {
+    const float outline = Obstacle::COLLISION_OUTLINE_THICKNESS;
+    Obstacle::TypeInfo info;
+    info.spriteSize = spriteSize;
+    info.collisionSize = sf::Vector2f(collisionSize.x + 2.0f * outline, collisionSize.y + 2.0f * outline);
+    info.collisionOffset = sf::Vector2f((spriteSize.x - collisionSize.x) / 2.0f - outline,
+                                        (spriteSize.y - collisionSize.y) / 2.0f - outline);
+    info.spriteType = spriteType;
+    return info;
+}
+
+const Obstacle::TypeInfo Obstacle::TYPE_INFO_TABLE[Obstacle::TYPE_COUNT] = {
+    makeTypeInfo(SMALL_CACTUS_SIZE, SMALL_CACTUS_COLLISION_SIZE, TextureManager::SpriteType::CACTUS_SMALL),
+    makeTypeInfo(MID_CACTUS_SIZE, MID_CACTUS_COLLISION_SIZE, TextureManager::SpriteType::CACTUS_MID),
+    makeTypeInfo(LARGE_CACTUS_SIZE, LARGE_CACTUS_COLLISION_SIZE, TextureManager::SpriteType::CACTUS_LARGE),
+    makeTypeInfo(CLUSTER_CACTUS_SIZE, CLUSTER_CACTUS_COLLISION_SIZE, TextureManager::SpriteType::CACTUS_SMALL)
+};
 
 // ===== Constructors and Destructor =====
 
 Obstacle::Obstacle(double startX, double startY, double moveSpeed)
-    : posX(startX), posY(startY), velocityX(moveSpeed) {
+    : posX(startX), posY(startY), previousPosX(startX), velocityX(moveSpeed) {
     
     // Generate random obstacle type for variety
     obstacleType = generateRandomType();
@@ -28,18 +59,16 @@ Obstacle::Obstacle(double startX, double startY, double moveSpeed)
     // Initialize sprite system
     initializeSprite();
     
-    std::cout << "Obstacle created at (" << startX << ", " << startY 
-              << ") with type " << static_cast<int>(obstacleType) << std::endl;
+    DINO_LOG_DEBUG(OBSTACLE, "Obstacle created at ({}, {}) with type {}", startX, startY, obstacleType);
 }
 
 Obstacle::Obstacle(double startX, double startY, double moveSpeed, ObstacleType type)
-    : posX(startX), posY(startY), velocityX(moveSpeed), obstacleType(type) {
+    : posX(startX), posY(startY), previousPosX(startX), velocityX(moveSpeed), obstacleType(type) {
     
     // Initialize sprite system with specified type
     initializeSprite();
     
-    std::cout << "Obstacle created at (" << startX << ", " << startY 
-              << ") with specified type " << static_cast<int>(type) << std::endl;
+    DINO_LOG_DEBUG(OBSTACLE, "Obstacle created at ({}, {}) with specified type {}", startX, startY, type);
 }
 
 Obstacle::~Obstacle() {
@@ -49,6 +78,9 @@ Obstacle::~Obstacle() {
 // ===== Core Action Methods =====
 
 void Obstacle::update(double deltaTime) {
+    // Remember last state for render interpolation
+    previousPosX = posX;
+    
     // Move obstacle to the left
     posX -= velocityX * deltaTime;
     
@@ -59,7 +91,11 @@ void Obstacle::update(double deltaTime) {
     updateBoundingBox();
 }
 
-void Obstacle::render(sf::RenderWindow& window) {
+void Obstacle::render(sf::RenderWindow& window, double alpha) {
+    // Blend between the last two simulation steps for smooth motion
+    double renderX = previousPosX + (posX - previousPosX) * alpha;
+    currentSprite.setPosition(static_cast<float>(renderX), static_cast<float>(posY));
+    
     // Render the sprite
     window.draw(currentSprite);
     
@@ -67,6 +103,13 @@ void Obstacle::render(sf::RenderWindow& window) {
     // window.draw(boundingBox);
 }
 
+void Obstacle::appendToBatch(SpriteBatch& batch, double alpha) {
+    // Same interpolation as render(), but the quad goes into the shared batch
+    double renderX = previousPosX + (posX - previousPosX) * alpha;
+    currentSprite.setPosition(static_cast<float>(renderX), static_cast<float>(posY));
+    batch.add(currentSprite);
+}
+
 // ===== Information Methods =====
 
 const sf::RectangleShape& Obstacle::getShape() const {
@@ -112,7 +155,20 @@ void Obstacle::changeType(ObstacleType newType) {
         applySpriteForType();
         updateBoundingBox();
         
-        std::cout << "Obstacle type changed to " << static_cast<int>(newType) << std::endl;
+        DINO_LOG_DEBUG(OBSTACLE, "Obstacle type changed to {}", newType);
+    }
+}
+
+// ===== Type Table Access =====
+
+const Obstacle::TypeInfo& Obstacle::getTypeInfo(ObstacleType type) {
+    return TYPE_INFO_TABLE[static_cast<int>(type)];
+}
+
+void Obstacle::prepareCollisionMasks() {
+    TextureManager& textureManager = TextureManager::getInstance();
+    for (const TypeInfo& info : TYPE_INFO_TABLE) {
+        textureManager.prepareCollisionMask(info.spriteType, info.spriteSize);
     }
 }
 
@@ -126,7 +182,7 @@ void Obstacle::initializeSprite() {
     boundingBox.setSize(currentSize);
     boundingBox.setFillColor(sf::Color::Transparent);  // Invisible
     boundingBox.setOutlineColor(sf::Color::Red);      // Debug outline (can be removed)
-    boundingBox.setOutlineThickness(2.0f);             // Debug outline (can be removed)
+    boundingBox.setOutlineThickness(COLLISION_OUTLINE_THICKNESS);  // Debug outline (also widens getGlobalBounds)
     
     // Apply sprite for the current type
     applySpriteForType();
@@ -135,8 +191,7 @@ void Obstacle::initializeSprite() {
     currentSprite.setPosition(static_cast<float>(posX), static_cast<float>(posY));
     updateBoundingBox();
     
-    std::cout << "Obstacle sprite system initialized for type " 
-              << static_cast<int>(obstacleType) << std::endl;
+    DINO_LOG_TRACE(OBSTACLE, "Obstacle sprite system initialized for type {}", obstacleType);
 }
 
 void Obstacle::applySpriteForType() {
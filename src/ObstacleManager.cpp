@@ -1,49 +1,179 @@
 #include "ObstacleManager.hpp"
 #include <algorithm>  // for std::remove_if
+#include <cstring>    // snapshot copies
 #include <iostream>   // for debug output in getAverageObstacleDistance
+#include "Logger.hpp"
+#include "Player.hpp"   // jump physics for the pattern table checks
 
 // Static constant definitions - core game balance parameters
 const double ObstacleManager::INITIAL_SPAWN_INTERVAL = 2.0;     // Start with 2 seconds between obstacles
 const double ObstacleManager::MIN_SPAWN_INTERVAL = 0.8;        // Minimum 1 second at maximum difficulty
-const double ObstacleManager::INITIAL_OBSTACLE_SPEED = 200.0;  // Starting speed: 200 pixels/second
-const double ObstacleManager::MAX_OBSTACLE_SPEED = 400.0;      // Maximum speed: 400 pixels/second
+constexpr double ObstacleManager::INITIAL_OBSTACLE_SPEED;      // Starting speed: 200 pixels/second
+constexpr double ObstacleManager::MAX_OBSTACLE_SPEED;          // Maximum speed: 400 pixels/second
 const double ObstacleManager::SPAWN_POSITION_X = 800.0;        // Spawn at right edge of screen
 const double ObstacleManager::SPAWN_POSITION_Y = 424.5;        // Spawn at ground level
-const double ObstacleManager::SPEED_INCREASE_RATE = 5.0;       // Speed increases by 5 px/s every second
+const size_t ObstacleManager::POOL_CAPACITY = 64;              // ~10 obstacles are on screen at top speed
+const size_t ObstacleManager::Snapshot::CAPACITY;
+constexpr double ObstacleManager::SPEED_INCREASE_RATE;         // Speed increases by 5 px/s every second
 const double ObstacleManager::INTERVAL_DECREASE_RATE = 0.03;   // Interval decreases by 0.01s every second
 
 // ===== Pattern System Constants =====
 const double ObstacleManager::PATTERN_COOLDOWN_TIME = 4.0;
 const double ObstacleManager::DIFFICULTY_INCREASE_RATE = 0.04;
 const int ObstacleManager::MAX_CONSECUTIVE_HARD = 2;
+const int ObstacleManager::DIFFICULTY_BUCKETS = 20;             // Weights refreshed every 0.05 difficulty
+const int ObstacleManager::PATTERN_COUNT;
+const int ObstacleManager::MAX_PATTERN_OBSTACLES;
+constexpr double ObstacleManager::PATTERN_POSITION_JITTER;
+
+// ===== Built-in Pattern Table =====
+// Indexed by ObstaclePattern; validated by the static_asserts in initializePatterns()
+static constexpr ObstacleManager::PatternDefinition PATTERN_TABLE[ObstacleManager::PATTERN_COUNT] = {
+    // SINGLE_SMALL - Easiest pattern for beginners
+    {1, {Obstacle::ObstacleType::CACTUS_SMALL}, {0.0}, 0.1, 0.0, "Single Small Cactus"},
+    
+    // SINGLE_MID - Medium single obstacle
+    {1, {Obstacle::ObstacleType::CACTUS_MID}, {0.0}, 0.25, 3.0, "Single Medium Cactus"},
+    
+    // SINGLE_LARGE - Challenging single obstacle
+    {1, {Obstacle::ObstacleType::CACTUS_LARGE}, {0.0}, 0.4, 8.0, "Single Large Cactus"},
+    
+    // DOUBLE_CLOSE - Two obstacles requiring precise timing (close spacing requires skill)
+    {2, {Obstacle::ObstacleType::CACTUS_SMALL, Obstacle::ObstacleType::CACTUS_SMALL},
+        {0.0, 30.0}, 0.65, 15.0, "Double Close Cacti"},
+    
+    // TRIPLE_CLUSTER - Three obstacles for expert players
+    {3, {Obstacle::ObstacleType::CACTUS_SMALL, Obstacle::ObstacleType::CACTUS_MID, Obstacle::ObstacleType::CACTUS_SMALL},
+        {0.0, 30.0, 60.0}, 0.9, 20.0, "Triple Cluster"},
+    
+    // MIXED_HEIGHTS - Varied obstacle sizes
+    {2, {Obstacle::ObstacleType::CACTUS_LARGE, Obstacle::ObstacleType::CACTUS_SMALL},
+        {0.0, 40.0}, 0.5, 12.0, "Mixed Heights"},
+    
+    // WIDE_GAP - Easy breather pattern (wide gap for recovery)
+    {2, {Obstacle::ObstacleType::CACTUS_SMALL, Obstacle::ObstacleType::CACTUS_SMALL},
+        {0.0, 180.0}, 0.2, 0.0, "Wide Gap"},
+    
+    // TIGHT_SEQUENCE - Expert level challenge (very tight spacing)
+    {3, {Obstacle::ObstacleType::CACTUS_SMALL, Obstacle::ObstacleType::CACTUS_MID, Obstacle::ObstacleType::CACTUS_LARGE},
+        {0.0, 45.0, 85.0}, 1.0, 25.0, "Tight Sequence"}
+};
+
+// ===== Compile-Time Pattern Checks =====
+
+static constexpr bool hasValidShape(const ObstacleManager::PatternDefinition& def) {
+    if (def.obstacleCount < 1 || def.obstacleCount > ObstacleManager::MAX_PATTERN_OBSTACLES || !def.patternName) {
+        return false;
+    }
+    for (int i = 1; i < def.obstacleCount; ++i) {
+        if (def.relativePositions[i] < def.relativePositions[i - 1]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static constexpr bool hasValidDifficulty(const ObstacleManager::PatternDefinition& def) {
+    return def.patternDifficulty >= 0.0 && def.patternDifficulty <= 1.0 && def.minGameTime >= 0.0;
+}
+
+/**
+ * Slowest obstacle speed a pattern can appear at
+ * Air time is fixed, so the slowest speed leaves the least room under a jump
+ */
+static constexpr double getUnlockSpeed(const ObstacleManager::PatternDefinition& def, double initialSpeed,
+                                       double speedIncreaseRate, double maxSpeed) {
+    return std::min(maxSpeed, initialSpeed + speedIncreaseRate * def.minGameTime);
+}
+
+static constexpr double getHitboxLeft(const ObstacleManager::PatternDefinition& def, int index) {
+    return def.relativePositions[index] + Obstacle::getHitboxOffsetX(def.obstacleTypes[index]);
+}
+
+static constexpr double getHitboxRight(const ObstacleManager::PatternDefinition& def, int index) {
+    return getHitboxLeft(def, index) + Obstacle::getHitboxWidth(def.obstacleTypes[index]);
+}
+
+/**
+ * Obstacles first..count-1 can be cleared by consecutive full jumps, jitter included
+ * Each jump clears a run of hit boxes no wider than the jump clearance; between two
+ * jumps the gap must hold the player on the ground, so it can land and jump again
+ */
+static constexpr bool clearableFrom(const ObstacleManager::PatternDefinition& def, int first,
+                                    double clearance, double jitter) {
+    for (int last = first; last < def.obstacleCount; ++last) {
+        if (getHitboxRight(def, last) - getHitboxLeft(def, first) + 2.0 * jitter > clearance) {
+            return false;  // Wider runs starting at first cannot fit either
+        }
+        if (last == def.obstacleCount - 1) {
+            return true;
+        }
+        double gap = getHitboxLeft(def, last + 1) - getHitboxRight(def, last) - 2.0 * jitter;
+        if (gap >= Player::getLandingRoom() && clearableFrom(def, last + 1, clearance, jitter)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Pattern can be cleared without fast falling at the speed it unlocks at
+ */
+static constexpr bool isClearable(const ObstacleManager::PatternDefinition& def, double initialSpeed,
+                                  double speedIncreaseRate, double maxSpeed, double jitter) {
+    double clearance = Player::getJumpClearance(getUnlockSpeed(def, initialSpeed, speedIncreaseRate, maxSpeed));
+    return clearableFrom(def, 0, clearance, jitter);
+}
+
+static constexpr bool everyPattern(bool (*check)(const ObstacleManager::PatternDefinition&)) {
+    for (int p = 0; p < ObstacleManager::PATTERN_COUNT; ++p) {
+        if (!check(PATTERN_TABLE[p])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static constexpr bool everyPatternClearable(double initialSpeed, double speedIncreaseRate, double maxSpeed,
+                                            double jitter) {
+    for (int p = 0; p < ObstacleManager::PATTERN_COUNT; ++p) {
+        if (!isClearable(PATTERN_TABLE[p], initialSpeed, speedIncreaseRate, maxSpeed, jitter)) {
+            return false;
+        }
+    }
+    return true;
+}
 
 // Constructor: Initialize ObstacleManager with default values
 ObstacleManager::ObstacleManager() 
-    : spawnTimer(0.0), 
+    : debugMode(false),
+      spawnTimer(0.0), 
       obstacleInterval(INITIAL_SPAWN_INTERVAL),
       obstacleSpeed(INITIAL_OBSTACLE_SPEED),
+      difficultyParams(getDefaultDifficultyParams()),
       lastPattern(ObstaclePattern::SINGLE_SMALL),
       consecutiveHardPatterns(0),
       randomGenerator(std::random_device{}()),
       uniformDist(0.0, 1.0),
+      selectionTableDirty(true),
+      tableDifficultyBucket(-1),
+      tableHardLimited(false),
+      tableCoolingDown(false),
+      frameArena(nullptr),
       currentDifficulty(0.0),
       patternCooldownTimer(0.0) {
+        std::fill(patternSpawnCounts, patternSpawnCounts + PATTERN_COUNT, 0);
         initializePatterns();
-    
-        // Check if patterns were initialized correctly
-        if (patternDefinitions.empty()) {
-            std::cerr << "ERROR: Pattern definitions not initialized!" << std::endl;
-        } else {
-            std::cout << "Enhanced ObstacleManager initialized with " 
-                      << patternDefinitions.size() << " patterns" << std::endl;
-        }
+        reservePool(POOL_CAPACITY);  // The only allocation of obstacle storage in normal play
+        aliasProbability.reserve(PATTERN_COUNT);  // Unlocking patterns grows the table in place
+        aliasIndex.reserve(PATTERN_COUNT);
+        DINO_LOG_INFO(OBSTACLE, "Enhanced ObstacleManager initialized with {} patterns", PATTERN_COUNT);
 }
 
 // Destructor: Clean up resources (automatic cleanup for std::vector)
 ObstacleManager::~ObstacleManager() {
-    // std::vector<Obstacle> automatically handles cleanup
-    // Each Obstacle object will also have its destructor called automatically
-    std::cout << "Enhanced ObstacleManager destroyed" << std::endl;
+    // Obstacle arrays clean themselves up automatically
+    DINO_LOG_INFO(OBSTACLE, "Enhanced ObstacleManager destroyed");
 }
 
 // Main update method: Called every frame to manage all obstacle-related logic
@@ -61,7 +191,7 @@ void ObstacleManager::update(double deltaTime, double gameTime) {
     if (spawnTimer >= obstacleInterval) {
         ObstaclePattern selectedPattern = selectPattern(gameTime);
         spawnPattern(selectedPattern); // Spawn obstacles based on selected pattern
-        std::cout << "Spawned pattern: " << static_cast<int>(selectedPattern) << std::endl;
+        DINO_LOG_DEBUG(OBSTACLE, "Spawned pattern: {}", selectedPattern);
 
         spawnTimer = generateRandomOffset(-0.1, 0.1);
     }
@@ -71,16 +201,34 @@ void ObstacleManager::update(double deltaTime, double gameTime) {
 }
 
 // Render method: Draw all obstacles to the screen
-void ObstacleManager::render(sf::RenderWindow& window) {
-    // Iterate through all obstacles and call their individual render methods
-    for (auto& obstacle : obstacles) {
-        obstacle.render(window);
+void ObstacleManager::render(sf::RenderWindow& window, double alpha) {
+    // Quads are produced only here, from position + type table
+    TextureManager& textureManager = TextureManager::getInstance();
+    
+    // Gather every obstacle quad into one vertex array and submit a single draw call
+    obstacleBatch.clear();
+    for (size_t i = 0; i < obstacles.size(); ++i) {
+        size_t s = obstacles.slot(i);
+        const Obstacle::TypeInfo& info = Obstacle::getTypeInfo(obstacles.type[s]);
+        float renderX = obstacles.previousPosX[s] + (obstacles.posX[s] - obstacles.previousPosX[s]) * static_cast<float>(alpha);
+        
+        const TextureManager::SpriteHandle& sprite = textureManager.getSpriteHandle(info.spriteType);
+        obstacleBatch.add(sprite.texture,
+                          sprite.rect,
+                          sf::Vector2f(renderX, obstacles.posY[s]),
+                          info.spriteSize);
+    }
+    obstacleBatch.draw(window);
+    
+    if (debugMode) {
+        renderDebugBoxes(window);
     }
 }
 
 // Clear method: Reset manager to initial state (used when restarting game)
 void ObstacleManager::clear() {
-    obstacles.clear();                          // Remove all obstacles from vector
+    obstacles.head = 0;                        // Remove all obstacles (pool slots stay allocated)
+    obstacles.count = 0;
     spawnTimer = 0.0;                          // Reset spawn timer
     obstacleInterval = INITIAL_SPAWN_INTERVAL; // Reset spawn interval to initial value
     obstacleSpeed = INITIAL_OBSTACLE_SPEED;    // Reset speed to initial value
@@ -88,27 +236,28 @@ void ObstacleManager::clear() {
     consecutiveHardPatterns = 0;
     patternCooldownTimer = 0.0;
     lastPattern = ObstaclePattern::SINGLE_SMALL;
-    availablePatterns.clear();
+    availablePatterns.clear();                 // Patterns unlock again from the start
+    selectionTableDirty = true;
 }
 
 // Difficulty update method: Progressively increase challenge based on game time
 void ObstacleManager::updateDifficulty(double gameTime) {
     // Calculate new obstacle speed: base speed + (time * increase rate)
     // Example: 0s=200, 20s=300, 40s=400 (capped at maximum)
-    obstacleSpeed = INITIAL_OBSTACLE_SPEED + (gameTime * SPEED_INCREASE_RATE);
+    obstacleSpeed = INITIAL_OBSTACLE_SPEED + (gameTime * difficultyParams.speedIncreaseRate);
     if (obstacleSpeed > MAX_OBSTACLE_SPEED) {
         obstacleSpeed = MAX_OBSTACLE_SPEED;  // Cap at maximum speed
     }
     
     // Calculate new spawn interval: base interval - (time * decrease rate)
     // Example: 0s=2.0s, 50s=1.5s, 100s=1.0s (capped at minimum)
-    obstacleInterval = INITIAL_SPAWN_INTERVAL - (gameTime * INTERVAL_DECREASE_RATE);
+    obstacleInterval = INITIAL_SPAWN_INTERVAL - (gameTime * difficultyParams.intervalDecreaseRate);
     if (obstacleInterval < MIN_SPAWN_INTERVAL) {
         obstacleInterval = MIN_SPAWN_INTERVAL;  // Cap at minimum interval
     }
 
     // Update pattern difficulty based on game time
-    currentDifficulty = std::min(1.0, gameTime * DIFFICULTY_INCREASE_RATE);
+    currentDifficulty = std::min(1.0, gameTime * difficultyParams.difficultyIncreaseRate);
 }
 
 double ObstacleManager::getCurrentDifficulty() const {
@@ -118,25 +267,19 @@ double ObstacleManager::getCurrentDifficulty() const {
 // ===== Pattern Management =====
 
 ObstacleManager::ObstaclePattern ObstacleManager::selectPattern(double gameTime) {
-    // for debugging purposes, print available patterns and current difficulty
-    std::cout << "Current game time: " << gameTime << "s" << std::endl;
-    std::cout << "Selecting pattern - Available: " << availablePatterns.size() 
-              << ", Difficulty: " << currentDifficulty << std::endl;
+    // for debugging purposes, log available patterns and current difficulty
+    DINO_LOG_TRACE(OBSTACLE, "Selecting pattern at {}s - Available: {}, Difficulty: {}",
+                   gameTime, availablePatterns.size(), currentDifficulty);
     
     if (availablePatterns.empty()) {
-        std::cout << "No available patterns, using SINGLE_SMALL" << std::endl;
+        DINO_LOG_WARN(OBSTACLE, "No available patterns, using SINGLE_SMALL");
         return ObstaclePattern::SINGLE_SMALL;
     }
 
     // Use weighted selection based on current difficulty
+    refreshSelectionTable();
     ObstaclePattern selectedPattern = weightedPatternSelection(gameTime);
 
-    // Ensure the selected pattern exists in the definitions
-    if (patternDefinitions.find(selectedPattern) == patternDefinitions.end()) {
-        std::cout << "Selected pattern not found in definitions! Using SINGLE_SMALL" << std::endl;
-        selectedPattern = ObstaclePattern::SINGLE_SMALL;
-    }
-    
     // Check if we should avoid this pattern due to consecutive hard patterns or cooldown
     if (shouldAvoidPattern(selectedPattern)) {
         // Fall back to easier patterns
@@ -151,7 +294,7 @@ ObstacleManager::ObstaclePattern ObstacleManager::selectPattern(double gameTime)
     }
     
     // Update consecutive hard pattern counter
-    if (patternDefinitions[selectedPattern].patternDifficulty > 0.6) {
+    if (patternDefinitions[static_cast<int>(selectedPattern)].patternDifficulty > 0.6) {
         consecutiveHardPatterns++;
     } else {
         consecutiveHardPatterns = 0;
@@ -162,27 +305,18 @@ ObstacleManager::ObstaclePattern ObstacleManager::selectPattern(double gameTime)
 }
 
 void ObstacleManager::spawnPattern(ObstaclePattern pattern) {
-    auto it = patternDefinitions.find(pattern);
-    if (it == patternDefinitions.end()) {
-        std::cout << "Warning: Pattern not found, spawning default single small" << std::endl;
-        spawnSingleObstacle(Obstacle::ObstacleType::CACTUS_SMALL, 0.0);
-        return;
-    }
+    const PatternDefinition& def = patternDefinitions[static_cast<int>(pattern)];
     
-    const PatternDefinition& def = it->second;
-    
-    std::cout << "Spawning pattern: " << def.patternName 
-              << " (Difficulty: " << def.patternDifficulty << ")" << std::endl;
+    DINO_LOG_DEBUG(OBSTACLE, "Spawning pattern: {} (Difficulty: {})", def.patternName, def.patternDifficulty);
     
     // Spawn each obstacle in the pattern
-    for (size_t i = 0; i < def.obstacleTypes.size(); ++i) {
-        double xOffset = (i < def.relativePositions.size()) ? def.relativePositions[i] : 0.0;
-        
+    for (int i = 0; i < def.obstacleCount; ++i) {
         // Add slight randomization to prevent complete predictability
-        xOffset += generateRandomOffset(-15.0, 15.0);
+        double xOffset = def.relativePositions[i] + generateRandomOffset(-PATTERN_POSITION_JITTER, PATTERN_POSITION_JITTER);
         
-        spawnSingleObstacle(def.obstacleTypes[i], xOffset);
+        spawnSingleObstacle(def.obstacleTypes[i], xOffset, pattern);
     }
+    patternSpawnCounts[static_cast<int>(pattern)]++;
     
     // Reset pattern cooldown for complex patterns
     if (def.patternDifficulty > 0.6) {
@@ -191,153 +325,162 @@ void ObstacleManager::spawnPattern(ObstaclePattern pattern) {
 }
 
 std::string ObstacleManager::getCurrentPatternName() const {
-    auto it = patternDefinitions.find(lastPattern);
-    return (it != patternDefinitions.end()) ? it->second.patternName : "Unknown";
+    return patternDefinitions[static_cast<int>(lastPattern)].patternName;
 }
 
 // ===== Pattern System Implementation =====
 
 void ObstacleManager::initializePatterns() {
-    // Clear existing patterns
-    patternDefinitions.clear();
-    
-    // SINGLE_SMALL - Easiest pattern for beginners
-    PatternDefinition singleSmall;
-    singleSmall.obstacleTypes = {Obstacle::ObstacleType::CACTUS_SMALL};
-    singleSmall.relativePositions = {0.0};
-    singleSmall.patternDifficulty = 0.1;
-    singleSmall.minGameTime = 0.0;
-    singleSmall.patternName = "Single Small Cactus";
-    patternDefinitions[ObstaclePattern::SINGLE_SMALL] = singleSmall;
-    
-    // SINGLE_MID - Medium single obstacle
-    PatternDefinition singleMid;
-    singleMid.obstacleTypes = {Obstacle::ObstacleType::CACTUS_MID};
-    singleMid.relativePositions = {0.0};
-    singleMid.patternDifficulty = 0.25;
-    singleMid.minGameTime = 3.0;
-    singleMid.patternName = "Single Medium Cactus";
-    patternDefinitions[ObstaclePattern::SINGLE_MID] = singleMid;
-    
-    // SINGLE_LARGE - Challenging single obstacle
-    PatternDefinition singleLarge;
-    singleLarge.obstacleTypes = {Obstacle::ObstacleType::CACTUS_LARGE};
-    singleLarge.relativePositions = {0.0};
-    singleLarge.patternDifficulty = 0.4;
-    singleLarge.minGameTime = 8.0;
-    singleLarge.patternName = "Single Large Cactus";
-    patternDefinitions[ObstaclePattern::SINGLE_LARGE] = singleLarge;
-    
-    // DOUBLE_CLOSE - Two obstacles requiring precise timing
-    PatternDefinition doubleClose;
-    doubleClose.obstacleTypes = {Obstacle::ObstacleType::CACTUS_SMALL, Obstacle::ObstacleType::CACTUS_SMALL};
-    doubleClose.relativePositions = {0.0, 30.0};  // Close spacing requires skill
-    doubleClose.patternDifficulty = 0.65;
-    doubleClose.minGameTime = 15.0;
-    doubleClose.patternName = "Double Close Cacti";
-    patternDefinitions[ObstaclePattern::DOUBLE_CLOSE] = doubleClose;
-    
-    // TRIPLE_CLUSTER - Three obstacles for expert players
-    PatternDefinition tripleCluster;
-    tripleCluster.obstacleTypes = {
-        Obstacle::ObstacleType::CACTUS_SMALL, 
-        Obstacle::ObstacleType::CACTUS_MID, 
-        Obstacle::ObstacleType::CACTUS_SMALL
-    };
-    tripleCluster.relativePositions = {0.0, 30.0, 60.0};
-    tripleCluster.patternDifficulty = 0.9;
-    tripleCluster.minGameTime = 20.0;
-    tripleCluster.patternName = "Triple Cluster";
-    patternDefinitions[ObstaclePattern::TRIPLE_CLUSTER] = tripleCluster;
-    
-    // MIXED_HEIGHTS - Varied obstacle sizes
-    PatternDefinition mixedHeights;
-    mixedHeights.obstacleTypes = {Obstacle::ObstacleType::CACTUS_LARGE, Obstacle::ObstacleType::CACTUS_SMALL};
-    mixedHeights.relativePositions = {0.0, 40.0};
-    mixedHeights.patternDifficulty = 0.5;
-    mixedHeights.minGameTime = 12.0;
-    mixedHeights.patternName = "Mixed Heights";
-    patternDefinitions[ObstaclePattern::MIXED_HEIGHTS] = mixedHeights;
-    
-    // WIDE_GAP - Easy breather pattern
-    PatternDefinition wideGap;
-    wideGap.obstacleTypes = {Obstacle::ObstacleType::CACTUS_SMALL, Obstacle::ObstacleType::CACTUS_SMALL};
-    wideGap.relativePositions = {0.0, 180.0};  // Wide gap for recovery
-    wideGap.patternDifficulty = 0.2;
-    wideGap.minGameTime = 0.0;
-    wideGap.patternName = "Wide Gap";
-    patternDefinitions[ObstaclePattern::WIDE_GAP] = wideGap;
-    
-    // TIGHT_SEQUENCE - Expert level challenge
-    PatternDefinition tightSequence;
-    tightSequence.obstacleTypes = {
-        Obstacle::ObstacleType::CACTUS_SMALL,
-        Obstacle::ObstacleType::CACTUS_MID,
-        Obstacle::ObstacleType::CACTUS_LARGE
-    };
-    tightSequence.relativePositions = {0.0, 45.0, 85.0};  // Very tight spacing
-    tightSequence.patternDifficulty = 1.0;
-    tightSequence.minGameTime = 25.0;
-    tightSequence.patternName = "Tight Sequence";
-    patternDefinitions[ObstaclePattern::TIGHT_SEQUENCE] = tightSequence;
-    
-    std::cout << "Initialized " << patternDefinitions.size() << " obstacle patterns" << std::endl;
+    // The table is checked here, at compile time; a broken pattern does not build
+    static_assert(everyPattern(hasValidShape),
+                  "Pattern obstacle count out of range, name missing or offsets not non-decreasing");
+    static_assert(everyPattern(hasValidDifficulty),
+                  "Pattern difficulty must be in 0.0 - 1.0 and unlock time non-negative");
+    static_assert(everyPatternClearable(INITIAL_OBSTACLE_SPEED, SPEED_INCREASE_RATE, MAX_OBSTACLE_SPEED,
+                                        PATTERN_POSITION_JITTER),
+                  "A pattern cannot be cleared by full jumps at the speed it unlocks at");
+    
+    std::copy(PATTERN_TABLE, PATTERN_TABLE + PATTERN_COUNT, patternDefinitions);
+    rebuildUnlockOrder();
+    
+    DINO_LOG_INFO(OBSTACLE, "Initialized {} obstacle patterns", PATTERN_COUNT);
 }
 
-void ObstacleManager::updateAvailablePatterns(double gameTime) {
+void ObstacleManager::rebuildUnlockOrder() {
+    // Unlock order: by minGameTime, ties broken by enum order
+    unlockOrder.clear();
+    for (int p = 0; p < PATTERN_COUNT; ++p) {
+        unlockOrder.push_back(static_cast<ObstaclePattern>(p));
+    }
+    std::sort(unlockOrder.begin(), unlockOrder.end(), [this](ObstaclePattern a, ObstaclePattern b) {
+        double timeA = patternDefinitions[static_cast<int>(a)].minGameTime;
+        double timeB = patternDefinitions[static_cast<int>(b)].minGameTime;
+        if (timeA != timeB) {
+            return timeA < timeB;
+        }
+        return static_cast<int>(a) < static_cast<int>(b);
+    });
     availablePatterns.clear();
-    
-    // Add patterns that are unlocked at current game time
-    for (const auto& pair : patternDefinitions) {
-        if (gameTime >= pair.second.minGameTime) {
-            availablePatterns.push_back(pair.first);
+    availablePatterns.reserve(unlockOrder.size());
+    selectionTableDirty = true;
+}
+
+void ObstacleManager::updateAvailablePatterns(double gameTime) {
+    // availablePatterns is always a prefix of unlockOrder, so only the next
+    // threshold has to be checked (gameTime only moves forward until clear())
+    while (availablePatterns.size() < unlockOrder.size()) {
+        ObstaclePattern next = unlockOrder[availablePatterns.size()];
+        if (gameTime < patternDefinitions[static_cast<int>(next)].minGameTime) {
+            break;
         }
+        availablePatterns.push_back(next);
+        selectionTableDirty = true;
     }
-    
-    // Ensure at least basic patterns are always available
-    if (availablePatterns.empty()) {
-        availablePatterns.push_back(ObstaclePattern::SINGLE_SMALL);
+    // An empty list (gameTime < 0) falls back to SINGLE_SMALL in selectPattern
+}
+
+void ObstacleManager::refreshSelectionTable() {
+    int difficultyBucket = static_cast<int>(currentDifficulty * DIFFICULTY_BUCKETS);
+    bool hardLimited = consecutiveHardPatterns >= MAX_CONSECUTIVE_HARD;
+    bool coolingDown = patternCooldownTimer < PATTERN_COOLDOWN_TIME;
+
+    if (!selectionTableDirty &&
+        difficultyBucket == tableDifficultyBucket &&
+        hardLimited == tableHardLimited &&
+        coolingDown == tableCoolingDown) {
+        return;
+    }
+
+    // Weights are evaluated at the bucket's difficulty so one table serves the whole bucket
+    double bucketDifficulty = static_cast<double>(difficultyBucket) / DIFFICULTY_BUCKETS;
+    ArenaVector<double> weights{ArenaAllocator<double>(frameArena)};
+    weights.reserve(availablePatterns.size());
+    for (ObstaclePattern pattern : availablePatterns) {
+        weights.push_back(getPatternWeight(pattern, bucketDifficulty));
     }
+    buildAliasTable(weights);
+
+    selectionTableDirty = false;
+    tableDifficultyBucket = difficultyBucket;
+    tableHardLimited = hardLimited;
+    tableCoolingDown = coolingDown;
 }
 
-ObstacleManager::ObstaclePattern ObstacleManager::weightedPatternSelection(double gameTime) const {
-    if (availablePatterns.empty()) {
-        return ObstaclePattern::SINGLE_SMALL;
+void ObstacleManager::buildAliasTable(const ArenaVector<double>& weights) {
+    size_t count = weights.size();
+    aliasProbability.assign(count, 1.0);
+    aliasIndex.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        aliasIndex[i] = i;
     }
-    
-    // Calculate weights for all available patterns
-    std::vector<double> weights;
+
     double totalWeight = 0.0;
-    
-    for (ObstaclePattern pattern : availablePatterns) {
-        double weight = getPatternWeight(pattern, currentDifficulty);
-        weights.push_back(weight);
+    for (double weight : weights) {
         totalWeight += weight;
     }
-    
-    // Select pattern using weighted random selection
-    double randomValue = uniformDist(randomGenerator) * totalWeight;
-    double accumulatedWeight = 0.0;
-    
-    for (size_t i = 0; i < availablePatterns.size(); ++i) {
-        accumulatedWeight += weights[i];
-        if (randomValue <= accumulatedWeight) {
-            return availablePatterns[i];
+    if (count == 0 || totalWeight <= 0.0) {
+        return;  // Uniform table
+    }
+
+    // Scale weights so the average column holds exactly 1.0
+    ArenaAllocator<size_t> scratch(frameArena);
+    ArenaVector<double> scaled(count, 0.0, scratch);
+    ArenaVector<size_t> small(scratch);
+    ArenaVector<size_t> large(scratch);
+    small.reserve(count);
+    large.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        scaled[i] = weights[i] * count / totalWeight;
+        if (scaled[i] < 1.0) {
+            small.push_back(i);
+        } else {
+            large.push_back(i);
         }
     }
-    
-    // Fallback to last available pattern
-    return availablePatterns.back();
+
+    // Fill each under-full column with the remainder of an over-full one
+    while (!small.empty() && !large.empty()) {
+        size_t lessIndex = small.back();
+        small.pop_back();
+        size_t moreIndex = large.back();
+        large.pop_back();
+
+        aliasProbability[lessIndex] = scaled[lessIndex];
+        aliasIndex[lessIndex] = moreIndex;
+
+        scaled[moreIndex] = (scaled[moreIndex] + scaled[lessIndex]) - 1.0;
+        if (scaled[moreIndex] < 1.0) {
+            small.push_back(moreIndex);
+        } else {
+            large.push_back(moreIndex);
+        }
+    }
+
+    // Leftovers are 1.0 up to rounding error
+    for (size_t i : small) {
+        aliasProbability[i] = 1.0;
+    }
+    for (size_t i : large) {
+        aliasProbability[i] = 1.0;
+    }
 }
 
-bool ObstacleManager::shouldAvoidPattern(ObstaclePattern pattern) const {
-    // safety check: ensure pattern exists in definitions
-    auto it = patternDefinitions.find(pattern);
-    if (it == patternDefinitions.end()) {
-        return false;  // never avoid unknown patterns
+ObstacleManager::ObstaclePattern ObstacleManager::weightedPatternSelection(double gameTime) const {
+    if (availablePatterns.empty() || aliasProbability.size() != availablePatterns.size()) {
+        return ObstaclePattern::SINGLE_SMALL;
     }
+    
+    // One draw picks the column (integer part) and the coin flip inside it (fraction)
+    double scaled = uniformDist(randomGenerator) * availablePatterns.size();
+    size_t column = std::min(static_cast<size_t>(scaled), availablePatterns.size() - 1);
+    double coin = scaled - static_cast<double>(column);
+    
+    size_t index = (coin < aliasProbability[column]) ? column : aliasIndex[column];
+    return availablePatterns[index];
+}
 
-    const PatternDefinition& def = it->second;
+bool ObstacleManager::shouldAvoidPattern(ObstaclePattern pattern) const {
+    const PatternDefinition& def = patternDefinitions[static_cast<int>(pattern)];
     
     // Avoid hard patterns if we've had too many consecutive hard patterns
     if (def.patternDifficulty > 0.6 && consecutiveHardPatterns >= MAX_CONSECUTIVE_HARD) {
@@ -353,13 +496,7 @@ bool ObstacleManager::shouldAvoidPattern(ObstaclePattern pattern) const {
 }
 
 double ObstacleManager::getPatternWeight(ObstaclePattern pattern, double currentDifficulty) const {
-    // 안전한 접근 방식
-    auto it = patternDefinitions.find(pattern);
-    if (it == patternDefinitions.end()) {
-        return 0.1;  // 기본 최소 가중치
-    }
-    
-    const PatternDefinition& def = it->second;
+    const PatternDefinition& def = patternDefinitions[static_cast<int>(pattern)];
     
     double weight = 1.0;
     double difficultyMatch = 1.0 - std::abs(def.patternDifficulty - currentDifficulty);
@@ -374,15 +511,194 @@ double ObstacleManager::getPatternWeight(ObstaclePattern pattern, double current
 
 // ===== Helper Methods =====
 
-void ObstacleManager::spawnSingleObstacle(Obstacle::ObstacleType type, double xOffset) {
+void ObstacleManager::spawnSingleObstacle(Obstacle::ObstacleType type, double xOffset, ObstaclePattern pattern) {
     // Create obstacle with specified type and position offset
-    double offsetY = 0.0;
+    float spawnX = static_cast<float>(SPAWN_POSITION_X + xOffset);
+    float spawnY = static_cast<float>(SPAWN_POSITION_Y) + getGroundOffsetY(type);
+    insertObstacle(type, spawnX, spawnY, pattern);
+}
+
+void ObstacleManager::insertObstacle(Obstacle::ObstacleType type, float x, float y, ObstaclePattern pattern) {
+    if (obstacles.count == obstacles.capacity()) {
+        reservePool(obstacles.capacity() * 2);  // Overflow (only with scripted spawns); counted in poolStats
+    }
+    
+    // Keep the pool sorted by x: shift later obstacles one slot toward the tail
+    // until x fits (pattern jitter can very rarely reorder neighbours, so this is almost always zero steps)
+    size_t index = obstacles.count;
+    while (index > 0 && obstacles.posX[obstacles.slot(index - 1)] > x) {
+        size_t from = obstacles.slot(index - 1);
+        size_t to = obstacles.slot(index);
+        obstacles.posX[to] = obstacles.posX[from];
+        obstacles.previousPosX[to] = obstacles.previousPosX[from];
+        obstacles.posY[to] = obstacles.posY[from];
+        obstacles.type[to] = obstacles.type[from];
+        obstacles.pattern[to] = obstacles.pattern[from];
+        --index;
+    }
+    
+    // Recycle the slot by overwriting type and position
+    size_t s = obstacles.slot(index);
+    obstacles.posX[s] = x;
+    obstacles.previousPosX[s] = x;
+    obstacles.posY[s] = y;
+    obstacles.type[s] = type;
+    obstacles.pattern[s] = pattern;
+    obstacles.count++;
+    
+    poolStats.spawned++;
+    poolStats.peakCount = std::max(poolStats.peakCount, obstacles.count);
+}
+
+void ObstacleManager::reservePool(size_t capacity) {
+    // Copy live obstacles out in logical order so the new ring starts at slot 0
+    ObstacleArrays resized;
+    resized.posX.resize(capacity);
+    resized.previousPosX.resize(capacity);
+    resized.posY.resize(capacity);
+    resized.type.resize(capacity, Obstacle::ObstacleType::CACTUS_SMALL);
+    resized.pattern.resize(capacity, ObstaclePattern::SINGLE_SMALL);
+    resized.mask = capacity - 1;
+    resized.count = obstacles.count;
+    
+    for (size_t i = 0; i < obstacles.count; ++i) {
+        size_t s = obstacles.slot(i);
+        resized.posX[i] = obstacles.posX[s];
+        resized.previousPosX[i] = obstacles.previousPosX[s];
+        resized.posY[i] = obstacles.posY[s];
+        resized.type[i] = obstacles.type[s];
+        resized.pattern[i] = obstacles.pattern[s];
+    }
+    
+    obstacles = std::move(resized);
+    poolStats.capacity = capacity;
+    poolStats.reallocations++;
+    
+    if (poolStats.reallocations > 1) {
+        DINO_LOG_WARN(OBSTACLE, "Obstacle pool grew to {} slots", capacity);
+    }
+}
+
+float ObstacleManager::getGroundOffsetY(Obstacle::ObstacleType type) {
     if (type == Obstacle::ObstacleType::CACTUS_MID) {
-        offsetY -= 13.0;
+        return -13.0f;
     } else if (type == Obstacle::ObstacleType::CACTUS_LARGE) {
-        offsetY -= 33.0; // Adjust for larger cactus height
+        return -33.0f; // Adjust for larger cactus height
+    }
+    return 0.0f;
+}
+
+void ObstacleManager::spawnObstacleAt(Obstacle::ObstacleType type, float x) {
+    // Scripted obstacles are attributed to the simplest pattern
+    insertObstacle(type, x, static_cast<float>(SPAWN_POSITION_Y) + getGroundOffsetY(type), ObstaclePattern::SINGLE_SMALL);
+}
+
+ObstacleManager::DifficultyParams ObstacleManager::getDefaultDifficultyParams() {
+    DifficultyParams params;
+    params.speedIncreaseRate = SPEED_INCREASE_RATE;
+    params.intervalDecreaseRate = INTERVAL_DECREASE_RATE;
+    params.difficultyIncreaseRate = DIFFICULTY_INCREASE_RATE;
+    return params;
+}
+
+void ObstacleManager::setDifficultyParams(const DifficultyParams& params) {
+    difficultyParams = params;
+}
+
+const ObstacleManager::DifficultyParams& ObstacleManager::getDifficultyParams() const {
+    return difficultyParams;
+}
+
+const ObstacleManager::PatternDefinition& ObstacleManager::getPatternDefinition(ObstaclePattern pattern) const {
+    return patternDefinitions[static_cast<int>(pattern)];
+}
+
+void ObstacleManager::setPatternDefinition(ObstaclePattern pattern, const PatternDefinition& definition) {
+    patternDefinitions[static_cast<int>(pattern)] = definition;
+    rebuildUnlockOrder();  // minGameTime may have moved the pattern
+}
+
+size_t ObstacleManager::getPatternSpawnCount(ObstaclePattern pattern) const {
+    return patternSpawnCounts[static_cast<int>(pattern)];
+}
+
+void ObstacleManager::setSeed(unsigned int seed) {
+    randomGenerator.seed(seed);
+    uniformDist.reset();  // Drop any cached state so the sequence restarts exactly
+}
+
+void ObstacleManager::setFrameArena(FrameArena* arena) {
+    frameArena = arena;
+}
+
+void ObstacleManager::saveSnapshot(Snapshot& snapshot) const {
+    size_t count = obstacles.count;
+    if (count > Snapshot::CAPACITY) {
+        DINO_LOG_WARN(OBSTACLE, "Snapshot keeps {} of {} obstacles", Snapshot::CAPACITY, count);
+        count = Snapshot::CAPACITY;
+    }
+    
+    // Live slots form at most two contiguous runs (head..end and 0..wrap): two copies per array
+    size_t firstRun = std::min(count, obstacles.capacity() - obstacles.head);
+    size_t wrapped = count - firstRun;
+    std::memcpy(snapshot.posX, &obstacles.posX[obstacles.head], firstRun * sizeof(float));
+    std::memcpy(snapshot.previousPosX, &obstacles.previousPosX[obstacles.head], firstRun * sizeof(float));
+    std::memcpy(snapshot.posY, &obstacles.posY[obstacles.head], firstRun * sizeof(float));
+    std::memcpy(snapshot.type, &obstacles.type[obstacles.head], firstRun * sizeof(Obstacle::ObstacleType));
+    std::memcpy(snapshot.pattern, &obstacles.pattern[obstacles.head], firstRun * sizeof(ObstaclePattern));
+    if (wrapped > 0) {
+        std::memcpy(snapshot.posX + firstRun, &obstacles.posX[0], wrapped * sizeof(float));
+        std::memcpy(snapshot.previousPosX + firstRun, &obstacles.previousPosX[0], wrapped * sizeof(float));
+        std::memcpy(snapshot.posY + firstRun, &obstacles.posY[0], wrapped * sizeof(float));
+        std::memcpy(snapshot.type + firstRun, &obstacles.type[0], wrapped * sizeof(Obstacle::ObstacleType));
+        std::memcpy(snapshot.pattern + firstRun, &obstacles.pattern[0], wrapped * sizeof(ObstaclePattern));
+    }
+    
+    snapshot.count = static_cast<uint32_t>(count);
+    snapshot.unlockedCount = static_cast<uint32_t>(availablePatterns.size());
+    snapshot.spawnTimer = spawnTimer;
+    snapshot.obstacleInterval = obstacleInterval;
+    snapshot.obstacleSpeed = obstacleSpeed;
+    snapshot.currentDifficulty = currentDifficulty;
+    snapshot.patternCooldownTimer = patternCooldownTimer;
+    snapshot.lastPattern = lastPattern;
+    snapshot.consecutiveHardPatterns = consecutiveHardPatterns;
+    snapshot.random = randomGenerator.getState();
+    std::copy(patternSpawnCounts, patternSpawnCounts + PATTERN_COUNT, snapshot.patternSpawnCounts);
+}
+
+void ObstacleManager::restoreSnapshot(const Snapshot& snapshot, bool restoreHistory) {
+    // The pool holds at least Snapshot::CAPACITY slots: the ring restarts at slot 0
+    size_t count = std::min<size_t>(snapshot.count, obstacles.capacity());
+    if (count < obstacles.count) {
+        poolStats.retired += obstacles.count - count;
+    } else {
+        poolStats.spawned += count - obstacles.count;
+        poolStats.peakCount = std::max(poolStats.peakCount, count);
+    }
+    std::memcpy(obstacles.posX.data(), snapshot.posX, count * sizeof(float));
+    std::memcpy(obstacles.previousPosX.data(), snapshot.previousPosX, count * sizeof(float));
+    std::memcpy(obstacles.posY.data(), snapshot.posY, count * sizeof(float));
+    std::memcpy(obstacles.type.data(), snapshot.type, count * sizeof(Obstacle::ObstacleType));
+    std::memcpy(obstacles.pattern.data(), snapshot.pattern, count * sizeof(ObstaclePattern));
+    obstacles.head = 0;
+    obstacles.count = count;
+    
+    spawnTimer = snapshot.spawnTimer;
+    obstacleInterval = snapshot.obstacleInterval;
+    obstacleSpeed = snapshot.obstacleSpeed;
+    currentDifficulty = snapshot.currentDifficulty;
+    patternCooldownTimer = snapshot.patternCooldownTimer;
+    lastPattern = snapshot.lastPattern;
+    consecutiveHardPatterns = snapshot.consecutiveHardPatterns;
+    if (restoreHistory) {
+        randomGenerator.setState(snapshot.random);
+        std::copy(snapshot.patternSpawnCounts, snapshot.patternSpawnCounts + PATTERN_COUNT, patternSpawnCounts);
     }
-    obstacles.emplace_back(SPAWN_POSITION_X + xOffset, SPAWN_POSITION_Y + offsetY, obstacleSpeed, type);
+    
+    // Unlocked patterns are a prefix of the fixed unlock order (capacity reserved, no allocation)
+    availablePatterns.assign(unlockOrder.begin(), unlockOrder.begin() + snapshot.unlockedCount);
+    selectionTableDirty = true;
 }
 
 void ObstacleManager::spawnObstacle() {
@@ -391,34 +707,59 @@ void ObstacleManager::spawnObstacle() {
 }
 
 void ObstacleManager::removeOffScreenObstacles() {
-    // Use erase-remove idiom: C++ standard pattern for efficient element removal
-    obstacles.erase(
-        std::remove_if(obstacles.begin(), obstacles.end(),
-            [](const Obstacle& obs) { return obs.isOffScreen(); }),
-        obstacles.end()
-    );
+    // Obstacles leave in FIFO order: retire the left-most ones by advancing the head
+    while (!obstacles.empty()) {
+        size_t s = obstacles.head;
+        const Obstacle::TypeInfo& info = Obstacle::getTypeInfo(obstacles.type[s]);
+        if (obstacles.posX[s] + info.spriteSize.x >= -50.0f) {
+            break;  // Same threshold as Obstacle::isOffScreen()
+        }
+        obstacles.head = (obstacles.head + 1) & obstacles.mask;
+        obstacles.count--;
+        poolStats.retired++;
+    }
 }
 
 void ObstacleManager::updateExistingObstacles(double deltaTime) {
-    for (auto& obstacle : obstacles) {
-        // Apply current speed to obstacle (important for difficulty scaling)
-        obstacle.setSpeed(obstacleSpeed);
-        
-        // Update obstacle position based on its speed and elapsed time
-        obstacle.update(deltaTime);
+    // Every obstacle moves at the current difficulty-adjusted speed,
+    // so the update is a tight loop over the packed x array
+    // (live slots form at most two contiguous runs: head..end and 0..wrap)
+    float distance = static_cast<float>(obstacleSpeed * deltaTime);
+    float* posX = obstacles.posX.data();
+    float* previousPosX = obstacles.previousPosX.data();
+    
+    size_t firstRunEnd = std::min(obstacles.head + obstacles.count, obstacles.capacity());
+    for (size_t i = obstacles.head; i < firstRunEnd; ++i) {
+        previousPosX[i] = posX[i];
+        posX[i] -= distance;
+    }
+    size_t wrappedCount = obstacles.count - (firstRunEnd - obstacles.head);
+    for (size_t i = 0; i < wrappedCount; ++i) {
+        previousPosX[i] = posX[i];
+        posX[i] -= distance;
     }
 }
 
-void ObstacleManager::applySpeedToAllObstacles() {
-    // This method ensures all obstacles move at the current difficulty-adjusted speed
-    for (auto& obstacle : obstacles) {
-        obstacle.setSpeed(obstacleSpeed);
+void ObstacleManager::renderDebugBoxes(sf::RenderWindow& window) const {
+    // Debug shapes are built on demand, never stored per obstacle
+    const float outline = Obstacle::COLLISION_OUTLINE_THICKNESS;
+    sf::RectangleShape box;
+    box.setFillColor(sf::Color::Transparent);
+    box.setOutlineColor(sf::Color::Red);
+    box.setOutlineThickness(outline);
+    
+    for (size_t i = 0; i < obstacles.size(); ++i) {
+        // Hit box includes the outline, so draw the shape inside it
+        sf::FloatRect bounds = getCollisionBounds(i);
+        box.setPosition(bounds.left + outline, bounds.top + outline);
+        box.setSize(sf::Vector2f(bounds.width - 2.0f * outline, bounds.height - 2.0f * outline));
+        window.draw(box);
     }
 }
 
 double ObstacleManager::generateRandomOffset(double min, double max) const {
-    std::uniform_real_distribution<double> dist(min, max);
-    return dist(randomGenerator);
+    // Same arithmetic as a uniform_real_distribution(min, max), without building one per call
+    return uniformDist(randomGenerator) * (max - min) + min;
 }
 
 Obstacle::ObstacleType ObstacleManager::getRandomObstacleType() const {
@@ -435,10 +776,89 @@ Obstacle::ObstacleType ObstacleManager::getRandomObstacleType() const {
 
 
 // Getter methods: Provide read-only access to internal state
-const std::vector<Obstacle>& ObstacleManager::getObstacles() const {
+const ObstacleManager::ObstacleArrays& ObstacleManager::getObstacleData() const {
     return obstacles;
 }
 
+sf::FloatRect ObstacleManager::getCollisionBounds(size_t index) const {
+    // Collision extents come from the per-type table
+    size_t s = obstacles.slot(index);
+    const Obstacle::TypeInfo& info = Obstacle::getTypeInfo(obstacles.type[s]);
+    return sf::FloatRect(obstacles.posX[s] + info.collisionOffset.x,
+                         obstacles.posY[s] + info.collisionOffset.y,
+                         info.collisionSize.x,
+                         info.collisionSize.y);
+}
+
+ObstacleManager::ObstaclePattern ObstacleManager::getObstaclePattern(size_t index) const {
+    return obstacles.pattern[obstacles.slot(index)];
+}
+
+Aabb ObstacleManager::getCollisionAabb(size_t index) const {
+    size_t s = obstacles.slot(index);
+    const Obstacle::TypeInfo& info = Obstacle::getTypeInfo(obstacles.type[s]);
+    return Aabb::fromRect(obstacles.posX[s] + info.collisionOffset.x,
+                          obstacles.posY[s] + info.collisionOffset.y,
+                          info.collisionSize.x,
+                          info.collisionSize.y);
+}
+
+Aabb ObstacleManager::getSpriteAabb(size_t index) const {
+    size_t s = obstacles.slot(index);
+    const Obstacle::TypeInfo& info = Obstacle::getTypeInfo(obstacles.type[s]);
+    return Aabb::fromRect(obstacles.posX[s], obstacles.posY[s], info.spriteSize.x, info.spriteSize.y);
+}
+
+void ObstacleManager::findObstaclesInRange(float minX, float maxX, size_t& first, size_t& last) const {
+    // Widest possible collision extent relative to posX, over all obstacle types
+    float minOffset = 0.0f;
+    float maxRight = 0.0f;
+    for (int t = 0; t < Obstacle::TYPE_COUNT; ++t) {
+        const Obstacle::TypeInfo& info = Obstacle::getTypeInfo(static_cast<Obstacle::ObstacleType>(t));
+        minOffset = (t == 0) ? info.collisionOffset.x : std::min(minOffset, info.collisionOffset.x);
+        maxRight = std::max(maxRight, info.collisionOffset.x + info.collisionSize.x);
+    }
+    findInRange(minX, maxX, minOffset, maxRight, first, last);
+}
+
+void ObstacleManager::findObstacleSpritesInRange(float minX, float maxX, size_t& first, size_t& last) const {
+    // Sprites start at posX; only the widest sprite matters
+    float maxRight = 0.0f;
+    for (int t = 0; t < Obstacle::TYPE_COUNT; ++t) {
+        maxRight = std::max(maxRight, Obstacle::getTypeInfo(static_cast<Obstacle::ObstacleType>(t)).spriteSize.x);
+    }
+    findInRange(minX, maxX, 0.0f, maxRight, first, last);
+}
+
+void ObstacleManager::findInRange(float minX, float maxX, float minOffset, float maxRight,
+                                  size_t& first, size_t& last) const {
+    // Pool is sorted by x: binary search (over logical indices) for the first
+    // obstacle whose box could still reach minX ...
+    const std::vector<float>& posX = obstacles.posX;
+    float searchX = minX - maxRight;
+    size_t low = 0;
+    size_t high = obstacles.size();
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (posX[obstacles.slot(mid)] < searchX) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    first = low;
+    
+    // ... up to the first obstacle whose box starts past maxX
+    last = first;
+    while (last < obstacles.size() && posX[obstacles.slot(last)] + minOffset < maxX) {
+        ++last;
+    }
+}
+
+const ObstacleManager::PoolStats& ObstacleManager::getPoolStats() const {
+    return poolStats;
+}
+
 size_t ObstacleManager::getObstacleCount() const {
     return obstacles.size();
 }
@@ -464,11 +884,19 @@ void ObstacleManager::getAverageObstacleDistance() const {
     
     double totalDistance = 0.0;
     for (size_t i = 1; i < obstacles.size(); ++i) {
-        // Calculate distance between consecutive obstacles
-        double distance = obstacles[i-1].getPosX() - obstacles[i].getPosX();
+        // Calculate distance between consecutive obstacles (pool is sorted by x)
+        double distance = obstacles.posX[obstacles.slot(i)] - obstacles.posX[obstacles.slot(i - 1)];
         totalDistance += distance;
     }
     
     double averageDistance = totalDistance / (obstacles.size() - 1);
     std::cout << "Average obstacle distance: " << averageDistance << " pixels" << std::endl;
+}
+
+void ObstacleManager::setDebugMode(bool enabled) {
+    debugMode = enabled;
+}
+
+void ObstacleManager::toggleDebugMode() {
+    debugMode = !debugMode;
 }
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include "ParallaxBackground.hpp"
+#include "TextureManager.hpp"
+#include "Logger.hpp"
+#include <cmath>
+#include <random>
+
+// ===== Static Member Definitions =====
+
+const int ParallaxBackground::LAYER_COUNT;
+const size_t ParallaxBackground::VERTICES_PER_LAYER;
+
+// Far layers move slower than the obstacles; the ground must match them exactly
+const float ParallaxBackground::SPEED_FACTORS[ParallaxBackground::LAYER_COUNT] = {
+    0.2f,       // FAR_HILLS
+    0.08f,      // CLOUDS
+    1.0f        // GROUND
+};
+
+const float ParallaxBackground::GROUND_LINE_Y = 460.0f;  // Just below the obstacle sprites (bottom at 459.5)
+
+// Strip sizes (powers of two, so repeating works even without NPOT texture support)
+static const unsigned int HILLS_WIDTH = 1024;
+static const unsigned int HILLS_HEIGHT = 96;
+static const unsigned int CLOUDS_WIDTH = 1024;
+static const unsigned int CLOUDS_HEIGHT = 64;
+static const unsigned int GROUND_WIDTH = 512;
+static const unsigned int GROUND_HEIGHT = 16;
+static const unsigned int GROUND_LINE_ROW = 4;  // Row of the ground line in its strip
+
+const float ParallaxBackground::LAYER_TOPS[ParallaxBackground::LAYER_COUNT] = {
+    GROUND_LINE_Y - HILLS_HEIGHT,       // FAR_HILLS: dunes end at the ground line
+    70.0f,                              // CLOUDS
+    GROUND_LINE_Y - GROUND_LINE_ROW     // GROUND: line row lands on GROUND_LINE_Y
+};
+
+static const sf::Color HILLS_FILL_COLOR(238, 238, 238);
+static const sf::Color HILLS_EDGE_COLOR(214, 214, 214);
+static const sf::Color GROUND_COLOR(83, 83, 83);    // Same grey as the sprites
+static const unsigned int GROUND_PEBBLE_SEED = 7;   // Fixed: the strip looks the same every run
+
+// ===== Core Methods =====
+
+ParallaxBackground::ParallaxBackground() {
+    for (int i = 0; i < LAYER_COUNT; ++i) {
+        layers[i].speedFactor = SPEED_FACTORS[i];
+    }
+}
+
+bool ParallaxBackground::initialize(float viewWidth) {
+    bool ready = setupLayer(Layer::FAR_HILLS, "parallax_hills", buildHillsStrip(), viewWidth);
+    
+    // Clouds come from the obstacles sheet; the colored fallbacks have none
+    sf::Image cloud;
+    if (TextureManager::getInstance().copySpriteImage(TextureManager::SpriteType::CLOUD, cloud)) {
+        ready = setupLayer(Layer::CLOUDS, "parallax_clouds", buildCloudStrip(cloud), viewWidth) && ready;
+    } else {
+        DINO_LOG_WARN(TEXTURE, "No cloud sprite, cloud layer disabled");
+        ready = false;
+    }
+    
+    ready = setupLayer(Layer::GROUND, "parallax_ground", buildGroundStrip(), viewWidth) && ready;
+    return ready;
+}
+
+void ParallaxBackground::update(double deltaTime, double obstacleSpeed) {
+    for (LayerState& layer : layers) {
+        if (!layer.texture) continue;
+        
+        layer.previousOffset = layer.offset;
+        layer.offset += obstacleSpeed * layer.speedFactor * deltaTime;
+        
+        // Wrap both steps together so interpolation never jumps back a whole strip
+        if (layer.offset >= layer.stripWidth) {
+            layer.offset -= layer.stripWidth;
+            layer.previousOffset -= layer.stripWidth;
+        }
+    }
+}
+
+void ParallaxBackground::render(sf::RenderTarget& target, double alpha) {
+    float offsets[LAYER_COUNT];
+    getOffsets(alpha, offsets);
+    render(target, offsets);
+}
+
+void ParallaxBackground::render(sf::RenderTarget& target, const float offsets[LAYER_COUNT]) {
+    for (int i = 0; i < LAYER_COUNT; ++i) {
+        LayerState& layer = layers[i];
+        if (!layer.texture) continue;
+        
+        // Only the texture x of the quad changes (repeat mode wraps it)
+        float left = offsets[i];
+        float right = left + (layer.vertices[1].position.x - layer.vertices[0].position.x);
+        layer.vertices[0].texCoords.x = left;
+        layer.vertices[1].texCoords.x = right;
+        layer.vertices[2].texCoords.x = right;
+        layer.vertices[3].texCoords.x = left;
+        layer.vertices[4].texCoords.x = right;
+        layer.vertices[5].texCoords.x = left;
+        
+        target.draw(layer.vertices, VERTICES_PER_LAYER, sf::Triangles, sf::RenderStates(layer.texture));
+    }
+}
+
+void ParallaxBackground::getOffsets(double alpha, float offsets[LAYER_COUNT]) const {
+    for (int i = 0; i < LAYER_COUNT; ++i) {
+        const LayerState& layer = layers[i];
+        offsets[i] = static_cast<float>(layer.previousOffset + (layer.offset - layer.previousOffset) * alpha);
+    }
+}
+
+double ParallaxBackground::getOffset(Layer layer) const {
+    return layers[static_cast<int>(layer)].offset;
+}
+
+// ===== Private Helper Methods =====
+
+bool ParallaxBackground::setupLayer(Layer layer, const std::string& name, const sf::Image& strip, float viewWidth) {
+    TextureManager& textureManager = TextureManager::getInstance();
+    if (!textureManager.loadTextureFromImage(name, strip, true)) {
+        DINO_LOG_WARN(TEXTURE, "Could not create parallax strip {}", name);
+        return false;
+    }
+    
+    LayerState& state = layers[static_cast<int>(layer)];
+    sf::Vector2u size = strip.getSize();
+    state.texture = textureManager.getTexture(name);
+    state.stripWidth = static_cast<float>(size.x);
+    
+    // Same triangle order as SpriteBatch::appendQuad: TL, TR, BR, TL, BR, BL
+    float top = LAYER_TOPS[static_cast<int>(layer)];
+    float bottom = top + static_cast<float>(size.y);
+    float height = static_cast<float>(size.y);
+    sf::Vertex topLeft(sf::Vector2f(0.0f, top), sf::Color::White, sf::Vector2f(0.0f, 0.0f));
+    sf::Vertex topRight(sf::Vector2f(viewWidth, top), sf::Color::White, sf::Vector2f(viewWidth, 0.0f));
+    sf::Vertex bottomRight(sf::Vector2f(viewWidth, bottom), sf::Color::White, sf::Vector2f(viewWidth, height));
+    sf::Vertex bottomLeft(sf::Vector2f(0.0f, bottom), sf::Color::White, sf::Vector2f(0.0f, height));
+    state.vertices[0] = topLeft;
+    state.vertices[1] = topRight;
+    state.vertices[2] = bottomRight;
+    state.vertices[3] = topLeft;
+    state.vertices[4] = bottomRight;
+    state.vertices[5] = bottomLeft;
+    return true;
+}
+
+sf::Image ParallaxBackground::buildHillsStrip() {
+    sf::Image strip;
+    strip.create(HILLS_WIDTH, HILLS_HEIGHT, sf::Color::Transparent);
+    
+    // Whole numbers of waves per strip, so the right edge meets the left edge
+    const double twoPi = 6.283185307179586;
+    for (unsigned int x = 0; x < HILLS_WIDTH; ++x) {
+        double t = twoPi * x / HILLS_WIDTH;
+        double height = 38.0 + 16.0 * std::sin(2.0 * t) + 9.0 * std::sin(5.0 * t + 1.3) + 4.0 * std::sin(11.0 * t + 0.4);
+        unsigned int crest = HILLS_HEIGHT - static_cast<unsigned int>(height);
+        
+        strip.setPixel(x, crest, HILLS_EDGE_COLOR);
+        for (unsigned int y = crest + 1; y < HILLS_HEIGHT; ++y) {
+            strip.setPixel(x, y, HILLS_FILL_COLOR);
+        }
+    }
+    return strip;
+}
+
+sf::Image ParallaxBackground::buildCloudStrip(const sf::Image& cloud) {
+    sf::Image strip;
+    strip.create(CLOUDS_WIDTH, CLOUDS_HEIGHT, sf::Color::Transparent);
+    
+    // Uneven spacing and heights so the repeat is not obvious
+    static const unsigned int CLOUD_POSITIONS[][2] = {
+        {40, 12}, {310, 38}, {540, 4}, {830, 26}
+    };
+    sf::Vector2u cloudSize = cloud.getSize();
+    for (const auto& position : CLOUD_POSITIONS) {
+        if (position[0] + cloudSize.x <= CLOUDS_WIDTH && position[1] + cloudSize.y <= CLOUDS_HEIGHT) {
+            strip.copy(cloud, position[0], position[1], sf::IntRect(0, 0, 0, 0), true);
+        }
+    }
+    return strip;
+}
+
+sf::Image ParallaxBackground::buildGroundStrip() {
+    sf::Image strip;
+    strip.create(GROUND_WIDTH, GROUND_HEIGHT, sf::Color::Transparent);
+    
+    for (unsigned int x = 0; x < GROUND_WIDTH; ++x) {
+        strip.setPixel(x, GROUND_LINE_ROW, GROUND_COLOR);
+    }
+    
+    // Short pebble dashes below the line and a few bumps on it (wrapping at the strip edge)
+    std::mt19937 random(GROUND_PEBBLE_SEED);
+    std::uniform_int_distribution<unsigned int> gap(6, 22);
+    std::uniform_int_distribution<unsigned int> length(1, 3);
+    std::uniform_int_distribution<unsigned int> row(GROUND_LINE_ROW + 3, GROUND_HEIGHT - 2);
+    for (unsigned int x = gap(random); x < GROUND_WIDTH; x += gap(random)) {
+        unsigned int dashRow = row(random);
+        unsigned int dashLength = length(random);
+        for (unsigned int i = 0; i < dashLength; ++i) {
+            strip.setPixel((x + i) % GROUND_WIDTH, dashRow, GROUND_COLOR);
+        }
+        if (dashLength == 3) {
+            strip.setPixel((x + 1) % GROUND_WIDTH, GROUND_LINE_ROW - 1, GROUND_COLOR);  // Bump
+        }
+    }
+    return strip;
+}
@@ -1,13 +1,15 @@
 #include "Player.hpp"
-#include <iostream>
+#include "Logger.hpp"
+#include <cstdlib>  // for std::abs
 
 const double Player::GROUND_Y = 400.0; // Ground level Y coordinate
-const double Player::JUMP_STRENGTH = -400.0; // Initial jump velocity
-const double Player::GRAVITY = 700.0; // Gravity acceleration
+constexpr double Player::JUMP_STRENGTH;
+constexpr double Player::GRAVITY;
 const double Player::FAST_FALL_MULTIPLIER = 2.5;        // Enhanced gravity for fast falling
 const double Player::FAST_FALL_TERMINAL_VELOCITY = 800.0; // Maximum fall speed to maintain control
-const double Player::RUNNING_ANIMATION_SPEED = 8.0;
-const sf::Vector2f Player::DEFAULT_SIZE = sf::Vector2f(60.0, 64.5);  // Original Rectangular size
+constexpr double Player::DEFAULT_WIDTH;
+const sf::Vector2f Player::DEFAULT_SIZE = sf::Vector2f(DEFAULT_WIDTH, 64.5);  // Original Rectangular size
+const sf::Vector2f Player::DUCKING_SIZE = sf::Vector2f(110.0f * 3 / 4, 53.0f * 3 / 4);
 
 // ===== Triple Collision Box Constants =====
 const double Player::HEAD_WIDTH_RATIO = 0.5;    // Head box: narrow and precise
@@ -16,19 +18,25 @@ const double Player::BODY_WIDTH_RATIO = 0.4;    // Body box: main collision area
 const double Player::BODY_HEIGHT_RATIO = 0.66;   // Body box: middle 50% of sprite
 const double Player::TAIL_WIDTH_RATIO = 0.25;    // Tail box: rear area for ducking
 const double Player::TAIL_HEIGHT_RATIO = 0.37;   // Tail box: lower 30% of sprite
+const float Player::COLLISION_OUTLINE_THICKNESS = 2.0f;  // Debug outline (getGlobalBounds includes it)
+
+// ===== Hitbox Table =====
+const int Player::COLLISION_BOX_COUNT;
+const int Player::HITBOX_STATE_COUNT;
+const int Player::ANIMATION_FRAME_COUNT;
+const Player::HitboxTable Player::HITBOX_TABLE = Player::buildHitboxTable();  // After the sizes and ratios it reads
 
 Player::Player(double startX, double startY) 
     : posX(startX), 
       posY(startY), 
+      previousPosY(startY),
       velocityY(0.0), 
       isJumping(false),
       isDucking(false),
       isFastFalling(false),        // NEW: Initialize fast fall state
       duckPressed(false),          // NEW: Track duck key state
-      animationTimer(0.0f),
-      isRunningAnimationFrame1(true),
       targetSize(DEFAULT_SIZE),
-      currentSpriteType(TextureManager::SpriteType::DINO_RUNNING_1),
+      currentHitboxes(&HITBOX_TABLE.entries[0][0]),
       debugMode(false) { 
     
     // Initialize sprite system
@@ -44,12 +52,12 @@ Player::Player(double startX, double startY)
     // Update initial positions
     updateTripleCollisionBoxes();
     
-    std::cout << "Player initialized with enhanced ducking system at (" << startX << ", " << startY << ")" << std::endl;
+    DINO_LOG_INFO(PLAYER, "Player initialized with enhanced ducking system at ({}, {})", startX, startY);
 }
 
 Player::~Player() {
     // Sprite and bounding box cleanup is automatic
-    std::cout << "Player destroyed" << std::endl;
+    DINO_LOG_INFO(PLAYER, "Player destroyed");
 } 
 
 void Player::jump() {
@@ -58,19 +66,15 @@ void Player::jump() {
         isJumping = true; // Set jumping status
 
         // Change to jumping sprite
-        applySpriteType(TextureManager::SpriteType::DINO_JUMPING);
-        if (isDucking) {
-            applySpriteType(TextureManager::SpriteType::DINO_DUCKING_1);
-        }
+        applyClip(AnimationClip::Id::DINO_JUMP);
         
-        std::cout << "Player jumped!" << std::endl;
+        DINO_LOG_DEBUG(PLAYER, "Player jumped!");
     }
 }
 
 void Player::startDucking() {
     duckPressed = true;  // Mark that duck key is being pressed
-    targetSize = sf::Vector2f(110.0f * 3 / 4, 53.0f * 3 / 4);
-    boundingBox.setSize(targetSize);
+    targetSize = DUCKING_SIZE;
     // updateBoundingBox();
     updateTripleCollisionBoxes();
     
@@ -92,19 +96,18 @@ void Player::startDucking() {
             if (velocityY < 0) {
                 // Still rising: cut jump short by reducing upward velocity
                 velocityY = 0.3;  // Immediately going down
-                std::cout << "Jump cut short - starting fast fall!" << std::endl;
+                DINO_LOG_DEBUG(PLAYER, "Jump cut short - starting fast fall!");
             } else {
                 // Already falling: ensure minimum fall speed for responsiveness
                 velocityY = std::max(velocityY, 200.0);  // Minimum fall speed
-                std::cout << "Fast fall activated!" << std::endl;
+                DINO_LOG_DEBUG(PLAYER, "Fast fall activated!");
             }
             // Change to ducking sprite even in air for visual feedback
-            applySpriteType(TextureManager::SpriteType::DINO_DUCKING_1);
+            applyClip(AnimationClip::Id::DINO_FAST_FALL);
             
             
             // Adjust collision box for air ducking
-            targetSize = sf::Vector2f(110.0f * 3 / 4, 53.0f * 3 / 4);
-            boundingBox.setSize(targetSize);
+            targetSize = DUCKING_SIZE;
             // updateBoundingBox();
             updateTripleCollisionBoxes();
         }
@@ -117,25 +120,21 @@ void Player::startDucking() {
         if (!isDucking) {
             isDucking = true;
             
-            // Change to ducking sprite
-            if (isRunningAnimationFrame1) {
-                applySpriteType(TextureManager::SpriteType::DINO_DUCKING_1);
-            } else {
-                applySpriteType(TextureManager::SpriteType::DINO_DUCKING_2);
-            }
+            // Change to ducking sprite (same stride frame)
+            applyClip(AnimationClip::Id::DINO_DUCK);
             
             // Adjust size for ducking (wider, shorter based on sprite dimensions)
-            targetSize = sf::Vector2f(110.0f * 3 / 4, 53.0f * 3 / 4);
-            boundingBox.setSize(targetSize);
+            targetSize = DUCKING_SIZE;
             
             // Adjust Y position to keep player on ground level
             // This calculation ensures the bottom of the ducking sprite aligns with ground
             posY = GROUND_Y - targetSize.y + DEFAULT_SIZE.y;
+            previousPosY = posY;  // Crouching is instant, don't interpolate it
             
             // updateBoundingBox();
             updateTripleCollisionBoxes();
             
-            std::cout << "Ground ducking activated!" << std::endl;
+            DINO_LOG_DEBUG(PLAYER, "Ground ducking activated!");
         }
     }
 }
@@ -153,15 +152,14 @@ void Player::stopDucking() {
             isFastFalling = false;
             // Restore normal collision size
             targetSize = DEFAULT_SIZE;
-            boundingBox.setSize(targetSize);
             
             // Return to normal jumping sprite
-            applySpriteType(TextureManager::SpriteType::DINO_RUNNING_1);
+            applyClip(AnimationClip::Id::DINO_JUMP);
             
             // updateBoundingBox();
             updateTripleCollisionBoxes();
             
-            std::cout << "Fast fall deactivated - normal fall resumed!" << std::endl;
+            DINO_LOG_DEBUG(PLAYER, "Fast fall deactivated - normal fall resumed!");
         }
     } else {
         // ===== GROUND: Stop Traditional Duck =====
@@ -173,15 +171,15 @@ void Player::stopDucking() {
             
             // Return to normal size and position
             targetSize = DEFAULT_SIZE;
-            boundingBox.setSize(targetSize);
             posY = GROUND_Y;  // Reset to normal ground level
+            previousPosY = posY;  // Standing up is instant, don't interpolate it
             
             // Return to running animation
             updateSprite();
             // updateBoundingBox();
             updateTripleCollisionBoxes();
             
-            std::cout << "Ground ducking deactivated!" << std::endl;
+            DINO_LOG_DEBUG(PLAYER, "Ground ducking deactivated!");
         }
     }
 }
@@ -194,6 +192,8 @@ void Player::update(double deltaTime) {
      * 2. Enhanced gravity when fast falling
      * 3. Speed limiting to maintain game balance
      */
+    previousPosY = posY;  // Remember last state for render interpolation
+    
     if (isJumping) {
         // Calculate gravity based on current ducking state
         double currentGravity = GRAVITY;
@@ -224,32 +224,26 @@ void Player::update(double deltaTime) {
             isJumping = false;
             isFastFalling = false;  // Always reset fast fall on landing
             
-            std::cout << "Player landed!" << std::endl;
+            DINO_LOG_DEBUG(PLAYER, "Player landed!");
             
             // Determine ground state based on duck key
             if (duckPressed) {
                 // Duck key still held - transition to ground ducking
                 isDucking = true;
-                if (isRunningAnimationFrame1) {
-                    applySpriteType(TextureManager::SpriteType::DINO_DUCKING_1);
-                } else {
-                    applySpriteType(TextureManager::SpriteType::DINO_DUCKING_2);
-                }
+                applyClip(AnimationClip::Id::DINO_DUCK);
                 
                 // Adjust for ground ducking position and size
-                targetSize = sf::Vector2f(110.0f * 3 / 4, 53.0f * 3 / 4);
-                boundingBox.setSize(targetSize);
+                targetSize = DUCKING_SIZE;
                 posY = GROUND_Y - targetSize.y + DEFAULT_SIZE.y;
                 
-                std::cout << "Landed into ground duck!" << std::endl;
+                DINO_LOG_DEBUG(PLAYER, "Landed into ground duck!");
             } else {
                 // Duck key not held - return to normal running
                 isDucking = false;
                 targetSize = DEFAULT_SIZE;
-                boundingBox.setSize(targetSize);
                 updateSprite();  // This will resume running animation
                 
-                std::cout << "Landed into normal running!" << std::endl;
+                DINO_LOG_DEBUG(PLAYER, "Landed into normal running!");
             }
         }
     }
@@ -273,13 +267,20 @@ void Player::update(double deltaTime) {
     updateTripleCollisionBoxes();
 }
 
-void Player::render(sf::RenderWindow& window) {
-    // FIXED: Render the sprite instead of the old shape
-    window.draw(currentSprite);  // Draw the actual sprite
+void Player::render(sf::RenderWindow& window, double alpha) {
+    // Blend between the last two simulation steps for smooth motion
+    double renderY = previousPosY + (posY - previousPosY) * alpha;
+    currentSprite.setPosition(posX, renderY);
+    
+    // Draw through the same batched path as obstacles (one draw call per sheet)
+    spriteBatch.clear();
+    spriteBatch.add(currentSprite);
+    spriteBatch.draw(window);
     
     //===== Optionally render debug bounding box (comment out for release) ==========
     // only render if debug mode is enabled
     if (debugMode) {
+        syncDebugBoxes();
         window.draw(headCollisionBox);  // Blue head box
         window.draw(bodyCollisionBox);  // Red body box
         window.draw(tailCollisionBox);  // Green tail box
@@ -291,56 +292,104 @@ void Player::reset() {
     // Reset all physics and state variables
     posX = 100.0;
     posY = GROUND_Y;
+    previousPosY = posY;
     velocityY = 0.0;
     isJumping = false;
     isDucking = false;
     isFastFalling = false;    // NEW: Reset fast fall state
     duckPressed = false;      // NEW: Reset duck key state
     
-    // Reset animation state
-    animationTimer = 0.0f;
-    isRunningAnimationFrame1 = true;
-    
     // Reset size and collision box
     targetSize = DEFAULT_SIZE;
-    boundingBox.setSize(targetSize);
-    
-    // Reset sprite to initial running frame
-    applySpriteType(TextureManager::SpriteType::DINO_RUNNING_1);
     
-    // Update positions
-    currentSprite.setPosition(posX, posY);
+    // Reset animation to the first running frame
+    animation.play(AnimationClip::get(AnimationClip::Id::DINO_RUN));
+    syncSpriteFrame();
     // updateBoundingBox();
     updateTripleCollisionBoxes();
     
-    std::cout << "Player reset to initial state with enhanced ducking system" << std::endl;
+    DINO_LOG_INFO(PLAYER, "Player reset to initial state with enhanced ducking system");
+}
+
+void Player::saveSnapshot(Snapshot& snapshot) const {
+    snapshot.posX = posX;
+    snapshot.posY = posY;
+    snapshot.previousPosY = previousPosY;
+    snapshot.velocityY = velocityY;
+    snapshot.animation = animation.getState();
+    snapshot.targetSize = targetSize;
+    snapshot.isJumping = isJumping;
+    snapshot.isDucking = isDucking;
+    snapshot.isFastFalling = isFastFalling;
+    snapshot.duckPressed = duckPressed;
+}
+
+void Player::restoreSnapshot(const Snapshot& snapshot) {
+    posX = snapshot.posX;
+    posY = snapshot.posY;
+    previousPosY = snapshot.previousPosY;
+    velocityY = snapshot.velocityY;
+    animation.setState(snapshot.animation);
+    targetSize = snapshot.targetSize;
+    isJumping = snapshot.isJumping;
+    isDucking = snapshot.isDucking;
+    isFastFalling = snapshot.isFastFalling;
+    duckPressed = snapshot.duckPressed;
+    
+    syncSpriteFrame();
+    updateTripleCollisionBoxes();
 }
 
 // ===== Information Methods =====
 
-const sf::RectangleShape& Player::getHeadCollisionBox() const {
-    return headCollisionBox;
+void Player::getCollisionAabbs(Aabb boxes[3]) const {
+    for (int i = 0; i < COLLISION_BOX_COUNT; ++i) {
+        boxes[i] = collisionBoxes[i];
+    }
 }
 
-const sf::RectangleShape& Player::getBodyCollisionBox() const {
-    return bodyCollisionBox;
+AabbSpan Player::getCollisionBoxes() const {
+    AabbSpan span = {collisionBoxes, COLLISION_BOX_COUNT};
+    return span;
 }
 
-const sf::RectangleShape& Player::getTailCollisionBox() const {
-    return tailCollisionBox;
+const sf::RectangleShape& Player::getShape() const {
+    // Legacy box follows the body box; only the legacy collision methods ask for it
+    const HitboxOffset& body = currentHitboxes->boxes[1];
+    boundingBox.setSize(sf::Vector2f(body.width, body.height));
+    boundingBox.setPosition(posX + body.offsetX, posY + body.offsetY);
+    return boundingBox;
 }
 
-std::vector<sf::RectangleShape> Player::getAllCollisionBoxes() const {
-    return {headCollisionBox, bodyCollisionBox, tailCollisionBox};
+const sf::Sprite& Player::getSprite() const {
+    return currentSprite;
 }
 
+TextureManager::SpriteType Player::getSpriteType() const {
+    return animation.getFrame().spriteType;
+}
 
-const sf::RectangleShape& Player::getShape() const {
-    return boundingBox;
+sf::Vector2f Player::getSpriteSize() const {
+    const sf::IntRect& rect = currentSprite.getTextureRect();
+    const sf::Vector2f& scale = currentSprite.getScale();
+    return sf::Vector2f(std::abs(rect.width) * scale.x, std::abs(rect.height) * scale.y);
 }
 
-const sf::Sprite& Player::getSprite() const {
-    return currentSprite;
+void Player::prepareCollisionMasks() {
+    // Any dino sprite can be shown at either size (the size changes before the sprite does)
+    static const TextureManager::SpriteType PLAYER_SPRITES[] = {
+        TextureManager::SpriteType::DINO_RUNNING_1,
+        TextureManager::SpriteType::DINO_RUNNING_2,
+        TextureManager::SpriteType::DINO_JUMPING,
+        TextureManager::SpriteType::DINO_DUCKING_1,
+        TextureManager::SpriteType::DINO_DUCKING_2
+    };
+    
+    TextureManager& textureManager = TextureManager::getInstance();
+    for (TextureManager::SpriteType spriteType : PLAYER_SPRITES) {
+        textureManager.prepareCollisionMask(spriteType, DEFAULT_SIZE);
+        textureManager.prepareCollisionMask(spriteType, DUCKING_SIZE);
+    }
 }
 
 bool Player::getIsJumping() const {
@@ -363,13 +412,29 @@ double Player::getPosY() const {
     return posY;
 }
 
+double Player::getPreviousPosY() const {
+    return previousPosY;
+}
+
+double Player::getVelocityY() const {
+    return velocityY;
+}
+
 sf::Vector2f Player::getSize() const {
     return targetSize;
 }
 
+sf::Vector2f Player::getDefaultSize() {
+    return DEFAULT_SIZE;
+}
+
+sf::Vector2f Player::getDuckingSize() {
+    return DUCKING_SIZE;
+}
+
 void Player::setDebugMode(bool enabled) {
     debugMode = enabled;
-    std::cout << "Debug mode " << (enabled ? "enabled" : "disabled") << std::endl;
+    DINO_LOG_INFO(PLAYER, "Debug mode {}", enabled ? "enabled" : "disabled");
 }
 
 bool Player::isDebugMode() const {
@@ -378,7 +443,7 @@ bool Player::isDebugMode() const {
 
 void Player::toggleDebugMode() {
     debugMode = !debugMode;
-    std::cout << "Debug mode toggled " << (debugMode ? "ON" : "OFF") << std::endl;
+    DINO_LOG_INFO(PLAYER, "Debug mode toggled {}", debugMode ? "ON" : "OFF");
 }
 
 // ===== Private Helper Methods =====
@@ -389,23 +454,12 @@ void Player::updateSprite() {
      * Priority: Jumping > Ducking > Running Animation
      */
     if (isJumping) {
-        applySpriteType(TextureManager::SpriteType::DINO_JUMPING);
-        if (isDucking) {
-            applySpriteType(TextureManager::SpriteType::DINO_DUCKING_1);
-        }
+        applyClip(isDucking ? AnimationClip::Id::DINO_FAST_FALL : AnimationClip::Id::DINO_JUMP);
     } else if (isDucking || isFastFalling) {
-        if (isRunningAnimationFrame1) {
-            applySpriteType(TextureManager::SpriteType::DINO_DUCKING_1);
-        } else {
-            applySpriteType(TextureManager::SpriteType::DINO_DUCKING_2);
-        }
+        applyClip(AnimationClip::Id::DINO_DUCK);
     } else {
-        // Use current running animation frame
-        if (isRunningAnimationFrame1) {
-            applySpriteType(TextureManager::SpriteType::DINO_RUNNING_1);
-        } else {
-            applySpriteType(TextureManager::SpriteType::DINO_RUNNING_2);
-        }
+        // Continue the running stride
+        applyClip(AnimationClip::Id::DINO_RUN);
     }
 }
 
@@ -414,39 +468,30 @@ void Player::updateRunningAnimation(float deltaTime) {
      * Frame-based animation system for smooth running motion.
      * Uses delta time to ensure consistent animation speed regardless of framerate.
      */
-    animationTimer += deltaTime;
-    
-    // Check if it's time to switch animation frames
-    if (animationTimer >= (1.0f / RUNNING_ANIMATION_SPEED)) {
-        isRunningAnimationFrame1 = !isRunningAnimationFrame1;
-        animationTimer = 0.0f;
-        
-        // Apply the new animation frame
-        updateSprite();
+    if (animation.update(deltaTime)) {
+        // The clip already matches the state: only the frame rectangle changes
+        syncSpriteFrame();
     }
 }
 
-void Player::applySpriteType(TextureManager::SpriteType spriteType) {
-    /*
-     * Central sprite application method that handles texture loading,
-     * scaling, and positioning through the TextureManager system.
-     */
-    currentSpriteType = spriteType;
-    
-    // Get texture manager instance and create properly sized sprite
-    TextureManager& textureManager = TextureManager::getInstance();
-    currentSprite = textureManager.createSprite(spriteType, targetSize);
-    
-    // Position the sprite at current player position
-    currentSprite.setPosition(posX, posY);
+void Player::applyClip(AnimationClip::Id clipId) {
+    // Called on state changes only, which may also change targetSize: always resync
+    animation.switchClip(AnimationClip::get(clipId));
+    syncSpriteFrame();
 }
 
-void Player::updateBoundingBox() {
+void Player::syncSpriteFrame() {
     /*
-     * Keep collision bounding box synchronized with sprite position.
-     * This ensures accurate collision detection regardless of sprite changes.
+     * Central sprite application method: rectangle from the shared clip,
+     * scale to the current target size, position at the player.
      */
-    boundingBox.setPosition(posX, posY);
+    animation.applyTo(currentSprite);
+    
+    const sf::IntRect& rect = currentSprite.getTextureRect();
+    if (rect.width != 0 && rect.height != 0) {
+        currentSprite.setScale(targetSize.x / rect.width, targetSize.y / rect.height);
+    }
+    currentSprite.setPosition(posX, posY);
 }
 
 void Player::initializeSprite() {
@@ -454,9 +499,10 @@ void Player::initializeSprite() {
      * Initialize the sprite system with the first running animation frame.
      * This sets up the player's visual representation at game start.
      */
-    applySpriteType(TextureManager::SpriteType::DINO_RUNNING_1);
+    animation.play(AnimationClip::get(AnimationClip::Id::DINO_RUN));
+    syncSpriteFrame();
     
-    std::cout << "Player sprite system initialized with enhanced ducking support" << std::endl;
+    DINO_LOG_INFO(PLAYER, "Player sprite system initialized with enhanced ducking support");
 }
 
 // ===== Triple Collision Box Management =====
@@ -465,114 +511,140 @@ void Player::initializeTripleCollisionBoxes() {
     // Head collision box setup (Blue outline for debugging)
     headCollisionBox.setFillColor(sf::Color::Transparent);
     headCollisionBox.setOutlineColor(sf::Color::Blue);
-    headCollisionBox.setOutlineThickness(2.0f);
+    headCollisionBox.setOutlineThickness(COLLISION_OUTLINE_THICKNESS);
     
     // Body collision box setup (Red outline for debugging)
     bodyCollisionBox.setFillColor(sf::Color::Transparent);
     bodyCollisionBox.setOutlineColor(sf::Color::Red);
-    bodyCollisionBox.setOutlineThickness(2.0f);
+    bodyCollisionBox.setOutlineThickness(COLLISION_OUTLINE_THICKNESS);
     
     // Tail collision box setup (Green outline for debugging)
     tailCollisionBox.setFillColor(sf::Color::Transparent);
     tailCollisionBox.setOutlineColor(sf::Color::Green);
-    tailCollisionBox.setOutlineThickness(2.0f);
+    tailCollisionBox.setOutlineThickness(COLLISION_OUTLINE_THICKNESS);
     
     // Legacy bounding box setup (Yellow outline for debugging)
     boundingBox.setFillColor(sf::Color::Transparent);
     boundingBox.setOutlineColor(sf::Color::Yellow);
     boundingBox.setOutlineThickness(2.0f);
     
-    std::cout << "Triple collision boxes initialized" << std::endl;
+    DINO_LOG_INFO(PLAYER, "Triple collision boxes initialized");
 }
 
 void Player::updateTripleCollisionBoxes() {
+    int state = 0;          // Running
     if (isDucking) {
-        updateDuckingStateCollision();
+        state = 2;
     } else if (isFastFalling) {
-        // If fast falling, adjust body collision box to be lower
-        double headOffsetY = targetSize.y * 0.1; // Lower the head box slightly
-        headCollisionBox.setPosition(headCollisionBox.getPosition().x, posY + headOffsetY);
-        double bodyOffsetY = targetSize.y * 0.1; // Lower the body box slightly
-        bodyCollisionBox.setPosition(bodyCollisionBox.getPosition().x, posY + bodyOffsetY);
-        double tailOffsetY = targetSize.y * 0.02; // Lower the tail box slightly
-        double tailOffsetX = targetSize.x * 0.07; // Keep tail box at the back
-        tailCollisionBox.setSize(sf::Vector2f(DEFAULT_SIZE.x * TAIL_WIDTH_RATIO, tailCollisionBox.getSize().y));
-        tailCollisionBox.setPosition(posX + tailOffsetX, posY + tailOffsetY);
+        state = 3;
     } else if (isJumping) {
-        updateJumpingStateCollision();
-    } else {
-        updateNormalStateCollision();
+        state = 1;
+    }
+    int frame = animation.getFrameIndex();  // Stride phase, shared by every dino clip
+    currentHitboxes = &HITBOX_TABLE.entries[state][frame];
+    
+    // Translate to the current position; the outline is part of the hit box
+    for (int i = 0; i < COLLISION_BOX_COUNT; ++i) {
+        const HitboxOffset& box = currentHitboxes->boxes[i];
+        float left = static_cast<float>(posX + box.offsetX);
+        float top = static_cast<float>(posY + box.offsetY);
+        collisionBoxes[i] = Aabb::fromRect(left - COLLISION_OUTLINE_THICKNESS,
+                                           top - COLLISION_OUTLINE_THICKNESS,
+                                           box.width + 2.0f * COLLISION_OUTLINE_THICKNESS,
+                                           box.height + 2.0f * COLLISION_OUTLINE_THICKNESS);
     }
-    
-    // Update legacy bounding box for backward compatibility
-    updateLegacyBoundingBox();
 }
 
-void Player::updateNormalStateCollision() {
-    // Head collision box (upper area, narrow)
-    double headWidth = targetSize.x * HEAD_WIDTH_RATIO;
-    double headHeight = targetSize.y * HEAD_HEIGHT_RATIO;
-    double headOffsetX = targetSize.x - headWidth;
-    double headOffsetY = 0.0;
+void Player::syncDebugBoxes() {
+    sf::RectangleShape* shapes[COLLISION_BOX_COUNT] = {&headCollisionBox, &bodyCollisionBox, &tailCollisionBox};
+    for (int i = 0; i < COLLISION_BOX_COUNT; ++i) {
+        const HitboxOffset& box = currentHitboxes->boxes[i];
+        shapes[i]->setSize(sf::Vector2f(box.width, box.height));
+        shapes[i]->setPosition(posX + box.offsetX, posY + box.offsetY);
+    }
+}
+
+// ===== Hitbox Table Construction =====
+
+Player::HitboxTable Player::buildHitboxTable() {
+    // Both animation frames share their state's boxes until the sprites need their own
+    HitboxTable table;
+    HitboxSet byState[HITBOX_STATE_COUNT] = {
+        computeNormalHitboxes(DEFAULT_SIZE),    // Running
+        computeNormalHitboxes(DEFAULT_SIZE),    // Jumping uses the normal boxes
+        computeDuckingHitboxes(DUCKING_SIZE),
+        computeFastFallHitboxes()
+    };
+    for (int state = 0; state < HITBOX_STATE_COUNT; ++state) {
+        for (int frame = 0; frame < ANIMATION_FRAME_COUNT; ++frame) {
+            table.entries[state][frame] = byState[state];
+        }
+    }
+    return table;
+}
+
+Player::HitboxSet Player::computeNormalHitboxes(const sf::Vector2f& size) {
+    HitboxSet set;
     
-    headCollisionBox.setSize(sf::Vector2f(headWidth, headHeight));
-    headCollisionBox.setPosition(posX + headOffsetX, posY + headOffsetY);
+    // Head collision box (upper area, narrow)
+    double headWidth = size.x * HEAD_WIDTH_RATIO;
+    double headHeight = size.y * HEAD_HEIGHT_RATIO;
+    HitboxOffset head = {size.x - headWidth, 0.0, static_cast<float>(headWidth), static_cast<float>(headHeight)};
+    set.boxes[0] = head;
     
     // Body collision box (middle area, main collision)
-    double bodyWidth = targetSize.x * BODY_WIDTH_RATIO;
-    double bodyHeight = targetSize.y * BODY_HEIGHT_RATIO;
-    double bodyOffsetX = (targetSize.x - bodyWidth / 0.55);
-    double bodyOffsetY = targetSize.y * HEAD_HEIGHT_RATIO / 1.4;
-    
-    bodyCollisionBox.setSize(sf::Vector2f(bodyWidth, bodyHeight));
-    bodyCollisionBox.setPosition(posX + bodyOffsetX, posY + bodyOffsetY);
+    double bodyWidth = size.x * BODY_WIDTH_RATIO;
+    double bodyHeight = size.y * BODY_HEIGHT_RATIO;
+    HitboxOffset body = {size.x - bodyWidth / 0.55, size.y * HEAD_HEIGHT_RATIO / 1.4,
+                         static_cast<float>(bodyWidth), static_cast<float>(bodyHeight)};
+    set.boxes[1] = body;
     
     // Tail collision box (lower area, rear detection)
-    double tailWidth = targetSize.x * TAIL_WIDTH_RATIO;
-    double tailHeight = targetSize.y * TAIL_HEIGHT_RATIO;
-    double tailOffsetX = 0.0;  // Position towards the back
-    double tailOffsetY = targetSize.y * 0.3;  // Lower position
+    double tailWidth = size.x * TAIL_WIDTH_RATIO;
+    double tailHeight = size.y * TAIL_HEIGHT_RATIO;
+    HitboxOffset tail = {0.0, size.y * 0.3, static_cast<float>(tailWidth), static_cast<float>(tailHeight)};
+    set.boxes[2] = tail;
     
-    tailCollisionBox.setSize(sf::Vector2f(tailWidth, tailHeight));
-    tailCollisionBox.setPosition(posX - tailOffsetX, posY + tailOffsetY);
+    return set;
 }
 
-void Player::updateDuckingStateCollision() {
-    // Head collision box (smaller when ducking)
-    double headWidth = targetSize.x * (HEAD_WIDTH_RATIO * 0.8f);
-    double headHeight = targetSize.y * (HEAD_HEIGHT_RATIO * 0.9f);
-    double headOffsetX = (targetSize.x - headWidth);
-    double headOffsetY = targetSize.y * 0.1f;
+Player::HitboxSet Player::computeDuckingHitboxes(const sf::Vector2f& size) {
+    HitboxSet set;
     
-    headCollisionBox.setSize(sf::Vector2f(headWidth, headHeight));
-    headCollisionBox.setPosition(posX + headOffsetX, posY + headOffsetY);
+    // Head collision box (smaller when ducking)
+    double headWidth = size.x * (HEAD_WIDTH_RATIO * 0.8f);
+    double headHeight = size.y * (HEAD_HEIGHT_RATIO * 0.9f);
+    HitboxOffset head = {size.x - headWidth, size.y * 0.1f, static_cast<float>(headWidth), static_cast<float>(headHeight)};
+    set.boxes[0] = head;
     
     // Body collision box (wider and lower when ducking)
-    double bodyWidth = targetSize.x * (BODY_WIDTH_RATIO * 1.3f);
-    double bodyHeight = targetSize.y * (BODY_HEIGHT_RATIO * 0.8f);
-    double bodyOffsetX = (targetSize.x - bodyWidth) / 2.0f;
-    double bodyOffsetY = targetSize.y * 0.3f;
-    
-    bodyCollisionBox.setSize(sf::Vector2f(bodyWidth, bodyHeight));
-    bodyCollisionBox.setPosition(posX + bodyOffsetX, posY + bodyOffsetY);
+    double bodyWidth = size.x * (BODY_WIDTH_RATIO * 1.3f);
+    double bodyHeight = size.y * (BODY_HEIGHT_RATIO * 0.8f);
+    HitboxOffset body = {(size.x - bodyWidth) / 2.0f, size.y * 0.3f,
+                         static_cast<float>(bodyWidth), static_cast<float>(bodyHeight)};
+    set.boxes[1] = body;
     
-    // Tail collision box (more prominent when ducking)
-    double tailWidth = targetSize.x * (TAIL_WIDTH_RATIO * 1.2f);
-    double tailHeight = targetSize.y * (TAIL_HEIGHT_RATIO * 0.9f);
-    double tailOffsetX = targetSize.x;
-    double tailOffsetY = targetSize.y * 0.3f;
+    // Tail collision box (more prominent when ducking), anchored at the player origin
+    double tailWidth = size.x * (TAIL_WIDTH_RATIO * 1.2f);
+    double tailHeight = size.y * (TAIL_HEIGHT_RATIO * 0.9f);
+    HitboxOffset tail = {0.0, 0.0, static_cast<float>(tailWidth), static_cast<float>(tailHeight)};
+    set.boxes[2] = tail;
     
-    tailCollisionBox.setSize(sf::Vector2f(tailWidth, tailHeight));
-    tailCollisionBox.setPosition(posX, posY);
+    return set;
 }
 
-void Player::updateJumpingStateCollision() {
-    // Use normal state collision during jumping
-    updateNormalStateCollision();
+Player::HitboxSet Player::computeFastFallHitboxes() {
+    // Fast fall starts from the jumping boxes at duck size (startDucking resizes first)
+    HitboxSet set = computeNormalHitboxes(DUCKING_SIZE);
+    
+    // Head and body keep their x, lowered slightly
+    set.boxes[0].offsetY = DUCKING_SIZE.y * 0.1;
+    set.boxes[1].offsetY = DUCKING_SIZE.y * 0.1;
+    
+    // Tail keeps its height, narrowed to the standing width and kept at the back
+    set.boxes[2].offsetX = DUCKING_SIZE.x * 0.07;
+    set.boxes[2].offsetY = DUCKING_SIZE.y * 0.02;
+    set.boxes[2].width = static_cast<float>(DEFAULT_SIZE.x * TAIL_WIDTH_RATIO);
+    
+    return set;
 }
-
-void Player::updateLegacyBoundingBox() {
-    // Legacy bounding box follows body collision box for compatibility
-    boundingBox.setSize(bodyCollisionBox.getSize());
-    boundingBox.setPosition(bodyCollisionBox.getPosition());
-}
\ No newline at end of file
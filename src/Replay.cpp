@@ -0,0 +1,217 @@
+#include "Replay.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+// ===== Static Member Definitions =====
+
+const uint32_t Replay::FORMAT_VERSION;
+const uint32_t Replay::FLAG_AUTOPILOT;
+const uint32_t Replay::FLAG_PIXEL_COLLISION;
+const int Replay::INPUT_BITS;
+const char Replay::MAGIC[8] = {'D', 'I', 'N', 'O', 'R', 'E', 'P', '\0'};
+
+static_assert(sizeof(Replay::Header) == 40, "Replay header layout must not change");
+static_assert(static_cast<int>(Replay::Input::COUNT) <= (1 << Replay::INPUT_BITS),
+              "Inputs must fit the low bits of an event");
+
+static const size_t EXPECTED_EVENTS = 1024;     // Recording reserve: a few minutes of play
+
+// ===== Varint Helpers =====
+
+/**
+ * Append a value as LEB128 varint (7 bits per byte, high bit = more bytes follow)
+ */
+static void writeVarint(std::vector<unsigned char>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<unsigned char>(value));
+}
+
+/**
+ * Read a varint; returns false on truncated or overlong input
+ */
+static bool readVarint(const std::vector<unsigned char>& in, size_t& position, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (position >= in.size()) {
+            return false;
+        }
+        unsigned char byte = in[position++];
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ===== Core Methods =====
+
+Replay::Replay()
+    : cursor(0) {
+    std::memset(&header, 0, sizeof(header));
+}
+
+// ===== Recording =====
+
+void Replay::beginRecording(uint32_t seed, double tickRate, bool autopilot, bool pixelCollision) {
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+    header.version = FORMAT_VERSION;
+    header.flags = (autopilot ? FLAG_AUTOPILOT : 0) | (pixelCollision ? FLAG_PIXEL_COLLISION : 0);
+    header.seed = seed;
+    header.tickRate = tickRate;
+
+    events.clear();
+    events.reserve(EXPECTED_EVENTS);
+    cursor = 0;
+}
+
+void Replay::record(uint64_t tick, Input input) {
+    Event event;
+    event.tick = tick;
+    event.input = input;
+    events.push_back(event);
+}
+
+bool Replay::save(const std::string& path, uint64_t tickCount) {
+    header.tickCount = tickCount;
+    header.eventCount = static_cast<uint32_t>(events.size());
+
+    // Delta-encode ticks: inputs are rarely more than a handful of ticks apart
+    std::vector<unsigned char> encoded;
+    encoded.reserve(events.size() * 2);
+    uint64_t previousTick = 0;
+    for (const Event& event : events) {
+        uint64_t delta = event.tick - previousTick;
+        writeVarint(encoded, (delta << INPUT_BITS) | static_cast<uint64_t>(event.input));
+        previousTick = event.tick;
+    }
+
+    std::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out) {
+        DINO_LOG_ERROR(GAME, "Could not write replay {}", path);
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(encoded.data()), static_cast<std::streamsize>(encoded.size()));
+    if (!out) {
+        DINO_LOG_ERROR(GAME, "Write to replay {} failed", path);
+        return false;
+    }
+
+    DINO_LOG_INFO(GAME, "Replay saved to {}: {} events over {} ticks ({} bytes)",
+                  path, events.size(), tickCount, sizeof(header) + encoded.size());
+    return true;
+}
+
+// ===== Playback =====
+
+bool Replay::load(const std::string& path) {
+    std::ifstream in(path.c_str(), std::ios::binary);
+    if (!in) {
+        DINO_LOG_ERROR(GAME, "Could not open replay {}", path);
+        return false;
+    }
+
+    Header loaded;
+    if (!in.read(reinterpret_cast<char*>(&loaded), sizeof(loaded)) ||
+        std::memcmp(loaded.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        loaded.version != FORMAT_VERSION || !(loaded.tickRate > 0.0)) {
+        DINO_LOG_ERROR(GAME, "Replay {} is corrupt or from another version", path);
+        return false;
+    }
+
+    std::vector<unsigned char> encoded((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    // Every event takes at least one byte: a larger count cannot be true (and must not size the reserve)
+    if (loaded.eventCount > encoded.size()) {
+        DINO_LOG_ERROR(GAME, "Replay {} claims {} events in {} bytes", path, loaded.eventCount, encoded.size());
+        return false;
+    }
+
+    std::vector<Event> decoded;
+    decoded.reserve(loaded.eventCount);
+    size_t position = 0;
+    uint64_t tick = 0;
+    for (uint32_t i = 0; i < loaded.eventCount; ++i) {
+        uint64_t value = 0;
+        if (!readVarint(encoded, position, value)) {
+            DINO_LOG_ERROR(GAME, "Replay {} is truncated at event {}", path, i);
+            return false;
+        }
+        uint64_t input = value & ((1u << INPUT_BITS) - 1);
+        if (input >= static_cast<uint64_t>(Input::COUNT)) {
+            DINO_LOG_ERROR(GAME, "Replay {} has unknown input {} at event {}", path, input, i);
+            return false;
+        }
+        tick += value >> INPUT_BITS;
+
+        Event event;
+        event.tick = tick;
+        event.input = static_cast<Input>(input);
+        decoded.push_back(event);
+    }
+
+    header = loaded;
+    events.swap(decoded);
+    cursor = 0;
+
+    DINO_LOG_INFO(GAME, "Loaded replay {}: seed {}, {} events over {} ticks",
+                  path, header.seed, events.size(), header.tickCount);
+    return true;
+}
+
+bool Replay::nextInput(uint64_t tick, Input& input) {
+    if (cursor >= events.size() || events[cursor].tick > tick) {
+        return false;
+    }
+    input = events[cursor++].input;
+    return true;
+}
+
+bool Replay::isFinished(uint64_t tick) const {
+    // Events recorded after the last tick never took effect, so only the tick count matters
+    return tick >= header.tickCount;
+}
+
+void Replay::rewind() {
+    cursor = 0;
+}
+
+void Replay::seek(uint64_t tick) {
+    // Events are sorted by tick: the first one not yet applied at that tick
+    cursor = std::lower_bound(events.begin(), events.end(), tick,
+                              [](const Event& event, uint64_t value) { return event.tick < value; }) - events.begin();
+}
+
+// ===== Header Access =====
+
+uint32_t Replay::getSeed() const {
+    return header.seed;
+}
+
+double Replay::getTickRate() const {
+    return header.tickRate;
+}
+
+bool Replay::isAutopilot() const {
+    return (header.flags & FLAG_AUTOPILOT) != 0;
+}
+
+bool Replay::isPixelCollision() const {
+    return (header.flags & FLAG_PIXEL_COLLISION) != 0;
+}
+
+uint64_t Replay::getTickCount() const {
+    return header.tickCount;
+}
+
+size_t Replay::getEventCount() const {
+    return events.size();
+}
@@ -0,0 +1,106 @@
+#include "ResourceLoader.hpp"
+#include "Logger.hpp"
+#include <chrono>
+#include <exception>
+
+// ===== Core Methods =====
+
+ResourceLoader::ResourceLoader()
+    : requiredCount(0),
+      requiredFinished(0),
+      finishedCount(0),
+      failedCount(0) {
+}
+
+ResourceLoader::~ResourceLoader() {
+    // Load steps may still reference their owner: wait for them before it goes away
+    for (Task& task : tasks) {
+        if (task.result.valid()) {
+            task.result.wait();
+        }
+    }
+}
+
+void ResourceLoader::add(const std::string& name, Priority priority, LoadStep load, FinishStep finish) {
+    Task task;
+    task.name = name;
+    task.priority = priority;
+    task.result = std::async(std::launch::async, load);
+    task.finish = finish;
+    task.finished = false;
+    tasks.push_back(std::move(task));
+
+    if (priority == Priority::REQUIRED) {
+        requiredCount++;
+    }
+}
+
+size_t ResourceLoader::poll() {
+    size_t finishedNow = 0;
+
+    // C++14 compatible loop
+    for (Task& task : tasks) {
+        if (task.finished) {
+            continue;
+        }
+        if (task.result.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            finishTask(task);
+            finishedNow++;
+        }
+    }
+    return finishedNow;
+}
+
+void ResourceLoader::waitForRequired() {
+    for (Task& task : tasks) {
+        if (!task.finished && task.priority == Priority::REQUIRED) {
+            task.result.wait();
+            finishTask(task);
+        }
+    }
+}
+
+bool ResourceLoader::isRequiredReady() const {
+    return requiredFinished == requiredCount;
+}
+
+bool ResourceLoader::isComplete() const {
+    return finishedCount == tasks.size();
+}
+
+float ResourceLoader::getRequiredProgress() const {
+    if (requiredCount == 0) {
+        return 1.0f;
+    }
+    return static_cast<float>(requiredFinished) / static_cast<float>(requiredCount);
+}
+
+size_t ResourceLoader::getFailedCount() const {
+    return failedCount;
+}
+
+// ===== Private Helper Methods =====
+
+void ResourceLoader::finishTask(Task& task) {
+    bool loaded = false;
+    try {
+        loaded = task.result.get();
+    } catch (const std::exception& e) {
+        DINO_LOG_ERROR(GAME, "Loading {} threw: {}", task.name, e.what());
+    }
+
+    if (!loaded) {
+        failedCount++;
+        DINO_LOG_WARN(GAME, "Resource {} failed to load", task.name);
+    }
+
+    if (task.finish) {
+        task.finish(loaded);
+    }
+
+    task.finished = true;
+    finishedCount++;
+    if (task.priority == Priority::REQUIRED) {
+        requiredFinished++;
+    }
+}
@@ -0,0 +1,219 @@
+#include "ScoreJournal.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+
+// ===== Static Member Definitions =====
+
+const uint32_t ScoreJournal::FORMAT_VERSION;
+const uint32_t ScoreJournal::FLAG_AUTOPILOT;
+const size_t ScoreJournal::PATTERN_NAME_SIZE;
+const uint64_t ScoreJournal::COMPACT_THRESHOLD_BYTES;
+const uint64_t ScoreJournal::COMPACT_KEEP_RECORDS;
+const char ScoreJournal::MAGIC[8] = {'D', 'I', 'N', 'O', 'J', 'R', 'N', '\0'};
+const std::string ScoreJournal::DEFAULT_PATH = "scores.journal";
+
+static_assert(sizeof(ScoreJournal::Header) == 64, "journal header layout changed");
+static_assert(sizeof(ScoreJournal::Record) == 64, "journal record layout changed");
+
+// ===== Core Methods =====
+
+ScoreJournal::ScoreJournal() : opened(false), stopping(false) {
+    std::memset(&summary, 0, sizeof(summary));
+    std::memset(&fileHeader, 0, sizeof(fileHeader));
+}
+
+ScoreJournal::~ScoreJournal() {
+    if (!writerThread.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+    }
+    queueReady.notify_one();
+    writerThread.join();
+}
+
+bool ScoreJournal::open(const std::string& journalPath) {
+    if (opened) return true;
+    path = journalPath;
+
+    Header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+    header.version = FORMAT_VERSION;
+    header.recordSize = sizeof(Record);
+
+    std::ifstream in(path.c_str(), std::ios::binary);
+    if (in) {
+        Header loaded;
+        if (!in.read(reinterpret_cast<char*>(&loaded), sizeof(loaded)) ||
+            std::memcmp(loaded.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+            loaded.version != FORMAT_VERSION || loaded.recordSize != sizeof(Record)) {
+            DINO_LOG_WARN(GAME, "Score journal {} has an unknown format, runs are not journaled", path);
+            return false;
+        }
+        header = loaded;
+
+        // Records written after the last header update (crash between the two writes)
+        in.seekg(0, std::ios::end);
+        uint64_t fileRecords = (static_cast<uint64_t>(in.tellg()) - sizeof(Header)) / sizeof(Record);
+        if (fileRecords > header.recordCount) {
+            in.seekg(static_cast<std::streamoff>(sizeof(Header) + header.recordCount * sizeof(Record)));
+            Record record;
+            while (header.recordCount < fileRecords && in.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+                addToSummary(header.summary, record);
+                header.recordCount++;
+            }
+            DINO_LOG_INFO(GAME, "Score journal recovered {} unsummarized runs", fileRecords - loaded.recordCount);
+        }
+    }
+
+    summary = header.summary;
+    fileHeader = header;
+    opened = true;
+    writerThread = std::thread(&ScoreJournal::writerLoop, this);
+    return true;
+}
+
+void ScoreJournal::append(const Record& record) {
+    if (!opened) return;
+
+    addToSummary(summary, record);
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        pending.push_back(record);
+    }
+    queueReady.notify_one();
+}
+
+const ScoreJournal::Summary& ScoreJournal::getSummary() const {
+    return summary;
+}
+
+bool ScoreJournal::isOpen() const {
+    return opened;
+}
+
+ScoreJournal::Record ScoreJournal::makeRecord(int score, double durationSeconds, double peakSpeed,
+                                              const std::string& deathPattern, uint32_t seed, bool autopilot) {
+    Record record;
+    std::memset(&record, 0, sizeof(record));
+    record.endedAt = static_cast<int64_t>(std::time(nullptr));
+    record.seed = seed;
+    record.score = score;
+    record.durationSeconds = static_cast<float>(durationSeconds);
+    record.peakSpeed = static_cast<float>(peakSpeed);
+    record.flags = autopilot ? FLAG_AUTOPILOT : 0;
+    std::strncpy(record.deathPattern, deathPattern.c_str(), PATTERN_NAME_SIZE - 1);  // Stays null terminated
+    return record;
+}
+
+// ===== Writer Thread =====
+
+void ScoreJournal::writerLoop() {
+    std::vector<Record> batch;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueReady.wait(lock, [this] { return stopping || !pending.empty(); });
+            if (pending.empty()) {
+                return;  // Stopping and everything written
+            }
+            batch.swap(pending);
+        }
+
+        writeRecords(batch);
+        batch.clear();
+
+        if (sizeof(Header) + fileHeader.recordCount * sizeof(Record) > COMPACT_THRESHOLD_BYTES) {
+            compact();
+        }
+    }
+}
+
+bool ScoreJournal::writeRecords(const std::vector<Record>& records) {
+    std::fstream file(path.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+    if (!file) {
+        // First run: create the file
+        file.clear();
+        file.open(path.c_str(), std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
+        if (!file) {
+            DINO_LOG_ERROR(GAME, "Could not write score journal {}", path);
+            return false;
+        }
+        fileHeader.recordCount = 0;
+    }
+
+    // Append after the last summarized record (overwrites a torn record from a crash)
+    file.seekp(static_cast<std::streamoff>(sizeof(Header) + fileHeader.recordCount * sizeof(Record)));
+    file.write(reinterpret_cast<const char*>(records.data()),
+               static_cast<std::streamsize>(records.size() * sizeof(Record)));
+
+    // Header last: a crash before this point leaves records that open() recovers
+    Header updated = fileHeader;
+    updated.recordCount += records.size();
+    for (const Record& record : records) {
+        addToSummary(updated.summary, record);
+    }
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&updated), sizeof(updated));
+    file.flush();
+    if (!file) {
+        DINO_LOG_ERROR(GAME, "Could not write score journal {}", path);
+        return false;
+    }
+
+    fileHeader = updated;
+    return true;
+}
+
+bool ScoreJournal::compact() {
+    uint64_t keep = std::min(fileHeader.recordCount, COMPACT_KEEP_RECORDS);
+    std::vector<Record> newest(static_cast<size_t>(keep));
+
+    std::ifstream in(path.c_str(), std::ios::binary);
+    in.seekg(static_cast<std::streamoff>(sizeof(Header) + (fileHeader.recordCount - keep) * sizeof(Record)));
+    if (!in.read(reinterpret_cast<char*>(newest.data()), static_cast<std::streamsize>(keep * sizeof(Record)))) {
+        DINO_LOG_WARN(GAME, "Score journal compaction could not read {}", path);
+        return false;
+    }
+    in.close();
+
+    // Same header (summary covers every run), fewer records; swapped in by rename
+    Header compacted = fileHeader;
+    compacted.recordCount = keep;
+    std::string tempPath = path + ".tmp";
+    {
+        std::ofstream out(tempPath.c_str(), std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&compacted), sizeof(compacted));
+        out.write(reinterpret_cast<const char*>(newest.data()), static_cast<std::streamsize>(keep * sizeof(Record)));
+        if (!out) {
+            DINO_LOG_WARN(GAME, "Score journal compaction could not write {}", tempPath);
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+
+    // rename() does not replace an existing file on every platform
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0 &&
+        (std::remove(path.c_str()) != 0 || std::rename(tempPath.c_str(), path.c_str()) != 0)) {
+        DINO_LOG_WARN(GAME, "Score journal compaction could not replace {}", path);
+        return false;
+    }
+
+    DINO_LOG_INFO(GAME, "Score journal compacted from {} to {} records", fileHeader.recordCount, keep);
+    fileHeader = compacted;
+    return true;
+}
+
+// ===== Private Helper Methods =====
+
+void ScoreJournal::addToSummary(Summary& target, const Record& record) {
+    target.totalRuns++;
+    target.totalSeconds += record.durationSeconds;
+    target.highScore = std::max(target.highScore, record.score);
+    target.peakSpeed = std::max(target.peakSpeed, record.peakSpeed);
+}
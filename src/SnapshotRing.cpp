@@ -0,0 +1,62 @@
+#include "SnapshotRing.hpp"
+
+// ===== Core Methods =====
+
+SnapshotRing::SnapshotRing(size_t slotCount)
+    : slots(new SimulationSnapshot[slotCount]),
+      capacity(slotCount),
+      head(0),
+      count(0) {
+}
+
+SimulationSnapshot& SnapshotRing::push() {
+    if (count == capacity) {
+        SimulationSnapshot& recycled = slots[head];
+        head = (head + 1) % capacity;
+        return recycled;
+    }
+    return slots[(head + count++) % capacity];
+}
+
+const SimulationSnapshot* SnapshotRing::fromNewest(size_t back) const {
+    if (back >= count) {
+        return nullptr;
+    }
+    return &at(count - 1 - back);
+}
+
+const SimulationSnapshot* SnapshotRing::findAtOrBefore(long long tick) const {
+    // Ticks grow with the index: binary search for the last one <= tick
+    size_t low = 0;
+    size_t high = count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (at(middle).tick <= tick) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low == 0 ? nullptr : &at(low - 1);
+}
+
+void SnapshotRing::dropAfter(long long tick) {
+    while (count > 0 && at(count - 1).tick > tick) {
+        count--;
+    }
+}
+
+void SnapshotRing::clear() {
+    head = 0;
+    count = 0;
+}
+
+// ===== Access =====
+
+size_t SnapshotRing::size() const {
+    return count;
+}
+
+size_t SnapshotRing::getCapacity() const {
+    return capacity;
+}
@@ -0,0 +1,101 @@
+#include "SpriteBatch.hpp"
+#include <cstdlib>  // for std::abs
+
+SpriteBatch::SpriteBatch()
+    : vertices(sf::Triangles),
+      texture(nullptr),
+      spriteCount(0) {
+}
+
+void SpriteBatch::clear() {
+    // sf::VertexArray::clear keeps its storage, so steady-state frames don't allocate
+    vertices.clear();
+    texture = nullptr;
+    spriteCount = 0;
+}
+
+bool SpriteBatch::add(const sf::Sprite& sprite) {
+    if (!acceptTexture(sprite.getTexture())) {
+        return false;
+    }
+    
+    // Transform the four local corners exactly like sf::Sprite::draw would
+    const sf::IntRect& rect = sprite.getTextureRect();
+    float width = static_cast<float>(std::abs(rect.width));
+    float height = static_cast<float>(std::abs(rect.height));
+    const sf::Transform& transform = sprite.getTransform();
+    
+    sf::Vector2f corners[4] = {
+        transform.transformPoint(0.0f, 0.0f),
+        transform.transformPoint(width, 0.0f),
+        transform.transformPoint(width, height),
+        transform.transformPoint(0.0f, height)
+    };
+    
+    appendQuad(corners, sf::FloatRect(rect), sprite.getColor());
+    return true;
+}
+
+bool SpriteBatch::add(const sf::Texture* sheet, const sf::IntRect& textureRect,
+                      const sf::Vector2f& position, const sf::Vector2f& size,
+                      const sf::Color& color) {
+    if (!acceptTexture(sheet)) {
+        return false;
+    }
+    
+    sf::Vector2f corners[4] = {
+        position,
+        sf::Vector2f(position.x + size.x, position.y),
+        sf::Vector2f(position.x + size.x, position.y + size.y),
+        sf::Vector2f(position.x, position.y + size.y)
+    };
+    
+    appendQuad(corners, sf::FloatRect(textureRect), color);
+    return true;
+}
+
+void SpriteBatch::draw(sf::RenderTarget& target) const {
+    if (spriteCount == 0) return;
+    
+    sf::RenderStates states;
+    states.texture = texture;
+    target.draw(vertices, states);  // The single draw call for the whole sheet
+}
+
+size_t SpriteBatch::getSpriteCount() const {
+    return spriteCount;
+}
+
+// ===== Private Helper Methods =====
+
+bool SpriteBatch::acceptTexture(const sf::Texture* sheet) {
+    if (!sheet) {
+        return false;  // Nothing to draw (e.g. textures not loaded)
+    }
+    if (!texture) {
+        texture = sheet;  // First sprite decides the batch texture
+    }
+    return sheet == texture;
+}
+
+void SpriteBatch::appendQuad(const sf::Vector2f corners[4], const sf::FloatRect& texCoords, const sf::Color& color) {
+    float left = texCoords.left;
+    float top = texCoords.top;
+    float right = texCoords.left + texCoords.width;
+    float bottom = texCoords.top + texCoords.height;
+    
+    sf::Vertex topLeft(corners[0], color, sf::Vector2f(left, top));
+    sf::Vertex topRight(corners[1], color, sf::Vector2f(right, top));
+    sf::Vertex bottomRight(corners[2], color, sf::Vector2f(right, bottom));
+    sf::Vertex bottomLeft(corners[3], color, sf::Vector2f(left, bottom));
+    
+    // Two triangles per quad (sf::Quads is not available on every backend)
+    vertices.append(topLeft);
+    vertices.append(topRight);
+    vertices.append(bottomRight);
+    vertices.append(topLeft);
+    vertices.append(bottomRight);
+    vertices.append(bottomLeft);
+    
+    ++spriteCount;
+}
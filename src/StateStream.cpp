@@ -0,0 +1,545 @@
+#include "StateStream.hpp"
+#include "Logger.hpp"
+#include "ObstacleManager.hpp"
+#include "Player.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+// ===== Static Member Definitions =====
+
+const uint32_t StateStream::FORMAT_VERSION;
+const uint32_t StateStream::KEYFRAME_INTERVAL;
+const int StateStream::POSITION_Y_SCALE;
+const int StateStream::POSITION_X_SCALE;
+const int StateStream::SPEED_SCALE;
+const float StateStream::MAX_DRIFT = 0.5f;
+const uint8_t StateStream::BIT_PLAYER_Y;
+const uint8_t StateStream::BIT_FLAGS;
+const uint8_t StateStream::BIT_SPEED;
+const uint8_t StateStream::BIT_SPAWN;
+const uint8_t StateStream::BIT_RETIRE;
+const uint8_t StateStream::BIT_HOLD;
+const uint8_t StateStream::BIT_KEYFRAME;
+const uint8_t StateStream::FLAG_SPRITE_MASK;
+const uint8_t StateStream::FLAG_SMALL;
+const uint8_t StateStream::FLAG_GAME_OVER;
+const char StateStream::MAGIC[8] = {'D', 'I', 'N', 'O', 'S', 'T', 'R', '\0'};
+
+static_assert(sizeof(StateStream::Header) == 40, "State stream header layout must not change");
+static_assert(TextureManager::SPRITE_TYPE_COUNT <= StateStream::FLAG_SPRITE_MASK + 1,
+              "Sprite types must fit the low bits of the player flags");
+
+static const float MATCH_DISTANCE = 1.0f;       // Obstacles closer than this (px) are the same obstacle
+static const size_t EXPECTED_BYTES = 64 * 1024; // Encoding reserve: several minutes of play
+static const size_t EXPECTED_OBSTACLES = 32;    // Obstacle reserve of the mirrored worlds
+
+// ===== Varint Helpers =====
+
+/**
+ * Append a value as LEB128 varint (7 bits per byte, high bit = more bytes follow)
+ */
+static void writeVarint(std::vector<uint8_t>& out, uint32_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+/**
+ * Append a signed value zigzag-mapped (small magnitudes stay one byte)
+ */
+static void writeSigned(std::vector<uint8_t>& out, int32_t value) {
+    writeVarint(out, (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31));
+}
+
+/**
+ * Read a varint; returns false on truncated or overlong input
+ */
+static bool readVarint(const std::vector<uint8_t>& in, size_t& position, uint32_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        if (position >= in.size()) {
+            return false;
+        }
+        uint8_t byte = in[position++];
+        value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool readSigned(const std::vector<uint8_t>& in, size_t& position, int32_t& value) {
+    uint32_t raw = 0;
+    if (!readVarint(in, position, raw)) {
+        return false;
+    }
+    value = static_cast<int32_t>((raw >> 1) ^ (0u - (raw & 1u)));
+    return true;
+}
+
+static int32_t quantize(double value, int scale) {
+    return static_cast<int32_t>(std::lround(value * scale));
+}
+
+// ===== Core Methods =====
+
+StateStream::StateStream()
+    : tickDuration(0.0), playerYSteps(0), speedSteps(0), synced(false), ticksSinceKeyframe(0),
+      lastKeyframeOffset(0), cursor(0), tickCount(0), keyframeCount(0) {
+    std::memset(&header, 0, sizeof(header));
+}
+
+// ===== Encoding =====
+
+void StateStream::beginEncoding(double tickRate) {
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+    header.version = FORMAT_VERSION;
+    header.keyframeInterval = KEYFRAME_INTERVAL;
+    header.tickRate = tickRate;
+    tickDuration = 1.0 / tickRate;
+
+    bytes.clear();
+    bytes.reserve(EXPECTED_BYTES);
+    keyframeIndex.clear();
+    rewind();
+    state.obstacles.reserve(EXPECTED_OBSTACLES);
+    backup.obstacles.reserve(EXPECTED_OBSTACLES);
+    observed.obstacles.reserve(EXPECTED_OBSTACLES);
+    spawnScratch.reserve(EXPECTED_OBSTACLES);
+    keyframeScratch.reserve(EXPECTED_OBSTACLES);
+}
+
+void StateStream::encodeTick(const Player& player, const ObstacleManager& obstacleManager,
+                             bool gameOver, bool worldMoved) {
+    State& target = observed;
+    int32_t targetYSteps = quantize(player.getPosY(), POSITION_Y_SCALE);
+    int32_t targetSpeedSteps = quantize(obstacleManager.getCurrentSpeed(), SPEED_SCALE);
+
+    target.tick = tickCount;
+    target.playerX = static_cast<float>(player.getPosX());
+    target.playerY = static_cast<float>(targetYSteps) / POSITION_Y_SCALE;
+    target.speed = static_cast<float>(targetSpeedSteps) / SPEED_SCALE;
+    target.flags = static_cast<uint8_t>(static_cast<int>(player.getSpriteType()) & FLAG_SPRITE_MASK);
+    if (player.getSize() != Player::getDefaultSize()) target.flags |= FLAG_SMALL;
+    if (gameOver) target.flags |= FLAG_GAME_OVER;
+
+    const ObstacleManager::ObstacleArrays& obstacles = obstacleManager.getObstacleData();
+    target.obstacles.resize(obstacles.size());
+    for (size_t i = 0; i < obstacles.size(); ++i) {
+        size_t slot = obstacles.slot(i);
+        target.obstacles[i].type = obstacles.type[slot];
+        target.obstacles[i].x = obstacles.posX[slot];
+        target.obstacles[i].y = static_cast<float>(quantize(obstacles.posY[slot], POSITION_Y_SCALE)) / POSITION_Y_SCALE;
+    }
+
+    ++tickCount;
+    if (!synced || ticksSinceKeyframe + 1 >= KEYFRAME_INTERVAL) {
+        writeKeyframe(target, targetYSteps, targetSpeedSteps);
+        return;
+    }
+
+    uint8_t bits = 0;
+    if (targetYSteps != playerYSteps) bits |= BIT_PLAYER_Y;
+    if (target.flags != state.flags) bits |= BIT_FLAGS;
+    if (targetSpeedSteps != speedSteps) bits |= BIT_SPEED;
+    if (!worldMoved) bits |= BIT_HOLD;
+
+    // Where the mirrored obstacles end up after this tick's motion
+    float travel = worldMoved ? tickTravel(targetSpeedSteps) : 0.0f;
+
+    // Obstacles retire from the left and spawn on the right: find how many mirrored
+    // obstacles are gone so that the survivors line up with the front of the real list
+    const std::vector<ObstacleState>& mirrored = state.obstacles;
+    size_t retires = mirrored.size();
+    for (size_t skip = 0; skip < mirrored.size(); ++skip) {
+        size_t survivors = mirrored.size() - skip;
+        if (survivors > target.obstacles.size()) continue;
+
+        bool aligned = true;
+        for (size_t j = 0; j < survivors && aligned; ++j) {
+            const ObstacleState& predicted = mirrored[skip + j];
+            const ObstacleState& actual = target.obstacles[j];
+            aligned = predicted.type == actual.type && std::fabs(predicted.x - travel - actual.x) < MATCH_DISTANCE;
+        }
+        if (aligned) {
+            retires = skip;
+            break;
+        }
+    }
+    size_t survivors = mirrored.size() - retires;
+
+    std::vector<ObstacleState>& spawns = spawnScratch;
+    spawns.clear();
+    for (size_t i = survivors; i < target.obstacles.size(); ++i) {
+        ObstacleState spawn = target.obstacles[i];
+        spawn.x = static_cast<float>(quantize(spawn.x, POSITION_X_SCALE)) / POSITION_X_SCALE;
+        spawns.push_back(spawn);
+    }
+    if (!spawns.empty()) bits |= BIT_SPAWN;
+    if (retires > 0) bits |= BIT_RETIRE;
+
+    // Run the decoder's step on the mirror; fall back to a keyframe if it would drift
+    backup = state;
+    int32_t backupYSteps = playerYSteps;
+    int32_t backupSpeedSteps = speedSteps;
+    applyDelta(bits, targetYSteps - playerYSteps, target.flags, targetSpeedSteps - speedSteps,
+               spawns, static_cast<uint32_t>(retires));
+    if (!mirrorMatches(target)) {
+        state = backup;
+        playerYSteps = backupYSteps;
+        speedSteps = backupSpeedSteps;
+        writeKeyframe(target, targetYSteps, targetSpeedSteps);
+        return;
+    }
+
+    bytes.push_back(bits);
+    if (bits & BIT_PLAYER_Y) writeSigned(bytes, targetYSteps - backupYSteps);
+    if (bits & BIT_FLAGS) bytes.push_back(target.flags);
+    if (bits & BIT_SPEED) writeSigned(bytes, targetSpeedSteps - backupSpeedSteps);
+    if (bits & BIT_SPAWN) {
+        writeVarint(bytes, static_cast<uint32_t>(spawns.size()));
+        for (const ObstacleState& spawn : spawns) {
+            bytes.push_back(static_cast<uint8_t>(spawn.type));
+            writeSigned(bytes, quantize(spawn.x, POSITION_X_SCALE));
+            writeSigned(bytes, quantize(spawn.y, POSITION_Y_SCALE));
+        }
+    }
+    if (bits & BIT_RETIRE) writeVarint(bytes, static_cast<uint32_t>(retires));
+    ++ticksSinceKeyframe;
+}
+
+bool StateStream::save(const std::string& path) {
+    header.tickCount = tickCount;
+    header.byteCount = bytes.size();
+
+    std::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out) {
+        DINO_LOG_ERROR(GAME, "Could not write state stream {}", path);
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!out) {
+        DINO_LOG_ERROR(GAME, "Write to state stream {} failed", path);
+        return false;
+    }
+
+    DINO_LOG_INFO(GAME, "State stream saved to {}: {} ticks in {} bytes, {} keyframes",
+                  path, tickCount, sizeof(header) + bytes.size(), keyframeCount);
+    return true;
+}
+
+// ===== Decoding =====
+
+bool StateStream::load(const std::string& path) {
+    std::ifstream in(path.c_str(), std::ios::binary);
+    if (!in) {
+        DINO_LOG_ERROR(GAME, "Could not open state stream {}", path);
+        return false;
+    }
+
+    Header loaded;
+    if (!in.read(reinterpret_cast<char*>(&loaded), sizeof(loaded)) ||
+        std::memcmp(loaded.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        loaded.version != FORMAT_VERSION || !(loaded.tickRate > 0.0)) {
+        DINO_LOG_ERROR(GAME, "State stream {} is corrupt or from another version", path);
+        return false;
+    }
+
+    std::vector<uint8_t> loadedBytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (loadedBytes.size() < loaded.byteCount) {
+        DINO_LOG_WARN(GAME, "State stream {} is truncated ({} of {} bytes), playing what is there",
+                         path, loadedBytes.size(), loaded.byteCount);
+    }
+    loadedBytes.resize(std::min<uint64_t>(loadedBytes.size(), loaded.byteCount));
+
+    header = loaded;
+    tickDuration = 1.0 / loaded.tickRate;
+    bytes.swap(loadedBytes);
+
+    // One pass over the stream indexes its keyframes for seek()
+    keyframeIndex.clear();
+    rewind();
+    while (decodeTick()) {
+    }
+    rewind();
+    return true;
+}
+
+void StateStream::appendBytes(const uint8_t* data, size_t size) {
+    bytes.insert(bytes.end(), data, data + size);
+}
+
+bool StateStream::decodeTick() {
+    // Deltas before the first keyframe have nothing to apply to and are skipped
+    while (cursor < bytes.size()) {
+        if (!readTick()) {
+            return false;
+        }
+        if (synced) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool StateStream::seek(uint64_t ticks) {
+    // Newest keyframe whose tick is within the target
+    const KeyframeEntry* keyframe = nullptr;
+    for (const KeyframeEntry& entry : keyframeIndex) {
+        if (entry.ticksBefore >= ticks) break;
+        keyframe = &entry;
+    }
+
+    // Going back, or a keyframe is closer than the current tick: restart there
+    if (ticks < tickCount || (keyframe && keyframe->ticksBefore > tickCount)) {
+        size_t offset = keyframe ? keyframe->offset : 0;
+        uint64_t ticksBefore = keyframe ? keyframe->ticksBefore : 0;
+        rewind();
+        cursor = offset;
+        tickCount = ticksBefore;
+    }
+
+    while (tickCount < ticks) {
+        if (cursor >= bytes.size() || !readTick()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void StateStream::rewind() {
+    std::vector<ObstacleState> obstacles;
+    obstacles.swap(state.obstacles);
+    obstacles.clear();
+    state = State();
+    state.obstacles.swap(obstacles);  // Keeps its capacity
+    playerYSteps = 0;
+    speedSteps = 0;
+    synced = false;
+    ticksSinceKeyframe = 0;
+    lastKeyframeOffset = 0;
+    cursor = 0;
+    tickCount = 0;
+    keyframeCount = 0;
+}
+
+// ===== Access =====
+
+const StateStream::State& StateStream::getState() const {
+    return state;
+}
+
+const std::vector<uint8_t>& StateStream::getBytes() const {
+    return bytes;
+}
+
+size_t StateStream::getLastKeyframeOffset() const {
+    return lastKeyframeOffset;
+}
+
+double StateStream::getTickRate() const {
+    return header.tickRate;
+}
+
+uint64_t StateStream::getTickCount() const {
+    return tickCount;
+}
+
+uint64_t StateStream::getKeyframeCount() const {
+    return keyframeCount;
+}
+
+// ===== Private Helper Methods =====
+
+void StateStream::applyDelta(uint8_t bits, int32_t playerYDelta, uint8_t flags, int32_t speedDelta,
+                             const std::vector<ObstacleState>& spawns, uint32_t retires) {
+    state.tick++;
+    state.previousPlayerY = state.playerY;
+    playerYSteps += playerYDelta;
+    state.playerY = static_cast<float>(playerYSteps) / POSITION_Y_SCALE;
+    if (bits & BIT_FLAGS) state.flags = flags;
+    speedSteps += speedDelta;
+    state.speed = static_cast<float>(speedSteps) / SPEED_SCALE;
+
+    std::vector<ObstacleState>& obstacles = state.obstacles;
+    if (!(bits & BIT_HOLD)) {
+        float travel = tickTravel(speedSteps);
+        for (ObstacleState& obstacle : obstacles) {
+            obstacle.x -= travel;
+        }
+    }
+
+    // Same order as ObstacleManager: spawns keep the list sorted, retires leave from the front
+    for (const ObstacleState& spawn : spawns) {
+        std::vector<ObstacleState>::iterator position = obstacles.end();
+        while (position != obstacles.begin() && (position - 1)->x > spawn.x) {
+            --position;
+        }
+        obstacles.insert(position, spawn);
+    }
+    size_t retired = std::min<size_t>(retires, obstacles.size());
+    obstacles.erase(obstacles.begin(), obstacles.begin() + static_cast<std::ptrdiff_t>(retired));
+}
+
+void StateStream::writeKeyframe(const State& target, int32_t targetYSteps, int32_t targetSpeedSteps) {
+    lastKeyframeOffset = bytes.size();
+    bytes.push_back(BIT_KEYFRAME);
+    writeVarint(bytes, static_cast<uint32_t>(target.tick));
+    writeSigned(bytes, quantize(target.playerX, POSITION_X_SCALE));
+    writeSigned(bytes, targetYSteps);
+    bytes.push_back(target.flags);
+    writeSigned(bytes, targetSpeedSteps);
+    writeVarint(bytes, static_cast<uint32_t>(target.obstacles.size()));
+    for (const ObstacleState& obstacle : target.obstacles) {
+        bytes.push_back(static_cast<uint8_t>(obstacle.type));
+        writeSigned(bytes, quantize(obstacle.x, POSITION_X_SCALE));
+        writeSigned(bytes, quantize(obstacle.y, POSITION_Y_SCALE));
+    }
+
+    // Mirror what the decoder reads back, not the unquantized target
+    size_t position = lastKeyframeOffset + 1;
+    readKeyframe(position);
+    synced = true;
+    ticksSinceKeyframe = 0;
+}
+
+bool StateStream::readTick() {
+    size_t position = cursor;
+    uint8_t bits = bytes[position++];
+
+    if (bits & BIT_KEYFRAME) {
+        size_t keyframeOffset = cursor;
+        if (!readKeyframe(position)) return false;
+        lastKeyframeOffset = keyframeOffset;
+        if (keyframeIndex.empty() || keyframeIndex.back().offset < keyframeOffset) {
+            KeyframeEntry entry;
+            entry.ticksBefore = tickCount;
+            entry.offset = keyframeOffset;
+            keyframeIndex.push_back(entry);  // New keyframes only (load() indexes a file up front)
+        }
+        synced = true;
+        cursor = position;
+        ++tickCount;
+        return true;
+    }
+
+    int32_t playerYDelta = 0;
+    uint32_t flags = 0;
+    int32_t speedDelta = 0;
+    uint32_t spawnCount = 0;
+    uint32_t retires = 0;
+    std::vector<ObstacleState>& spawns = spawnScratch;
+    spawns.clear();
+
+    if ((bits & BIT_PLAYER_Y) && !readSigned(bytes, position, playerYDelta)) return false;
+    if (bits & BIT_FLAGS) {
+        if (position >= bytes.size()) return false;
+        flags = bytes[position++];
+    }
+    if ((bits & BIT_SPEED) && !readSigned(bytes, position, speedDelta)) return false;
+    if (bits & BIT_SPAWN) {
+        if (!readVarint(bytes, position, spawnCount)) return false;
+        for (uint32_t i = 0; i < spawnCount; ++i) {
+            int32_t x = 0;
+            int32_t y = 0;
+            if (position >= bytes.size()) return false;
+            uint8_t type = bytes[position++];
+            if (!readSigned(bytes, position, x) || !readSigned(bytes, position, y)) return false;
+            if (type >= Obstacle::TYPE_COUNT) {
+                DINO_LOG_ERROR(GAME, "State stream has unknown obstacle type {} at byte {}", type, cursor);
+                return false;
+            }
+            ObstacleState spawn;
+            spawn.type = static_cast<Obstacle::ObstacleType>(type);
+            spawn.x = static_cast<float>(x) / POSITION_X_SCALE;
+            spawn.y = static_cast<float>(y) / POSITION_Y_SCALE;
+            spawns.push_back(spawn);
+        }
+    }
+    if ((bits & BIT_RETIRE) && !readVarint(bytes, position, retires)) return false;
+
+    cursor = position;
+    ++tickCount;
+    if (synced) {
+        applyDelta(bits, playerYDelta, static_cast<uint8_t>(flags), speedDelta, spawns, retires);
+    }
+    return true;
+}
+
+bool StateStream::readKeyframe(size_t& position) {
+    uint32_t tick = 0;
+    int32_t playerX = 0;
+    int32_t yStepsRead = 0;
+    int32_t speedStepsRead = 0;
+    uint32_t obstacleCount = 0;
+
+    if (!readVarint(bytes, position, tick) ||
+        !readSigned(bytes, position, playerX) ||
+        !readSigned(bytes, position, yStepsRead) ||
+        position >= bytes.size()) {
+        return false;
+    }
+    uint8_t flags = bytes[position++];
+    if (!readSigned(bytes, position, speedStepsRead) || !readVarint(bytes, position, obstacleCount)) {
+        return false;
+    }
+
+    std::vector<ObstacleState>& obstacles = keyframeScratch;
+    obstacles.clear();
+    for (uint32_t i = 0; i < obstacleCount; ++i) {
+        int32_t x = 0;
+        int32_t y = 0;
+        if (position >= bytes.size()) return false;
+        uint8_t type = bytes[position++];
+        if (!readSigned(bytes, position, x) || !readSigned(bytes, position, y) || type >= Obstacle::TYPE_COUNT) {
+            return false;
+        }
+        ObstacleState obstacle;
+        obstacle.type = static_cast<Obstacle::ObstacleType>(type);
+        obstacle.x = static_cast<float>(x) / POSITION_X_SCALE;
+        obstacle.y = static_cast<float>(y) / POSITION_Y_SCALE;
+        obstacles.push_back(obstacle);
+    }
+
+    // Complete: replace the world
+    float previousY = state.playerY;
+    bool continuous = synced && tick == state.tick + 1;
+    playerYSteps = yStepsRead;
+    speedSteps = speedStepsRead;
+    state.tick = tick;
+    state.playerX = static_cast<float>(playerX) / POSITION_X_SCALE;
+    state.playerY = static_cast<float>(playerYSteps) / POSITION_Y_SCALE;
+    state.previousPlayerY = continuous ? previousY : state.playerY;
+    state.flags = flags;
+    state.speed = static_cast<float>(speedSteps) / SPEED_SCALE;
+    state.obstacles.assign(obstacles.begin(), obstacles.end());
+    ++keyframeCount;
+    return true;
+}
+
+bool StateStream::mirrorMatches(const State& target) const {
+    if (state.obstacles.size() != target.obstacles.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < target.obstacles.size(); ++i) {
+        const ObstacleState& mirrored = state.obstacles[i];
+        const ObstacleState& actual = target.obstacles[i];
+        if (mirrored.type != actual.type || std::fabs(mirrored.x - actual.x) > MAX_DRIFT ||
+            mirrored.y != actual.y) {
+            return false;
+        }
+    }
+    return state.playerY == target.playerY && state.speed == target.speed;
+}
+
+float StateStream::tickTravel(int32_t steps) const {
+    return static_cast<float>(static_cast<double>(steps) / SPEED_SCALE * tickDuration);
+}
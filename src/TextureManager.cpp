@@ -1,9 +1,13 @@
 #include "TextureManager.hpp"
+#include "AssetBundle.hpp"
+#include "AnimationClip.hpp"
 #include <iostream>
+#include <cmath>
 
 // ===== Static Member Definitions =====
 
 std::unique_ptr<TextureManager> TextureManager::instance = nullptr;
+const int TextureManager::SPRITE_TYPE_COUNT;
 
 // Updated sprite file paths for your actual sprite sheets
 const std::unordered_map<TextureManager::SpriteType, std::string> TextureManager::SPRITE_PATHS = {
@@ -20,30 +24,77 @@ const std::unordered_map<TextureManager::SpriteType, std::string> TextureManager
     {SpriteType::CLOUD, "assets/sprites/obstacles_sheet.png"}
 };
 
-// Precise sprite rectangles based on your actual sprite sheets
-const std::unordered_map<TextureManager::SpriteType, sf::IntRect> TextureManager::DEFAULT_SPRITE_RECTS = {
+// Sprite rectangle in a texture (sf::IntRect is not a literal type, so the tables use this)
+struct SpriteRectSpec {
+    int left;
+    int top;
+    int width;
+    int height;
+};
+
+// Precise sprite rectangles based on your actual sprite sheets (indexed by SpriteType)
+static constexpr SpriteRectSpec SHEET_SPRITE_RECTS[TextureManager::SPRITE_TYPE_COUNT] = {
     // Dino sprites - precise coordinates for Chrome Dino sprite sheet
-    {SpriteType::DINO_RUNNING_1, sf::IntRect(298, 58, 80, 86)},
-    {SpriteType::DINO_RUNNING_2, sf::IntRect(394, 58, 80, 86)},
-    {SpriteType::DINO_JUMPING, sf::IntRect(106, 58, 80, 86)},
-    {SpriteType::DINO_DUCKING_1, sf::IntRect(681, 92, 110, 53)},
-    {SpriteType::DINO_DUCKING_2, sf::IntRect(807, 92, 110, 53)},
-    
-    // Birds from obstacles sheet
-    {SpriteType::BIRD_FLYING_1, sf::IntRect(134, 15, 46, 40)},
-    {SpriteType::BIRD_FLYING_2, sf::IntRect(180, 15, 46, 40)},
+    {298, 58, 80, 86},      // DINO_RUNNING_1
+    {394, 58, 80, 86},      // DINO_RUNNING_2
+    {106, 58, 80, 86},      // DINO_JUMPING
+    {681, 92, 110, 53},     // DINO_DUCKING_1
+    {807, 92, 110, 53},     // DINO_DUCKING_2
     
     // Cacti from obstacles sheet
-    {SpriteType::CACTUS_SMALL, sf::IntRect(48, 150, 18, 35)},
-    {SpriteType::CACTUS_MID, sf::IntRect(167, 136, 25, 48)},
-    {SpriteType::CACTUS_LARGE, sf::IntRect(47, 228, 32, 68)},
+    {48, 150, 18, 35},      // CACTUS_SMALL
+    {167, 136, 25, 48},     // CACTUS_MID
+    {47, 228, 32, 68},      // CACTUS_LARGE
+    
+    // Birds from obstacles sheet
+    {134, 15, 46, 40},      // BIRD_FLYING_1
+    {180, 15, 46, 40},      // BIRD_FLYING_2
     
-    // Cloud decoration
-    {SpriteType::CLOUD, sf::IntRect(86, 2, 46, 14)}
+    {0, 0, 32, 32},         // GROUND (not in the sheets, safe fallback)
+    {86, 2, 46, 14},        // CLOUD
+    {0, 0, 32, 32}          // BACKGROUND (not in the sheets, safe fallback)
 };
 
+// Whole-texture rectangles used with the colored fallback textures
+static constexpr SpriteRectSpec FALLBACK_SPRITE_RECTS[TextureManager::SPRITE_TYPE_COUNT] = {
+    {0, 0, 80, 86},         // DINO_RUNNING_1
+    {0, 0, 80, 86},         // DINO_RUNNING_2
+    {0, 0, 80, 86},         // DINO_JUMPING
+    {0, 0, 110, 53},        // DINO_DUCKING_1
+    {0, 0, 110, 53},        // DINO_DUCKING_2
+    {0, 0, 15, 35},         // CACTUS_SMALL
+    {0, 0, 25, 48},         // CACTUS_MID
+    {0, 0, 32, 68},         // CACTUS_LARGE
+    {0, 0, 46, 40},         // BIRD_FLYING_1
+    {0, 0, 46, 40},         // BIRD_FLYING_2
+    {0, 0, 32, 32},         // GROUND
+    {86, 2, 46, 14},        // CLOUD
+    {0, 0, 32, 32}          // BACKGROUND
+};
+
+// Only the fallback set defines fewer rectangles; the rest come from SHEET_SPRITE_RECTS
+static constexpr int FALLBACK_DEFINED_COUNT = static_cast<int>(TextureManager::SpriteType::BIRD_FLYING_2) + 1;
+
+static_assert(static_cast<int>(TextureManager::SpriteType::BACKGROUND) + 1 == TextureManager::SPRITE_TYPE_COUNT,
+              "SPRITE_TYPE_COUNT must match the SpriteType enum");
+static_assert(SHEET_SPRITE_RECTS[static_cast<int>(TextureManager::SpriteType::CACTUS_MID)].width == 25,
+              "SHEET_SPRITE_RECTS must follow SpriteType order");
+
+static sf::IntRect toIntRect(const SpriteRectSpec& spec) {
+    return sf::IntRect(spec.left, spec.top, spec.width, spec.height);
+}
+
+// Drawn size of a sprite in whole pixels (collision masks are per pixel)
+static sf::Vector2i toMaskSize(const sf::Vector2f& renderSize) {
+    return sf::Vector2i(static_cast<int>(std::lround(renderSize.x)), static_cast<int>(std::lround(renderSize.y)));
+}
+
 // ===== Core Methods =====
 
+TextureManager::TextureManager() {
+    resolveSpriteHandles();  // Default rectangles, no textures yet
+}
+
 TextureManager& TextureManager::getInstance() {
     if (!instance) {
         instance = std::unique_ptr<TextureManager>(new TextureManager());
@@ -88,17 +139,28 @@ bool TextureManager::initialize() {
         }
     }
     
+    bool ready = finishSheetLoading();
     if (dinoLoaded && obstaclesLoaded) {
-        spriteRects = DEFAULT_SPRITE_RECTS;
-        std::cout << "All sprite sheets loaded successfully!" << std::endl;
         printDebugInfo();
+    }
+    return ready;
+}
+
+bool TextureManager::finishSheetLoading() {
+    bool dinoLoaded = isTextureLoaded("dino_sheet");
+    bool obstaclesLoaded = isTextureLoaded("obstacles_sheet");
+    
+    if (dinoLoaded && obstaclesLoaded) {
+        applySheetSpriteRects();
+        resolveSpriteHandles();
+        std::cout << "All sprite sheets loaded successfully!" << std::endl;
         return true;
-    } else {
-        std::cout << "Some sprite sheets failed to load. Creating fallbacks..." << std::endl;
-        std::cout << "Dino loaded: " << (dinoLoaded ? "YES" : "NO") << std::endl;
-        std::cout << "Obstacles loaded: " << (obstaclesLoaded ? "YES" : "NO") << std::endl;
-        return createFallbackTextures();
     }
+    
+    std::cout << "Some sprite sheets failed to load. Creating fallbacks..." << std::endl;
+    std::cout << "Dino loaded: " << (dinoLoaded ? "YES" : "NO") << std::endl;
+    std::cout << "Obstacles loaded: " << (obstaclesLoaded ? "YES" : "NO") << std::endl;
+    return createFallbackTextures();
 }
 
 bool TextureManager::createFallbackTextures() {
@@ -115,16 +177,10 @@ bool TextureManager::createFallbackTextures() {
         textures["bird_fallback"] = std::move(birdTexture);
         
         // Set up fallback sprite rectangles for collision control
-        spriteRects[SpriteType::DINO_RUNNING_1] = sf::IntRect(0, 0, 80, 86);
-        spriteRects[SpriteType::DINO_RUNNING_2] = sf::IntRect(0, 0, 80, 86);
-        spriteRects[SpriteType::DINO_JUMPING] = sf::IntRect(0, 0, 80, 86);
-        spriteRects[SpriteType::DINO_DUCKING_1] = sf::IntRect(0, 0, 110, 53);
-        spriteRects[SpriteType::DINO_DUCKING_2] = sf::IntRect(0, 0, 110, 53);
-        spriteRects[SpriteType::CACTUS_SMALL] = sf::IntRect(0, 0, 15, 35);
-        spriteRects[SpriteType::CACTUS_MID] = sf::IntRect(0, 0, 25, 48);
-        spriteRects[SpriteType::CACTUS_LARGE] = sf::IntRect(0, 0, 32, 68);
-        spriteRects[SpriteType::BIRD_FLYING_1] = sf::IntRect(0, 0, 46, 40);
-        spriteRects[SpriteType::BIRD_FLYING_2] = sf::IntRect(0, 0, 46, 40);
+        for (int i = 0; i < FALLBACK_DEFINED_COUNT; ++i) {
+            spriteRects[static_cast<SpriteType>(i)] = toIntRect(FALLBACK_SPRITE_RECTS[i]);
+        }
+        resolveSpriteHandles();
         
         std::cout << "Fallback textures created successfully." << std::endl;
         return true;
@@ -136,7 +192,9 @@ bool TextureManager::createFallbackTextures() {
 
 void TextureManager::cleanup() {
     textures.clear();
+    textureMasks.clear();
     spriteRects.clear();
+    resolveSpriteHandles();  // Drop pointers to the destroyed textures
     std::cout << "TextureManager cleaned up." << std::endl;
 }
 
@@ -147,17 +205,49 @@ bool TextureManager::loadTexture(const std::string& name, const std::string& fil
         return true;
     }
     
+    // Decode through sf::Image so the collision mask is built from the same pixels
+    sf::Image image;
     auto texture = std::make_unique<sf::Texture>();
     
-    if (!texture->loadFromFile(filepath)) {
+    if (!image.loadFromFile(filepath) || !texture->loadFromImage(image)) {
         return false;
     }
     
     textures[name] = std::move(texture);
+    buildTextureMask(name, image.getPixelsPtr(), image.getSize());
+    resolveSpriteHandles();
     std::cout << "    Loaded: " << name << " from " << filepath << std::endl;
     return true;
 }
 
+bool TextureManager::loadTextureFromImage(const std::string& name, const sf::Image& image, bool repeated) {
+    auto texture = std::make_unique<sf::Texture>();
+    if (!texture->loadFromImage(image)) {
+        return false;
+    }
+    texture->setRepeated(repeated);
+    
+    textures[name] = std::move(texture);
+    buildTextureMask(name, image.getPixelsPtr(), image.getSize());
+    resolveSpriteHandles();
+    return true;
+}
+
+bool TextureManager::loadTextureFromBundle(const std::string& name, const AssetBundle& bundle) {
+    auto texture = std::make_unique<sf::Texture>();
+    if (!bundle.loadTexture(name, *texture)) {
+        return false;
+    }
+    
+    // Same pixels the texture was uploaded from (loadTexture succeeded, so the entry exists)
+    const AssetBundle::Entry* entry = bundle.find(name);
+    textures[name] = std::move(texture);
+    buildTextureMask(name, static_cast<const sf::Uint8*>(bundle.getData(*entry)),
+                     sf::Vector2u(entry->param0, entry->param1));
+    resolveSpriteHandles();
+    return true;
+}
+
 bool TextureManager::loadSpriteSheet(const std::string& name, const std::string& filepath,
                                    const std::unordered_map<SpriteType, sf::IntRect>& spriteDefinitions) {
     if (!loadTexture(name, filepath)) {
@@ -168,6 +258,7 @@ bool TextureManager::loadSpriteSheet(const std::string& name, const std::string&
     for (const auto& spriteDefPair : spriteDefinitions) {
         spriteRects[spriteDefPair.first] = spriteDefPair.second;
     }
+    resolveSpriteHandles();
     
     std::cout << "Loaded sprite sheet: " << name << " with " << spriteDefinitions.size() << " sprites." << std::endl;
     return true;
@@ -181,34 +272,61 @@ const sf::Texture* TextureManager::getTexture(const std::string& name) const {
 }
 
 const sf::Texture* TextureManager::getTexture(SpriteType spriteType) const {
+    return spriteHandles[static_cast<int>(spriteType)].texture;
+}
+
+sf::IntRect TextureManager::getSpriteRect(SpriteType spriteType) const {
+    return spriteHandles[static_cast<int>(spriteType)].rect;
+}
+
+bool TextureManager::copySpriteImage(SpriteType spriteType, sf::Image& image) const {
+    // Sheets only: the fallback rectangles do not match the fallback textures
     std::string textureName = getTextureNameForSprite(spriteType);
+    const SpriteHandle& handle = getSpriteHandle(spriteType);
+    if (!handle.texture || (textureName != "dino_sheet" && textureName != "obstacles_sheet")) {
+        return false;
+    }
     
-    auto it = textures.find(textureName);
-    if (it != textures.end()) {
-        // std::cout << "[DEBUG] ✅ Texture found: " << textureName << std::endl;
-        return it->second.get();
-    } else {
-        // std::cout << "[DEBUG] ❌ Texture NOT found: " << textureName << std::endl;
-        // std::cout << "[DEBUG] Available textures:" << std::endl;
-        // for (const auto& pair : textures) {
-        //     std::cout << "[DEBUG]   - " << pair.first << std::endl;
-        // }
-        return nullptr;
+    sf::Image sheet = handle.texture->copyToImage();
+    sf::Vector2u sheetSize = sheet.getSize();
+    const sf::IntRect& rect = handle.rect;
+    if (rect.left < 0 || rect.top < 0 || rect.width <= 0 || rect.height <= 0 ||
+        static_cast<unsigned int>(rect.left + rect.width) > sheetSize.x ||
+        static_cast<unsigned int>(rect.top + rect.height) > sheetSize.y) {
+        return false;
     }
+    
+    image.create(rect.width, rect.height, sf::Color::Transparent);
+    image.copy(sheet, 0, 0, rect);
+    return true;
 }
 
-sf::IntRect TextureManager::getSpriteRect(SpriteType spriteType) const {
-    auto it = spriteRects.find(spriteType);
-    if (it != spriteRects.end()) {
-        return it->second;
+// ===== Collision Mask Methods =====
+
+void TextureManager::prepareCollisionMask(SpriteType spriteType, const sf::Vector2f& renderSize) {
+    sf::Vector2i size = toMaskSize(renderSize);
+    for (const SpriteCollisionMask& entry : spriteCollisionMasks) {
+        if (entry.spriteType == spriteType && entry.size == size) {
+            return;  // Already prepared
+        }
     }
     
-    auto defaultIt = DEFAULT_SPRITE_RECTS.find(spriteType);
-    if (defaultIt != DEFAULT_SPRITE_RECTS.end()) {
-        return defaultIt->second;
+    SpriteCollisionMask entry;
+    entry.spriteType = spriteType;
+    entry.size = size;
+    spriteCollisionMasks.push_back(entry);
+    rebuildCollisionMasks();
+}
+
+const CollisionMask* TextureManager::getCollisionMask(SpriteType spriteType, const sf::Vector2f& renderSize) const {
+    // Linear scan: a few entries per sprite type at most
+    sf::Vector2i size = toMaskSize(renderSize);
+    for (const SpriteCollisionMask& entry : spriteCollisionMasks) {
+        if (entry.spriteType == spriteType && entry.size == size) {
+            return entry.mask.isEmpty() ? nullptr : &entry.mask;
+        }
     }
-    
-    return sf::IntRect(0, 0, 32, 32);  // Safe fallback
+    return nullptr;
 }
 
 // ===== Sprite Creation Methods =====
@@ -216,10 +334,10 @@ sf::IntRect TextureManager::getSpriteRect(SpriteType spriteType) const {
 sf::Sprite TextureManager::createSprite(SpriteType spriteType) const {
     sf::Sprite sprite;
     
-    const sf::Texture* texture = getTexture(spriteType);
-    if (texture) {
-        sprite.setTexture(*texture);
-        sprite.setTextureRect(getSpriteRect(spriteType));
+    const SpriteHandle& handle = getSpriteHandle(spriteType);
+    if (handle.texture) {
+        sprite.setTexture(*handle.texture);
+        sprite.setTextureRect(handle.rect);
     }
     
     return sprite;
@@ -234,7 +352,7 @@ sf::Sprite TextureManager::createSprite(SpriteType spriteType, double scale) con
 sf::Sprite TextureManager::createSprite(SpriteType spriteType, const sf::Vector2f& targetSize) const {
     sf::Sprite sprite = createSprite(spriteType);
     
-    sf::IntRect spriteRect = getSpriteRect(spriteType);
+    const sf::IntRect& spriteRect = getSpriteHandle(spriteType).rect;
     float scaleX = targetSize.x / spriteRect.width;
     float scaleY = targetSize.y / spriteRect.height;
     
@@ -257,6 +375,18 @@ size_t TextureManager::getLoadedTextureCount() const {
     return textures.size();
 }
 
+size_t TextureManager::getTextureMemoryUsage() const {
+    size_t totalBytes = 0;
+    
+    // C++14 compatible loop
+    for (const auto& texturePair : textures) {
+        sf::Vector2u size = texturePair.second->getSize();
+        totalBytes += static_cast<size_t>(size.x) * size.y * 4;  // RGBA8
+    }
+    
+    return totalBytes;
+}
+
 void TextureManager::printDebugInfo() const {
     std::cout << "\n=== TextureManager Debug Info ===" << std::endl;
     std::cout << "Loaded textures: " << textures.size() << std::endl;
@@ -295,6 +425,50 @@ std::string TextureManager::getTextureNameForSprite(SpriteType spriteType) const
     }
 }
 
+void TextureManager::applySheetSpriteRects() {
+    for (int i = 0; i < SPRITE_TYPE_COUNT; ++i) {
+        if (i == static_cast<int>(SpriteType::GROUND) || i == static_cast<int>(SpriteType::BACKGROUND)) {
+            continue;  // Not part of the sprite sheets
+        }
+        spriteRects[static_cast<SpriteType>(i)] = toIntRect(SHEET_SPRITE_RECTS[i]);
+    }
+}
+
+void TextureManager::resolveSpriteHandles() {
+    // Cold path: the string lookups happen here once instead of on every sprite change
+    for (int i = 0; i < SPRITE_TYPE_COUNT; ++i) {
+        SpriteType spriteType = static_cast<SpriteType>(i);
+        SpriteHandle& handle = spriteHandles[i];
+        
+        auto textureIt = textures.find(getTextureNameForSprite(spriteType));
+        handle.texture = (textureIt != textures.end()) ? textureIt->second.get() : nullptr;
+        
+        // Defined rectangle first, then the sheet default
+        auto rectIt = spriteRects.find(spriteType);
+        handle.rect = (rectIt != spriteRects.end()) ? rectIt->second : toIntRect(SHEET_SPRITE_RECTS[i]);
+    }
+    
+    rebuildCollisionMasks();
+    AnimationClip::resolveAll(*this);  // Clips copy the handles
+}
+
+void TextureManager::rebuildCollisionMasks() {
+    for (SpriteCollisionMask& entry : spriteCollisionMasks) {
+        auto maskIt = textureMasks.find(getTextureNameForSprite(entry.spriteType));
+        if (maskIt == textureMasks.end()) {
+            entry.mask = CollisionMask();  // Fallback or no texture: callers use their boxes instead
+            continue;
+        }
+        
+        const sf::IntRect& rect = spriteHandles[static_cast<int>(entry.spriteType)].rect;
+        entry.mask = maskIt->second.resampled(rect, entry.size.x, entry.size.y);
+    }
+}
+
+void TextureManager::buildTextureMask(const std::string& name, const sf::Uint8* pixels, sf::Vector2u size) {
+    textureMasks[name] = CollisionMask::fromPixels(pixels, size.x, size.y);
+}
+
 std::unique_ptr<sf::Texture> TextureManager::createFallbackTexture(sf::Color color, sf::Vector2u size) {
     auto texture = std::make_unique<sf::Texture>();
     
@@ -1,5 +1,7 @@
 #include "Game.hpp"
 #include <iostream>
+#include <string>
+#include <cstdlib>
 
 
 /**
@@ -18,7 +20,7 @@ TODO:
  * ✅ 4. Add a high score system and display it on the screen - COMPLETED
  * 
  * ⏳ 4. change the rectangle obstacle to a more complex shape like a bird or a cactus - FUTURE
- *    ⏳ add a background image and a foreground image - FUTURE
+ *    ✅ add a background image and a foreground image - COMPLETED (parallax hills, clouds, ground)
  *    ⏳ add a bird and change rectangle obstacle to cactus - FUTURE
  *    ⏳ change dino from rectangular shape to dinosaur sprite - FUTURE
  *    ⏳ add a sound effect when the dino jumps or collides with an obstacle - FUTURE
@@ -55,13 +57,101 @@ TODO:
  * made manageable through proper abstraction and encapsulation.
  */
 
- int main() {
+/**
+ * Parse command line flags into game options
+ * 
+ * Supported flags:
+ *   --headless            Run the simulation without window, audio or textures
+ *   --duration <seconds>  Simulated seconds to run in headless mode
+ *   --tick-rate <hz>      Fixed simulation steps per second
+ *   --max-catch-up <n>    Maximum simulation steps run in a single frame
+ *   --seed <n>            Fixed obstacle random seed (reproducible sessions)
+ *   --autopilot           Let the built-in bot play (useful with --headless)
+ *   --pixel-collision     Confirm hits on the sprites' opaque pixels (windowed only)
+ *   --threaded-render     Draw on a render thread so a slow frame never delays input or ticks
+ *   --pacing <mode>       Frame pacing: vsync (default), sleep-spin, uncapped, low-power
+ *   --target-fps <n>      Frame rate the sleep-spin limiter paces to and missed frames are judged by
+ *   --assets <file>       Asset bundle to load (built by tools/AssetPacker.cpp)
+ *   --journal <file>      Score journal to read the high score from and append runs to
+ *   --no-journal          Do not read or write the score journal
+ *   --record <file>       Write a replay of the run (seed + inputs) when the game ends
+ *   --stream <file>       Write the per-tick state stream of the run when the game ends
+ *   --ghost <file>        Race a translucent ghost replaying a state stream (repeatable, windowed only)
+ *   --replay <file>       Play a replay instead of taking input (fast with --headless)
+ *   --seek <tick>         With --replay: skip ahead to this tick (headless: stop there)
+ */
+static Game::Options parseOptions(int argc, char* argv[]) {
+    Game::Options options;
+    
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--headless") {
+            options.headless = true;
+        } else if (arg == "--duration" && i + 1 < argc) {
+            options.headlessDuration = std::atof(argv[++i]);
+        } else if (arg == "--tick-rate" && i + 1 < argc) {
+            options.tickRate = std::atof(argv[++i]);
+        } else if (arg == "--max-catch-up" && i + 1 < argc) {
+            options.maxCatchUpSteps = std::atoi(argv[++i]);
+        } else if (arg == "--seed" && i + 1 < argc) {
+            options.seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--autopilot") {
+            options.autopilot = true;
+        } else if (arg == "--pixel-collision") {
+            options.pixelCollision = true;
+        } else if (arg == "--threaded-render") {
+            options.threadedRender = true;
+        } else if (arg == "--pacing" && i + 1 < argc) {
+            std::string mode = argv[++i];
+            if (!FramePacer::parseMode(mode, options.pacing)) {
+                std::cerr << "Unknown pacing mode: " << mode << ", using vsync" << std::endl;
+            }
+        } else if (arg == "--target-fps" && i + 1 < argc) {
+            options.targetFps = std::atoi(argv[++i]);
+        } else if (arg == "--assets" && i + 1 < argc) {
+            options.assetBundlePath = argv[++i];
+        } else if (arg == "--journal" && i + 1 < argc) {
+            options.journalPath = argv[++i];
+        } else if (arg == "--no-journal") {
+            options.journal = false;
+        } else if (arg == "--record" && i + 1 < argc) {
+            options.recordPath = argv[++i];
+        } else if (arg == "--stream" && i + 1 < argc) {
+            options.stateStreamPath = argv[++i];
+        } else if (arg == "--ghost" && i + 1 < argc) {
+            options.ghostPaths.push_back(argv[++i]);
+        } else if (arg == "--replay" && i + 1 < argc) {
+            options.replayPath = argv[++i];
+        } else if (arg == "--seek" && i + 1 < argc) {
+            options.seekTick = std::atoll(argv[++i]);
+        } else {
+            std::cerr << "Ignoring unknown argument: " << arg << std::endl;
+        }
+    }
+    
+    // Guard against nonsensical timing values
+    if (options.tickRate <= 0.0) {
+        std::cerr << "Invalid tick rate, using default" << std::endl;
+        options.tickRate = Game::Options().tickRate;
+    }
+    if (options.maxCatchUpSteps < 1) {
+        options.maxCatchUpSteps = 1;
+    }
+    if (options.targetFps < 1) {
+        std::cerr << "Invalid target fps, using default" << std::endl;
+        options.targetFps = Game::Options().targetFps;
+    }
+    
+    return options;
+}
+
+ int main(int argc, char* argv[]) {
     std::cout << "=== DinoRun: Complete Object-Oriented Architecture ===" << std::endl;
     std::cout << "Initializing game systems..." << std::endl;
     
     try {
         // Create the game instance - this initializes all systems
-        Game game;
+        Game game(parseOptions(argc, argv));
         
         std::cout << "Starting game..." << std::endl;
         
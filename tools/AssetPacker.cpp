@@ -0,0 +1,169 @@
+#include "AssetBundle.hpp"
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+/**
+ * DinoRun asset packer
+ *
+ * Decodes the game's sprite sheets, sounds and font once and writes them
+ * into a single bundle file that AssetBundle memory-maps at startup.
+ *
+ * Build: g++ -std=c++14 -O2 -Iinclude tools/AssetPacker.cpp src/AssetBundle.cpp src/Logger.cpp
+ *        -lsfml-graphics -lsfml-audio -lsfml-system -pthread -o asset_packer
+ *
+ * Usage: asset_packer [assets directory] [output file]
+ *   defaults: assets  assets/dino_assets.bundle  (run from the project root)
+ */
+
+/**
+ * One asset to pack: bundle name, kind and source file relative to the assets directory
+ */
+struct PackSource {
+    const char* name;
+    AssetBundle::AssetKind kind;
+    const char* relativePath;
+};
+
+static const PackSource PACK_SOURCES[] = {
+    {"dino_sheet",      AssetBundle::AssetKind::IMAGE_RGBA8, "sprites/dino_sheet.png"},
+    {"obstacles_sheet", AssetBundle::AssetKind::IMAGE_RGBA8, "sprites/obstacles_sheet.png"},
+    {"jump",            AssetBundle::AssetKind::SOUND_PCM16, "sounds/jump.wav"},
+    {"gameover",        AssetBundle::AssetKind::SOUND_PCM16, "sounds/gameover.wav"},
+    {"point",           AssetBundle::AssetKind::SOUND_PCM16, "sounds/point.wav"},
+    {"font",            AssetBundle::AssetKind::FONT,        "fonts/arial.ttf"}
+};
+
+/**
+ * Decoded asset waiting to be written
+ */
+struct PackedAsset {
+    AssetBundle::Entry entry;
+    std::vector<char> data;
+};
+
+/**
+ * Decode one source file into its bundle representation
+ *
+ * @param source Asset description
+ * @param path Full path of the source file
+ * @param asset Receives entry metadata and data bytes
+ * @return true if the file was read and decoded
+ */
+static bool decodeSource(const PackSource& source, const std::string& path, PackedAsset& asset) {
+    std::memset(&asset.entry, 0, sizeof(asset.entry));
+    std::strncpy(asset.entry.name, source.name, AssetBundle::NAME_CAPACITY - 1);
+    asset.entry.kind = static_cast<uint32_t>(source.kind);
+
+    switch (source.kind) {
+        case AssetBundle::AssetKind::IMAGE_RGBA8: {
+            sf::Image image;
+            if (!image.loadFromFile(path)) {
+                return false;
+            }
+            sf::Vector2u size = image.getSize();
+            const char* pixels = reinterpret_cast<const char*>(image.getPixelsPtr());
+            asset.entry.param0 = size.x;
+            asset.entry.param1 = size.y;
+            asset.data.assign(pixels, pixels + static_cast<size_t>(size.x) * size.y * 4);
+            return true;
+        }
+        case AssetBundle::AssetKind::SOUND_PCM16: {
+            sf::SoundBuffer buffer;
+            if (!buffer.loadFromFile(path)) {
+                return false;
+            }
+            const char* samples = reinterpret_cast<const char*>(buffer.getSamples());
+            asset.entry.param0 = buffer.getChannelCount();
+            asset.entry.param1 = buffer.getSampleRate();
+            asset.data.assign(samples, samples + static_cast<size_t>(buffer.getSampleCount()) * sizeof(sf::Int16));
+            return true;
+        }
+        case AssetBundle::AssetKind::FONT: {
+            std::ifstream file(path.c_str(), std::ios::binary);
+            if (!file) {
+                return false;
+            }
+            asset.data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            return !asset.data.empty();
+        }
+    }
+    return false;
+}
+
+static uint64_t alignUp(uint64_t value) {
+    return (value + AssetBundle::DATA_ALIGNMENT - 1) / AssetBundle::DATA_ALIGNMENT * AssetBundle::DATA_ALIGNMENT;
+}
+
+int main(int argc, char* argv[]) {
+    std::string assetsDirectory = (argc > 1) ? argv[1] : "assets";
+    std::string outputPath = (argc > 2) ? argv[2] : "assets/dino_assets.bundle";
+
+    // Decode every source first so a missing file leaves no half-written bundle
+    std::vector<PackedAsset> assets;
+    for (const PackSource& source : PACK_SOURCES) {
+        std::string path = assetsDirectory + "/" + source.relativePath;
+        PackedAsset asset;
+        if (!decodeSource(source, path, asset)) {
+            std::cerr << "ERROR: Could not decode " << path << std::endl;
+            return 1;
+        }
+        std::cout << "  " << source.name << ": " << asset.data.size() << " bytes from " << path << std::endl;
+        assets.push_back(std::move(asset));
+    }
+
+    // Lay out the data blobs after the entry table
+    uint64_t offset = sizeof(AssetBundle::Header) + assets.size() * sizeof(AssetBundle::Entry);
+    for (PackedAsset& asset : assets) {
+        offset = alignUp(offset);
+        asset.entry.offset = offset;
+        asset.entry.size = asset.data.size();
+        offset += asset.data.size();
+    }
+
+    std::ofstream out(outputPath.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cerr << "ERROR: Could not write " << outputPath << std::endl;
+        return 1;
+    }
+
+    AssetBundle::Header header;
+    std::memcpy(header.magic, AssetBundle::MAGIC, sizeof(header.magic));
+    header.version = AssetBundle::FORMAT_VERSION;
+    header.entryCount = static_cast<uint32_t>(assets.size());
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (const PackedAsset& asset : assets) {
+        out.write(reinterpret_cast<const char*>(&asset.entry), sizeof(asset.entry));
+    }
+
+    const char padding[AssetBundle::DATA_ALIGNMENT] = {};
+    uint64_t written = sizeof(AssetBundle::Header) + assets.size() * sizeof(AssetBundle::Entry);
+    for (const PackedAsset& asset : assets) {
+        out.write(padding, static_cast<std::streamsize>(asset.entry.offset - written));
+        out.write(asset.data.data(), static_cast<std::streamsize>(asset.data.size()));
+        written = asset.entry.offset + asset.data.size();
+    }
+
+    if (!out) {
+        std::cerr << "ERROR: Write to " << outputPath << " failed" << std::endl;
+        return 1;
+    }
+
+    out.close();
+    
+    // Read the result back through the runtime loader's validation
+    AssetBundle check;
+    if (!check.open(outputPath) || check.getEntryCount() != assets.size()) {
+        std::cerr << "ERROR: " << outputPath << " failed validation" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Wrote " << assets.size() << " assets (" << written << " bytes) to " << outputPath << std::endl;
+    return 0;
+}
@@ -0,0 +1,455 @@
+#include "ObstacleManager.hpp"
+#include "Player.hpp"
+#include "AutoPilot.hpp"
+#include "CollisionManager.hpp"
+#include "TextureManager.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * DinoRun difficulty tuner
+ *
+ * Plays thousands of independent headless sessions with the AutoPilot bot for
+ * every point of a difficulty parameter grid, in parallel on all cores, and
+ * reports survival-time distributions and per-pattern death rates.
+ *
+ * Every grid point uses the same session seeds (base seed + session index), so
+ * differences between grid points come from the parameters, not from luck.
+ *
+ * Build: see README ("Difficulty tuner")
+ *
+ * Usage: difficulty_tuner [--sessions <n>] [--threads <n>] [--seed <n>] [--max-time <s>]
+ *                         [--speed-rate <a,b,..>] [--interval-rate <a,b,..>] [--difficulty-rate <a,b,..>]
+ *                         [--pattern-time <p>=<s>] [--pattern-difficulty <p>=<v>] [--pattern-spacing <p>=<scale>]
+ *                         [--out <file.csv>]
+ *   Rate lists span the grid (cartesian product); omitted rates keep the built-in value.
+ *   <p> is a pattern index (0 = SINGLE_SMALL ... 7 = TIGHT_SEQUENCE); pattern overrides apply to every grid point.
+ */
+
+// ===== Tuner Configuration =====
+static const double TUNER_TICK = 1.0 / 120.0;      // Same tick as the game default
+static const int SESSIONS_PER_TASK = 8;            // Sessions claimed at once (keeps queue traffic low)
+static const int DEFAULT_SESSIONS = 1000;          // Sessions per grid point
+static const double DEFAULT_MAX_TIME = 300.0;      // Sessions still alive after this count as survived
+
+typedef ObstacleManager::ObstaclePattern Pattern;
+
+// ===== Work-Stealing Pool =====
+
+/**
+ * Fixed set of tasks spread over per-worker deques
+ * Workers pop from the back of their own deque and steal from the front of others,
+ * so uneven session lengths even out without a shared queue every worker contends on
+ */
+class WorkStealingPool {
+public:
+    /**
+     * Sessions [firstSession, firstSession + sessionCount) of one grid point
+     */
+    struct Task {
+        size_t gridPoint;
+        int firstSession;
+        int sessionCount;
+    };
+
+    typedef std::function<void(size_t worker, const Task& task)> TaskFunction;
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::atomic<size_t> stealCount;
+
+public:
+    explicit WorkStealingPool(size_t workerCount) : stealCount(0) {
+        for (size_t i = 0; i < workerCount; ++i) {
+            queues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
+        }
+    }
+
+    /**
+     * Queue a task before run() (round-robin over the workers)
+     */
+    void add(const Task& task, size_t index) {
+        queues[index % queues.size()]->tasks.push_back(task);
+    }
+
+    /**
+     * Run every task on one thread per worker and wait for all of them
+     */
+    void run(const TaskFunction& function) {
+        std::vector<std::thread> threads;
+        for (size_t worker = 0; worker < queues.size(); ++worker) {
+            threads.push_back(std::thread([this, worker, &function]() {
+                Task task;
+                while (pop(worker, task)) {
+                    function(worker, task);
+                }
+            }));
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    size_t getStealCount() const {
+        return stealCount.load();
+    }
+
+private:
+    /**
+     * Take the next task: own deque first, then steal
+     * No tasks are added while running, so all deques empty means done
+     */
+    bool pop(size_t worker, Task& task) {
+        {
+            WorkerQueue& own = *queues[worker];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                task = own.tasks.back();
+                own.tasks.pop_back();
+                return true;
+            }
+        }
+        for (size_t offset = 1; offset < queues.size(); ++offset) {
+            WorkerQueue& victim = *queues[(worker + offset) % queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = victim.tasks.front();
+                victim.tasks.pop_front();
+                stealCount++;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+// ===== Statistics =====
+
+/**
+ * Results of every session played for one grid point (merged from all workers)
+ */
+struct GridStats {
+    std::vector<float> survivalTimes;                       // Game time at death (or max time)
+    int survivedCount;                                      // Sessions that reached max time
+    size_t deaths[ObstacleManager::PATTERN_COUNT];          // Deaths per pattern of the obstacle hit
+    size_t spawns[ObstacleManager::PATTERN_COUNT];          // Pattern spawns over all sessions
+
+    GridStats() : survivedCount(0) {
+        std::fill(deaths, deaths + ObstacleManager::PATTERN_COUNT, 0);
+        std::fill(spawns, spawns + ObstacleManager::PATTERN_COUNT, 0);
+    }
+
+    void merge(const GridStats& other) {
+        survivalTimes.insert(survivalTimes.end(), other.survivalTimes.begin(), other.survivalTimes.end());
+        survivedCount += other.survivedCount;
+        for (int p = 0; p < ObstacleManager::PATTERN_COUNT; ++p) {
+            deaths[p] += other.deaths[p];
+            spawns[p] += other.spawns[p];
+        }
+    }
+};
+
+/**
+ * Pattern override from the command line
+ */
+struct PatternOverride {
+    enum class Field { MIN_TIME, DIFFICULTY, SPACING } field;
+    int pattern;
+    double value;
+};
+
+/**
+ * Simulation objects owned by one worker thread, reused for every session it plays
+ */
+struct Worker {
+    std::unique_ptr<ObstacleManager> obstacleManager;
+    std::unique_ptr<Player> player;
+    std::vector<GridStats> stats;   // One per grid point, merged after the run
+};
+
+/**
+ * Play one session to the first collision or the time limit
+ *
+ * @return true if the player died; pattern receives the pattern of the obstacle hit
+ */
+static bool playSession(Worker& worker, unsigned int seed, const ObstacleManager::DifficultyParams& params,
+                        double maxTime, double& survivalTime, Pattern& pattern) {
+    ObstacleManager& obstacleManager = *worker.obstacleManager;
+    Player& player = *worker.player;
+    obstacleManager.clear();
+    obstacleManager.setSeed(seed);
+    obstacleManager.setDifficultyParams(params);
+    player.reset();
+    AutoPilot bot;
+
+    // Same order as Game::updatePlayingState
+    double gameTime = 0.0;
+    CollisionManager::CollisionInfo info;
+    while (gameTime < maxTime) {
+        bot.update(player, obstacleManager);
+        gameTime += TUNER_TICK;
+        player.update(TUNER_TICK);
+        obstacleManager.update(TUNER_TICK, gameTime);
+        if (CollisionManager::checkPlayerObstacleCollisionTriple(player, obstacleManager, &info)) {
+            survivalTime = gameTime;
+            pattern = obstacleManager.getObstaclePattern(info.obstacleIndex);
+            return true;
+        }
+    }
+    survivalTime = maxTime;
+    return false;
+}
+
+static void runTask(Worker& worker, const WorkStealingPool::Task& task, unsigned int baseSeed,
+                    const std::vector<ObstacleManager::DifficultyParams>& grid, double maxTime) {
+    GridStats& stats = worker.stats[task.gridPoint];
+    for (int i = 0; i < task.sessionCount; ++i) {
+        int session = task.firstSession + i;
+
+        size_t spawnsBefore[ObstacleManager::PATTERN_COUNT];
+        for (int p = 0; p < ObstacleManager::PATTERN_COUNT; ++p) {
+            spawnsBefore[p] = worker.obstacleManager->getPatternSpawnCount(static_cast<Pattern>(p));
+        }
+
+        double survivalTime = 0.0;
+        Pattern deathPattern = Pattern::SINGLE_SMALL;
+        bool died = playSession(worker, baseSeed + static_cast<unsigned int>(session), grid[task.gridPoint],
+                                maxTime, survivalTime, deathPattern);
+
+        stats.survivalTimes.push_back(static_cast<float>(survivalTime));
+        if (died) {
+            stats.deaths[static_cast<int>(deathPattern)]++;
+        } else {
+            stats.survivedCount++;
+        }
+        for (int p = 0; p < ObstacleManager::PATTERN_COUNT; ++p) {
+            stats.spawns[p] += worker.obstacleManager->getPatternSpawnCount(static_cast<Pattern>(p)) - spawnsBefore[p];
+        }
+    }
+}
+
+// ===== Command Line =====
+
+static std::vector<double> parseList(const std::string& text) {
+    std::vector<double> values;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            values.push_back(std::atof(item.c_str()));
+        }
+    }
+    return values;
+}
+
+static bool parseOverride(const std::string& text, PatternOverride::Field field, PatternOverride& result) {
+    size_t equals = text.find('=');
+    if (equals == std::string::npos) {
+        return false;
+    }
+    result.field = field;
+    result.pattern = std::atoi(text.substr(0, equals).c_str());
+    result.value = std::atof(text.substr(equals + 1).c_str());
+    return result.pattern >= 0 && result.pattern < ObstacleManager::PATTERN_COUNT;
+}
+
+static void applyOverrides(ObstacleManager& obstacleManager, const std::vector<PatternOverride>& overrides) {
+    for (const PatternOverride& o : overrides) {
+        Pattern pattern = static_cast<Pattern>(o.pattern);
+        ObstacleManager::PatternDefinition definition = obstacleManager.getPatternDefinition(pattern);
+        switch (o.field) {
+            case PatternOverride::Field::MIN_TIME:
+                definition.minGameTime = o.value;
+                break;
+            case PatternOverride::Field::DIFFICULTY:
+                definition.patternDifficulty = o.value;
+                break;
+            case PatternOverride::Field::SPACING:
+                for (int i = 0; i < definition.obstacleCount; ++i) {
+                    definition.relativePositions[i] *= o.value;
+                }
+                break;
+        }
+        obstacleManager.setPatternDefinition(pattern, definition);
+    }
+}
+
+// ===== Output =====
+
+static double percentile(const std::vector<float>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t index = static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5);
+    return sorted[index];
+}
+
+int main(int argc, char* argv[]) {
+    ObstacleManager::DifficultyParams defaults = ObstacleManager::getDefaultDifficultyParams();
+    std::vector<double> speedRates(1, defaults.speedIncreaseRate);
+    std::vector<double> intervalRates(1, defaults.intervalDecreaseRate);
+    std::vector<double> difficultyRates(1, defaults.difficultyIncreaseRate);
+    std::vector<PatternOverride> overrides;
+    int sessions = DEFAULT_SESSIONS;
+    unsigned int baseSeed = 1;
+    double maxTime = DEFAULT_MAX_TIME;
+    size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+    std::string outputPath = "difficulty_tuning.csv";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        PatternOverride patternOverride;
+        if (arg == "--sessions" && i + 1 < argc) {
+            sessions = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--threads" && i + 1 < argc) {
+            threadCount = static_cast<size_t>(std::max(1, std::atoi(argv[++i])));
+        } else if (arg == "--seed" && i + 1 < argc) {
+            baseSeed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--max-time" && i + 1 < argc) {
+            maxTime = std::atof(argv[++i]);
+        } else if (arg == "--speed-rate" && i + 1 < argc) {
+            speedRates = parseList(argv[++i]);
+        } else if (arg == "--interval-rate" && i + 1 < argc) {
+            intervalRates = parseList(argv[++i]);
+        } else if (arg == "--difficulty-rate" && i + 1 < argc) {
+            difficultyRates = parseList(argv[++i]);
+        } else if (arg == "--pattern-time" && i + 1 < argc &&
+                   parseOverride(argv[++i], PatternOverride::Field::MIN_TIME, patternOverride)) {
+            overrides.push_back(patternOverride);
+        } else if (arg == "--pattern-difficulty" && i + 1 < argc &&
+                   parseOverride(argv[++i], PatternOverride::Field::DIFFICULTY, patternOverride)) {
+            overrides.push_back(patternOverride);
+        } else if (arg == "--pattern-spacing" && i + 1 < argc &&
+                   parseOverride(argv[++i], PatternOverride::Field::SPACING, patternOverride)) {
+            overrides.push_back(patternOverride);
+        } else if (arg == "--out" && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else {
+            std::cerr << "Ignoring unknown or malformed argument: " << arg << std::endl;
+        }
+    }
+
+    if (speedRates.empty() || intervalRates.empty() || difficultyRates.empty()) {
+        std::cerr << "ERROR: Empty rate list" << std::endl;
+        return 1;
+    }
+
+    // Spawn/collision logs would serialize the workers on the log ring
+    Logger::getInstance().setLevel(LogLevel::WARN);
+    TextureManager::getInstance();  // Construct the singleton before workers create sprites
+
+    // Cartesian product of the rate lists
+    std::vector<ObstacleManager::DifficultyParams> grid;
+    for (double speedRate : speedRates) {
+        for (double intervalRate : intervalRates) {
+            for (double difficultyRate : difficultyRates) {
+                ObstacleManager::DifficultyParams params;
+                params.speedIncreaseRate = speedRate;
+                params.intervalDecreaseRate = intervalRate;
+                params.difficultyIncreaseRate = difficultyRate;
+                grid.push_back(params);
+            }
+        }
+    }
+
+    std::vector<Worker> workers(threadCount);
+    for (Worker& worker : workers) {
+        worker.obstacleManager.reset(new ObstacleManager());
+        worker.player.reset(new Player(100, 400));
+        worker.stats.resize(grid.size());
+        applyOverrides(*worker.obstacleManager, overrides);
+    }
+
+    WorkStealingPool pool(threadCount);
+    size_t taskIndex = 0;
+    for (size_t g = 0; g < grid.size(); ++g) {
+        for (int first = 0; first < sessions; first += SESSIONS_PER_TASK) {
+            WorkStealingPool::Task task;
+            task.gridPoint = g;
+            task.firstSession = first;
+            task.sessionCount = std::min(SESSIONS_PER_TASK, sessions - first);
+            pool.add(task, taskIndex++);
+        }
+    }
+
+    std::cout << "Tuning " << grid.size() << " grid points x " << sessions << " sessions on "
+              << threadCount << " threads (max " << maxTime << " s per session)..." << std::endl;
+
+    auto wallStart = std::chrono::steady_clock::now();
+    pool.run([&](size_t worker, const WorkStealingPool::Task& task) {
+        runTask(workers[worker], task, baseSeed, grid, maxTime);
+    });
+    std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - wallStart;
+
+    size_t totalSessions = grid.size() * static_cast<size_t>(sessions);
+    std::cout << "Played " << totalSessions << " sessions in " << wallTime.count() << " s ("
+              << totalSessions / std::max(wallTime.count(), 1e-9) << " sessions/s, "
+              << pool.getStealCount() << " steals)" << std::endl;
+
+    std::ofstream out(outputPath.c_str());
+    if (!out) {
+        std::cerr << "ERROR: Could not write " << outputPath << std::endl;
+        return 1;
+    }
+
+    // Pattern names for the header come from the definitions actually used
+    const ObstacleManager& reference = *workers[0].obstacleManager;
+    out << "speed_rate,interval_rate,difficulty_rate,sessions,survived,mean_s,p10_s,p50_s,p90_s";
+    for (int p = 0; p < ObstacleManager::PATTERN_COUNT; ++p) {
+        std::string name = reference.getPatternDefinition(static_cast<Pattern>(p)).patternName;
+        out << ",\"deaths " << name << "\",\"death rate " << name << "\"";
+    }
+    out << "\n";
+
+    for (size_t g = 0; g < grid.size(); ++g) {
+        GridStats merged;
+        for (const Worker& worker : workers) {
+            merged.merge(worker.stats[g]);
+        }
+        std::sort(merged.survivalTimes.begin(), merged.survivalTimes.end());
+
+        double total = 0.0;
+        for (float time : merged.survivalTimes) {
+            total += time;
+        }
+        double mean = merged.survivalTimes.empty() ? 0.0 : total / merged.survivalTimes.size();
+
+        const ObstacleManager::DifficultyParams& params = grid[g];
+        out << params.speedIncreaseRate << "," << params.intervalDecreaseRate << "," << params.difficultyIncreaseRate
+            << "," << merged.survivalTimes.size() << "," << merged.survivedCount << "," << mean
+            << "," << percentile(merged.survivalTimes, 0.1) << "," << percentile(merged.survivalTimes, 0.5)
+            << "," << percentile(merged.survivalTimes, 0.9);
+        for (int p = 0; p < ObstacleManager::PATTERN_COUNT; ++p) {
+            // Death rate: share of this pattern's spawns that ended a session
+            double rate = merged.spawns[p] > 0 ? static_cast<double>(merged.deaths[p]) / merged.spawns[p] : 0.0;
+            out << "," << merged.deaths[p] << "," << rate;
+        }
+        out << "\n";
+
+        std::cout << "  speed " << params.speedIncreaseRate << ", interval " << params.intervalDecreaseRate
+                  << ", difficulty " << params.difficultyIncreaseRate << ": mean " << mean
+                  << " s, p50 " << percentile(merged.survivalTimes, 0.5) << " s, survived "
+                  << merged.survivedCount << "/" << merged.survivalTimes.size() << std::endl;
+    }
+
+    std::cout << "Results written to " << outputPath << std::endl;
+    return 0;
+}